@@ -30,28 +30,38 @@
 #include <Arduino.h>
 #include <Alarm.h>
 #include <Peers.h>
+#include <Journal.h>
+#include <AlarmStore.h>
 #include <secrets.h>
+#include <preferences.h>
 #include <time.h>
 
 Alarm::Alarm(Oled *oled) {
   this->oled = oled;
 
   armed = ALARM_OFF;
-  alert = false;
+  state = STATE_DISARMED;
   alarmButton = 0;
+  now_ts = 0;
+  deadline = 0;
+  trigger[0] = 0;
+  trigger_zone = ZONE_NONE;
 
   lasttime = 0;
 
-  if (oled) {
-    alarmButton = new OledButton();
-    alarmButton->initButton(oled,
+  // Drawn when it's on a screen, see Oled::addWidget()
+  if (oled)
+    alarmButton = new OledButtonWidget(
       120,					// x
       90,					// y
       180, 120,					// w, h
       TFT_WHITE, TFT_DARKGREEN, TFT_WHITE,	// outline, fill, text colours
-      (char *)"Uit", 3);			// text, size
-    alarmButton->drawButton();
-  }
+      "Uit", 3,					// text, size
+      Touched, this);
+}
+
+OledButtonWidget *Alarm::GetButton() {
+  return alarmButton;
 }
 
 Alarm::~Alarm() {
@@ -69,26 +79,25 @@ void Alarm::SetArmed(const char *ss) {
 }
 
 void Alarm::SetArmed(AlarmStatus s) {
-  armed = s;
-
-  if (alarmButton == 0)
-    return;
-
   switch (s) {
   case ALARM_OFF:
-    alarmButton->setFillColor(TFT_GREEN);
-    alarmButton->setText("Uit");
+    Event(EVENT_DISARM);
     break;
   case ALARM_ON:
-    alarmButton->setFillColor(TFT_RED);
-    alarmButton->setText("Aan");
+    Event(EVENT_ARM);
+    break;
+  case ALARM_NIGHT:
+    Event(EVENT_ARM_NIGHT);
     break;
   }
 }
 
-void Alarm::SetArmed(AlarmStatus s, AlarmZone zone) {
+void Alarm::SetArmed(AlarmStatus s, AlarmZone zone, const char *who) {
   SetArmed(s);
 
+  if (journal)
+    journal->Log(JOURNAL_ARM, who ? who : (zone == ZONE_FROMPEER) ? "peer" : "", zone, s);
+
   if (zone != ZONE_FROMPEER) {
     peers->AlarmSetArmed(s);
   }
@@ -98,6 +107,94 @@ AlarmStatus Alarm::GetArmed() {
   return armed;
 }
 
+AlarmState Alarm::GetState() {
+  return state;
+}
+
+/*
+ * Run the state machine, see AlarmMachine.h. This does what the transition says.
+ */
+void Alarm::Event(AlarmEvent ev, const char *sensor, AlarmZone zone) {
+  AlarmState prev = state;
+  AlarmStatus prev_armed = armed;
+
+  if (ev == EVENT_TIMEOUT && state == STATE_ENTRY_DELAY) {
+    sensor = trigger;
+    zone = trigger_zone;
+  }
+
+  uint8_t action = AlarmStep(&state, &armed, ev);
+
+  switch (action) {
+  case ACT_EXIT:
+    deadline = millis() + PREF_ALARM_EXIT_DELAY * 1000;
+    break;
+  case ACT_ENTRY:
+    deadline = millis() + PREF_ALARM_ENTRY_DELAY * 1000;
+    strncpy(trigger, sensor ? sensor : "", sizeof(trigger) - 1);
+    trigger[sizeof(trigger) - 1] = 0;
+    trigger_zone = zone;
+    Serial.printf("Entry delay, sensor %s\n", trigger);
+    break;
+  case ACT_SOUND:
+  case ACT_SOUND_PEER:
+    if (journal)
+      journal->Log(JOURNAL_ALARM, sensor, zone);
+    SoundAlarm(sensor);
+    if (action == ACT_SOUND)
+      peers->AlarmSignal(sensor, zone);	// Forward alarm to peers
+    break;
+  }
+
+  if (armed != prev_armed && alarmstore)
+    alarmstore->Save(armed, now_ts);
+  if (state != prev)
+    ShowState();
+}
+
+/*
+ * Back to how we were before a reboot : no exit delay, and the peers know already
+ */
+void Alarm::Restore(AlarmStatus s) {
+  armed = s;
+  state = (s == ALARM_ON) ? STATE_ARMED : (s == ALARM_NIGHT) ? STATE_NIGHT : STATE_DISARMED;
+  ShowState();
+}
+
+void Alarm::ShowState() {
+  if (alarmButton == 0)
+    return;
+
+  switch (state) {
+  case STATE_DISARMED:
+    alarmButton->setFillColor(TFT_GREEN);
+    alarmButton->setText("Uit");
+    break;
+  case STATE_EXIT_DELAY:
+    alarmButton->setFillColor(TFT_ORANGE);
+    alarmButton->setText("Aan");
+    break;
+  case STATE_ARMED:
+    alarmButton->setFillColor(TFT_RED);
+    alarmButton->setText("Aan");
+    break;
+  case STATE_NIGHT:
+    alarmButton->setFillColor(TFT_NAVY);
+    alarmButton->setText("Nacht");
+    break;
+  case STATE_ENTRY_DELAY:
+    alarmButton->setFillColor(TFT_ORANGE);
+    alarmButton->setText("Code ?");
+    break;
+  case STATE_SOUNDING:
+    alarmButton->setFillColor(TFT_RED);
+    alarmButton->setText("Alarm");
+    break;
+  default:
+    break;
+  }
+}
+
 const char *Alarm::GetArmedString() {
   switch (armed) {
     case ALARM_ON: return "armed";
@@ -114,21 +211,20 @@ const char *Alarm::GetArmedString() {
 void Alarm::Signal(const char *sensor, AlarmZone zone) {
   Serial.printf("Got alarm from sensor %s\n", sensor);
 
-  if (zone == ZONE_FROMPEER) {
-    SoundAlarm(sensor);
-    return;
+  switch (zone) {
+  case ZONE_FROMPEER:
+    Event(EVENT_PEER_ALARM, sensor, zone);
+    break;
+  case ZONE_ALWAYS:
+    Event(EVENT_SENSOR_ALWAYS, sensor, zone);
+    break;
+  case ZONE_SECURE:
+    Event(EVENT_SENSOR_SECURE, sensor, zone);
+    break;
+  default:				// Most sensors
+    Event(EVENT_SENSOR_PERIMETER, sensor, zone);
+    break;
   }
-
-  // A locally generated (a sensor) alarm : evaluate based on the zone and alarm state
-  // Return from the function in combinations that don't throw alarms.
-  if (armed == ALARM_OFF && zone != ZONE_ALWAYS)
-    return;
-  if (zone == ZONE_SECURE && armed == ALARM_NIGHT)
-    return;
-
-  // If we get here, we're hitting the alarm.
-  SoundAlarm(sensor);
-  peers->AlarmSignal(sensor, zone); // Forward alarm to peers
 }
 
 /*
@@ -136,21 +232,27 @@ void Alarm::Signal(const char *sensor, AlarmZone zone) {
  * Local only (don't forward to peers, this happened in an earlier phase).
  */
 void Alarm::SoundAlarm(const char *sensor) {
-  alert = true;
+  Serial.printf("Alarm ! (%s)\n", sensor ? sensor : "?");
 }
 
 /*
  * This is to be called from Peers.cpp, so ZONE_FROMPEER.
  */
 void Alarm::Reset(const char *module) {
-  alert = false;
+  Event(EVENT_RESET);
+
+  if (journal)
+    journal->Log(JOURNAL_RESET, module, ZONE_FROMPEER);
 }
 
 /*
  * Reset originates from the local user interface
  */
 void Alarm::Reset(time_t nowts, const char *user) {
-  alert = false;
+  Event(EVENT_RESET);
+
+  if (journal)
+    journal->Log(JOURNAL_RESET, user, ZONE_HID);
 
   peers->AlarmReset(user);
 }
@@ -169,10 +271,10 @@ void Alarm::Toggle(time_t nowts, const char *user) {
   switch (armed) {
   case ALARM_ON:
   case ALARM_NIGHT:
-    SetArmed(ALARM_OFF, ZONE_HID);
+    SetArmed(ALARM_OFF, ZONE_HID, user);
     break;
   case ALARM_OFF:
-    SetArmed(ALARM_ON, ZONE_HID);
+    SetArmed(ALARM_ON, ZONE_HID, user);
     break;
   default:
     ;	// FIX ME
@@ -183,6 +285,12 @@ void Alarm::Toggle(time_t nowts, const char *user) {
  *
  */
 void Alarm::loop(time_t nowts) {
+  now_ts = nowts;
+  // millis(), not nowts : that is 0 until we have the time, and jumps when SNTP syncs
+  if ((state == STATE_EXIT_DELAY || state == STATE_ENTRY_DELAY)
+      && (int32_t)(millis() - deadline) >= 0)
+    Event(EVENT_TIMEOUT);
+
 #if 0
   // Silly test code for the setFillColor method
   if ((nowts % 6) == 0) {
@@ -191,17 +299,19 @@ void Alarm::loop(time_t nowts) {
     if (alarmButton) alarmButton->setFillColor(TFT_GREEN);
   }
 #endif
+}
 
+/*
+ * Touch events on our button
+ */
+void Alarm::Touched(void *pw, const TouchEvent *ev) {
 #ifdef ESP32
-  if (oled) {
-    uint16_t tx, ty;
-    (void) oled->getTouchRaw(&tx, &ty);
-
-    if (oled->getTouchRawZ() > 500 && alarmButton->contains(tx, 320 - ty)) {
-      AlarmButtonPressed();
-    } else
-      AlarmButtonUnpressed();
-  }
+  Alarm *alarm = (Alarm *)pw;
+
+  if (ev->type == TOUCH_PRESS)
+    alarm->AlarmButtonPressed();
+  else if (ev->type == TOUCH_RELEASE)
+    alarm->AlarmButtonUnpressed();
 #endif
 }
 
@@ -21,16 +21,13 @@
  */
 
 #include <Oled.h>
+#include <Touch.h>
+#include <Widget.h>
 
 #ifndef	_ALARM_STATE_H_
 #define	_ALARM_STATE_H_
 
-enum AlarmStatus {
-  ALARM_OFF,		// Only ZONE_ALWAYS triggers the alarm
-  ALARM_ON,		// Any sensor triggers the alarm
-  ALARM_NIGHT,		// ZONE_SECURE sensors won't trigger alarm
-  // ??
-};
+#include <AlarmMachine.h>
 
 // A characteristic of both sensors and controllers
 enum AlarmZone {
@@ -49,10 +46,11 @@ public:
   Alarm(Oled *oled);
   ~Alarm();
   void loop(time_t);
+  OledButtonWidget *GetButton();
 
   void SetArmed(AlarmStatus);
   void SetArmed(const char *);
-  void SetArmed(AlarmStatus s, AlarmZone zone);
+  void SetArmed(AlarmStatus s, AlarmZone zone, const char *who = 0);
   AlarmStatus GetArmed();
   const char *GetArmedString();
 
@@ -61,13 +59,24 @@ public:
   void Reset(const char *module);			// From a peer controller
   void Reset(time_t nowts, const char *user);		// Local
   void Toggle(time_t nowts, const char *user);		// Local
+  AlarmState GetState();
+  void Restore(AlarmStatus s);				// After a reboot
 
 private:
   enum AlarmStatus	armed;	// Armed or not
-  boolean		alert;
+  enum AlarmState	state;
   Oled			*oled;
 
-  OledButton		*alarmButton;
+  time_t		now_ts;
+  uint32_t		deadline;		// millis() at the end of the exit or entry delay
+  char			trigger[32];		// Sensor that started the entry delay
+  AlarmZone		trigger_zone;
+
+  void			Event(AlarmEvent ev, const char *sensor = 0, AlarmZone zone = ZONE_NONE);
+  void			ShowState();
+
+  OledButtonWidget	*alarmButton;
+  static void		Touched(void *pw, const TouchEvent *ev);
   void			AlarmButtonPressed();
   void			AlarmButtonUnpressed();
   uint32_t		lasttime;
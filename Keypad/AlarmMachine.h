@@ -0,0 +1,190 @@
+/*
+ * The alarm state machine : states, events and the transition table
+ *
+ * Nothing here depends on Arduino, so tools/alarmtest.cpp can run it on a PC.
+ * Alarm.cpp does what the actions say (timers, sirens, peers), AlarmStep() only
+ * decides.
+ *
+ * Copyright (c) 2017, 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_ALARM_MACHINE_H_
+#define	_ALARM_MACHINE_H_
+
+#include <stdint.h>
+
+enum AlarmStatus {
+  ALARM_OFF,		// Only ZONE_ALWAYS triggers the alarm
+  ALARM_ON,		// Any sensor triggers the alarm
+  ALARM_NIGHT,		// ZONE_SECURE sensors won't trigger alarm
+  // ??
+};
+
+/*
+ * What the alarm is doing. AlarmStatus is how it's armed, these add the delays and the alarm.
+ */
+enum AlarmState {
+  STATE_DISARMED,
+  STATE_EXIT_DELAY,	// Armed, but there is still time to leave
+  STATE_ARMED,
+  STATE_NIGHT,
+  STATE_ENTRY_DELAY,	// A sensor went off, there is still time to disarm
+  STATE_SOUNDING,
+  STATE_NB,
+  STATE_RESUME = STATE_NB,	// Not a state : the one for the armed status, after an alarm
+};
+
+enum AlarmEvent {
+  EVENT_ARM,
+  EVENT_ARM_NIGHT,
+  EVENT_DISARM,
+  EVENT_SENSOR_SECURE,	// A sensor in that zone, see Alarm::Signal()
+  EVENT_SENSOR_PERIMETER,
+  EVENT_SENSOR_ALWAYS,
+  EVENT_PEER_ALARM,	// A peer decided already
+  EVENT_RESET,
+  EVENT_TIMEOUT,	// The exit or entry delay is over
+  EVENT_NB
+};
+
+enum AlarmAction {
+  ACT_NONE,
+  ACT_EXIT,		// Start the exit delay
+  ACT_ENTRY,		// Start the entry delay
+  ACT_SOUND,		// Sound the alarm, and tell the peers
+  ACT_SOUND_PEER,	// Sound the alarm, a peer told us
+};
+
+struct AlarmTransition {
+  uint8_t	next;		// AlarmState
+  uint8_t	action;		// AlarmAction
+};
+
+#define	T(state, action)	{ STATE_ ## state, ACT_ ## action }
+
+/*
+ * What each event does in each state. Handling an event is looking it up here.
+ */
+static const AlarmTransition alarm_transitions[STATE_NB][EVENT_NB] = {
+  // STATE_DISARMED
+  {
+    T(EXIT_DELAY, EXIT),	// EVENT_ARM
+    T(NIGHT, NONE),		// EVENT_ARM_NIGHT
+    T(DISARMED, NONE),		// EVENT_DISARM
+    T(DISARMED, NONE),		// EVENT_SENSOR_SECURE
+    T(DISARMED, NONE),		// EVENT_SENSOR_PERIMETER
+    T(SOUNDING, SOUND),		// EVENT_SENSOR_ALWAYS
+    T(SOUNDING, SOUND_PEER),	// EVENT_PEER_ALARM
+    T(DISARMED, NONE),		// EVENT_RESET
+    T(DISARMED, NONE),		// EVENT_TIMEOUT
+  },
+  // STATE_EXIT_DELAY : we're on our way out, so sensors don't count
+  {
+    T(EXIT_DELAY, NONE),
+    T(NIGHT, NONE),
+    T(DISARMED, NONE),
+    T(EXIT_DELAY, NONE),
+    T(EXIT_DELAY, NONE),
+    T(SOUNDING, SOUND),
+    T(SOUNDING, SOUND_PEER),
+    T(EXIT_DELAY, NONE),
+    T(ARMED, NONE),
+  },
+  // STATE_ARMED
+  {
+    T(ARMED, NONE),
+    T(NIGHT, NONE),
+    T(DISARMED, NONE),
+    T(ENTRY_DELAY, ENTRY),
+    T(ENTRY_DELAY, ENTRY),
+    T(SOUNDING, SOUND),
+    T(SOUNDING, SOUND_PEER),
+    T(ARMED, NONE),
+    T(ARMED, NONE),
+  },
+  // STATE_NIGHT : we're inside, so only the perimeter counts, and there's no delay
+  {
+    T(EXIT_DELAY, EXIT),
+    T(NIGHT, NONE),
+    T(DISARMED, NONE),
+    T(NIGHT, NONE),
+    T(SOUNDING, SOUND),
+    T(SOUNDING, SOUND),
+    T(SOUNDING, SOUND_PEER),
+    T(NIGHT, NONE),
+    T(NIGHT, NONE),
+  },
+  // STATE_ENTRY_DELAY : only disarming stops it
+  {
+    T(ENTRY_DELAY, NONE),
+    T(ENTRY_DELAY, NONE),
+    T(DISARMED, NONE),
+    T(ENTRY_DELAY, NONE),
+    T(ENTRY_DELAY, NONE),
+    T(SOUNDING, SOUND),
+    T(SOUNDING, SOUND_PEER),
+    T(ENTRY_DELAY, NONE),
+    T(SOUNDING, SOUND),
+  },
+  // STATE_SOUNDING : a reset goes back to how we were armed
+  {
+    T(SOUNDING, NONE),
+    T(SOUNDING, NONE),
+    T(DISARMED, NONE),
+    T(SOUNDING, NONE),
+    T(SOUNDING, NONE),
+    T(SOUNDING, NONE),
+    T(SOUNDING, NONE),
+    T(RESUME, NONE),
+    T(SOUNDING, NONE),
+  },
+};
+
+#undef	T
+
+/*
+ * Handle an event : move *state, and *armed with it, except while there's an alarm.
+ * Returns what the caller should do (an AlarmAction).
+ */
+static inline uint8_t AlarmStep(AlarmState *state, AlarmStatus *armed, AlarmEvent ev) {
+  const AlarmTransition *t = &alarm_transitions[*state][ev];
+
+  if (t->next == STATE_RESUME)
+    *state = (*armed == ALARM_ON) ? STATE_ARMED : (*armed == ALARM_NIGHT) ? STATE_NIGHT : STATE_DISARMED;
+  else
+    *state = (AlarmState)t->next;
+
+  switch (*state) {
+  case STATE_DISARMED:
+    *armed = ALARM_OFF;
+    break;
+  case STATE_EXIT_DELAY:
+  case STATE_ARMED:
+    *armed = ALARM_ON;
+    break;
+  case STATE_NIGHT:
+    *armed = ALARM_NIGHT;
+    break;
+  default:
+    break;
+  }
+  return t->action;
+}
+
+#endif	/* _ALARM_MACHINE_H_ */
@@ -0,0 +1,168 @@
+/*
+ * This module keeps the armed state in flash, so it survives a reboot
+ *
+ * Without it, a controller that reboots (OTA, watchdog, power) starts disarmed, until a peer
+ * tells it otherwise.
+ *
+ * Two flash sectors are used. Each change is written as a new 16 byte record in the next free
+ * slot, with a sequence number and a CRC. When a sector is full, the other one is erased and
+ * written next, so the newest record is never the one being erased. A write that didn't
+ * complete fails the CRC check, so the previous record is used instead.
+ *
+ * On ESP32 the sectors are a data partition called "alarm" (8K, see partitions.csv), on
+ * ESP8266 they're at PREF_ALARM_STORE_ADDR (see eagle.flash.4m.alarm.ld). Without those,
+ * there is only the EEPROM sector (the "eeprom" partition on ESP32), and a reset while it's
+ * erased (once per 256 changes) loses the state.
+ *
+ * Reading it back doesn't need WiFi or a file system, so it can be done first thing. That's
+ * before Serial.begin(), so what's wrong is kept for GetWarning().
+ *
+ * tools/store simulates power loss at every flash operation on a PC.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <AlarmStore.h>
+#include <preferences.h>
+#include <stddef.h>
+
+#if defined(ESP32)
+#include <esp_partition.h>
+#else
+extern "C" uint32_t _SPIFFS_end;
+#endif
+
+AlarmStore::AlarmStore() {
+  nsectors = 0;
+  cur = 0;
+  slot = -1;
+  seq = 0;
+  memset(&last, 0, sizeof(last));
+  warning = 0;
+
+#if defined(ESP32)
+  const esp_partition_t *p = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+    ESP_PARTITION_SUBTYPE_ANY, "alarm");
+  if (p == 0)
+    p = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "eeprom");
+  if (p) {
+    base = p->address / sector_size;
+    nsectors = p->size / sector_size;
+  }
+#else
+  base = ((uint32_t)&_SPIFFS_end - 0x40200000) / sector_size;	// The EEPROM sector
+  nsectors = 1;
+#if defined(PREF_ALARM_STORE_ADDR)
+  // Only if the linker script took them off SPIFFS : they're past the EEPROM sector then,
+  // and before the SDK's last four
+  if (PREF_ALARM_STORE_ADDR / sector_size > base
+      && PREF_ALARM_STORE_ADDR + 2 * sector_size <= ESP.getFlashChipSize() - 4 * sector_size) {
+    base = PREF_ALARM_STORE_ADDR / sector_size;
+    nsectors = 2;
+  }
+#endif
+#endif
+  if (nsectors > 2)
+    nsectors = 2;
+  if (nsectors == 0) {
+    warning = "no flash sector";
+    return;
+  }
+  if (nsectors == 1)
+    warning = "only one flash sector, a reset while it's erased loses the state";
+
+  // Find the newest valid record. Slots are used in order, so stop at the first free one.
+  AlarmStoreRecord r;
+  int used[2] = { -1, -1 };
+  for (int s = 0; s < nsectors; s++)
+    for (int i = 0; i < nslots && Read(s, i, &r) && r.seq != 0xFFFFFFFF; i++) {
+      used[s] = i;
+      if (r.crc == Crc(&r) && r.seq >= seq && r.armed <= ALARM_NIGHT) {
+        seq = r.seq;
+        last = r;
+        cur = s;
+      }
+    }
+  slot = used[cur];			// Carry on after the last one written there
+}
+
+/*
+ * CRC-32 (as in zlib), bit by bit : it's only a few bytes
+ */
+uint32_t AlarmStore::Crc(const AlarmStoreRecord *r) {
+  const uint8_t *p = (const uint8_t *)r;
+  uint32_t crc = 0xFFFFFFFF;
+
+  for (unsigned int i = 0; i < offsetof(AlarmStoreRecord, crc); i++) {
+    crc ^= p[i];
+    for (int b = 0; b < 8; b++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+boolean AlarmStore::Read(int s, int i, AlarmStoreRecord *r) {
+  return ESP.flashRead((base + s) * sector_size + i * sizeof(AlarmStoreRecord), (uint32_t *)r,
+    sizeof(AlarmStoreRecord));
+}
+
+/*
+ * Why the state may not survive a reboot, 0 if it will
+ */
+const char *AlarmStore::GetWarning() {
+  return warning;
+}
+
+/*
+ * What we had before the reboot, if anything
+ */
+boolean AlarmStore::Load(AlarmStatus *armed, time_t *epoch) {
+  if (seq == 0)
+    return false;
+  *armed = (AlarmStatus)last.armed;
+  *epoch = last.epoch;
+  return true;
+}
+
+void AlarmStore::Save(AlarmStatus armed, time_t epoch) {
+  if (nsectors == 0)
+    return;
+  if (seq != 0 && last.armed == armed)
+    return;				// Spare the flash
+
+  AlarmStoreRecord r;
+  memset(&r, 0xFF, sizeof(r));
+  r.seq = ++seq;
+  r.epoch = epoch;
+  r.armed = armed;
+  r.crc = Crc(&r);
+
+  // Full : go on in the other sector. The newest record stays where it is while that's erased.
+  slot++;
+  if (slot == nslots) {
+    cur = (cur + 1) % nsectors;
+    ESP.flashEraseSector(base + cur);
+    slot = 0;
+  }
+  if (! ESP.flashWrite((base + cur) * sector_size + slot * sizeof(AlarmStoreRecord), (uint32_t *)&r,
+      sizeof(r)))
+    Serial.printf("AlarmStore: could not write slot %d\n", slot);
+  last = r;
+}
@@ -0,0 +1,61 @@
+/*
+ * This module keeps the armed state in flash, so it survives a reboot
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_ALARM_STORE_H_
+#define	_ALARM_STORE_H_
+
+#include <Arduino.h>
+#include <AlarmMachine.h>
+
+struct AlarmStoreRecord {
+  uint32_t	seq;		// Erased flash reads 0xFFFFFFFF
+  uint32_t	epoch;		// time_t of the change, 0 if we didn't have the time
+  uint8_t	armed;		// AlarmStatus
+  uint8_t	reserved[3];
+  uint32_t	crc;		// Over the fields above
+};
+
+class AlarmStore {
+public:
+  AlarmStore();
+  boolean Load(AlarmStatus *armed, time_t *epoch);
+  void Save(AlarmStatus armed, time_t epoch);
+  const char *GetWarning();
+
+private:
+  uint32_t	base;		// First flash sector we use
+  int		nsectors;	// 2, or 1 if that's all we have, 0 if none
+  int		cur;		// Sector being written
+  int		slot;		// Last one written there, -1 if none
+  uint32_t	seq;
+  AlarmStoreRecord	last;
+  const char	*warning;	// From the constructor, which runs before Serial.begin()
+
+  static const int sector_size = 4096;
+  static const int nslots = sector_size / sizeof(AlarmStoreRecord);
+
+  static uint32_t Crc(const AlarmStoreRecord *r);
+  boolean Read(int sector, int slot, AlarmStoreRecord *r);
+};
+
+extern AlarmStore *alarmstore;
+#endif	/* _ALARM_STORE_H_ */
@@ -20,8 +20,19 @@
  *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+
 #include <Arduino.h>
 #include <BackLight.h>
+#include <preferences.h>
+
+#if defined(ESP32)
+#include <driver/ledc.h>
+#endif
+
+// Duty cycle (out of 1024) for 0, 5, .. 100 % of perceived brightness
+static const uint16_t gamma_table[] PROGMEM = {
+  0, 1, 6, 16, 30, 49, 72, 102, 136, 177, 223, 275, 333, 397, 467, 544, 627, 716, 812, 915, 1024
+};
 
 BackLight::BackLight(int pin) {
   channel = 0;
@@ -29,6 +40,10 @@ BackLight::BackLight(int pin) {
   freq = 5000;
   pwmrange = (uint16_t) exp2(resolution);
 
+  curve = PREF_BACKLIGHT_CURVE;
+  fade_ms = PREF_BACKLIGHT_FADE;
+  fading = false;
+
   SetBrightness(70);
   bright_low = 10;
   bright_high = 70;
@@ -41,17 +56,16 @@ BackLight::BackLight(int pin) {
 #if defined(ESP32)
   ledcSetup(channel, freq, resolution);
   ledcAttachPin(led_pin, channel);
+  ledc_fade_func_install(0);
+#else
+  analogWriteRange(pwmrange);
 #endif
 
   // Serial.printf("BackLight(pin %d)\n", led_pin);
 
   // Display off
   status = BACKLIGHT_NONE;
-#if defined(ESP32)
-  ledcWrite(channel, 0);
-#else
-  analogWrite(led_pin, 0);
-#endif
+  Write(0);
 }
 
 void BackLight::SetStatus(BackLightStatus ns) {
@@ -59,18 +73,10 @@ void BackLight::SetStatus(BackLightStatus ns) {
 
   if (status == BACKLIGHT_ON || status == BACKLIGHT_TEMP_ON) {
     // Serial.printf("BackLight::SetStatus %d\n", brightness);
-#ifdef ESP32
-    ledcWrite(channel, brightness);
-#else
-    analogWrite(led_pin, percentage);
-#endif
+    Write(brightness);
   } else if (status == BACKLIGHT_NONE || status == BACKLIGHT_TEMP_OFF) {
     // Serial.printf("BackLight::SetStatus %d\n", 0);
-#ifdef ESP32
-    ledcWrite(channel, 0);
-#else
-    analogWrite(led_pin, 0);
-#endif
+    Write(0);
   }
 
   if (status == BACKLIGHT_TEMP_ON || status == BACKLIGHT_TEMP_OFF)
@@ -79,21 +85,26 @@ void BackLight::SetStatus(BackLightStatus ns) {
 
 void BackLight::SetBrightness(int pctage) {
   percentage = pctage;
-  brightness = percentage * pwmrange / 100;
+  brightness = Duty(percentage);
 
   // Serial.printf("BackLight %d %%\n", percentage);
 }
 
+/*
+ * How long dimming takes, and how the percentages map onto the duty cycle
+ */
+void BackLight::SetFade(uint32_t ms, BackLightCurve c) {
+  fade_ms = ms;
+  curve = c;
+  SetBrightness(percentage);
+}
+
 void BackLight::Trigger(time_t ts) {
   if (status == BACKLIGHT_TEMP_OFF) {
     status = BACKLIGHT_TEMP_ON;		// Change status, keep track of time, light on
     trigger_ts = ts;
 
-#ifdef ESP32
-    ledcWrite(channel, brightness);
-#else
-    analogWrite(led_pin, percentage);
-#endif
+    Write(brightness);
   } else if (status == BACKLIGHT_TEMP_ON) {
     trigger_ts = ts;			// Only update our time
   } else {
@@ -106,37 +117,18 @@ void BackLight::SetTimeout(int s) {
 }
 
 /*
- * Loop function : deal with timeout, and slowly dimming the backlight.
+ * Loop function : deal with timeout. Dimming the backlight happens by itself.
  */
 void BackLight::loop(time_t nowts) {
   if (status == BACKLIGHT_TEMP_ON) {
     if (trigger_ts + timeout < nowts) {
-#ifdef ESP32
-      ledcWrite(channel, 0);
-#else
-      analogWrite(led_pin, 0);
-#endif
       status = BACKLIGHT_TEMP_CHANGING;
       trigger_ts = 0;
-      slow = 0;
-    }
-  }
-  if (status == BACKLIGHT_TEMP_CHANGING) {		// Slowly go to bright_low
-    if (percentage <= bright_low)
-      status = BACKLIGHT_TEMP_OFF;			// We've reached it
-    else {
-      slow = (slow + 1) % 10;				// FIXME hardcoded factor
-      if (slow == 0)
-        percentage--;					// Slow this down ?
-      SetBrightness(percentage);
-
-#ifdef ESP32
-      ledcWrite(channel, brightness);
-#else
-      analogWrite(led_pin, percentage);
-#endif
+      Fade(bright_low);
     }
   }
+  if (status == BACKLIGHT_TEMP_CHANGING && ! fading)
+    status = BACKLIGHT_TEMP_OFF;			// We've reached bright_low
 }
 
 void BackLight::touched(time_t nowts) {
@@ -146,12 +138,96 @@ void BackLight::touched(time_t nowts) {
   if (status == BACKLIGHT_TEMP_OFF || status == BACKLIGHT_TEMP_CHANGING)
     status = BACKLIGHT_TEMP_ON;
   if (status == BACKLIGHT_TEMP_ON) {
+    // Stop the fade first : a step in between would overwrite the brightness we set
+    fade_timer.detach();
+    fading = false;
     SetBrightness(bright_high);
+    Write(brightness);
+  }
+}
+
+/*
+ * Any touch keeps the display lit
+ */
+void BackLight::Touched(void *pw, const TouchEvent *ev) {
+  ((BackLight *)pw)->touched(ev->ts);
+}
+
+uint32_t BackLight::Duty(int pct) {
+  if (pct <= 0)
+    return 0;
+  if (pct >= 100)
+    return pwmrange;
+  if (curve == FADE_LINEAR)
+    return pct * pwmrange / 100;
+
+  // Interpolate between the 5 % steps of the table
+  uint32_t lo = pgm_read_word(&gamma_table[pct / 5]),
+	   hi = pgm_read_word(&gamma_table[pct / 5 + 1]);
+  return ((lo * (5 - pct % 5) + hi * (pct % 5)) * pwmrange / 5) >> 10;
+}
+
+/*
+ * Set the LED right away, ending a fade that may be going on
+ */
+void BackLight::Write(uint32_t duty) {
+  fade_timer.detach();
+  fading = false;
+
+#ifdef ESP32
+  ledcWrite(channel, duty);
+#else
+  analogWrite(led_pin, duty);
+#endif
+}
+
+/*
+ * Go from the current percentage to another one in fade_ms, without the main loop's help.
+ *
+ * The ESP32 LEDC does a linear fade in hardware, so the timer only has to start a few of them
+ * to follow a curve. The ESP8266 has no such thing, its timer sets the duty cycle every
+ * PREF_BACKLIGHT_STEP ms.
+ */
+void BackLight::Fade(int to) {
+  fade_timer.detach();
 
+  fade_from = percentage;
+  fade_to = to;
 #ifdef ESP32
-    ledcWrite(channel, brightness);
+  fade_steps = (curve == FADE_LINEAR) ? 1 : fade_segments;
 #else
-    analogWrite(led_pin, percentage);
+  fade_steps = fade_ms / PREF_BACKLIGHT_STEP;
 #endif
+  if (fade_steps < 1)
+    fade_steps = 1;
+  fade_step_ms = fade_ms / fade_steps;
+  if (fade_step_ms < 1)
+    fade_step_ms = 1;
+  fade_step = 0;
+  fading = true;
+
+  FadeStep(this);
+  fade_timer.attach_ms(fade_step_ms, FadeStep, this);
+}
+
+/*
+ * Timer callback : the next step of a fade, or the end of it
+ */
+void BackLight::FadeStep(BackLight *bl) {
+  if (bl->fade_step == bl->fade_steps) {
+    bl->fade_timer.detach();
+    bl->fading = false;
+    return;
   }
+
+  bl->fade_step++;
+  bl->SetBrightness(bl->fade_from + (bl->fade_to - bl->fade_from) * bl->fade_step / bl->fade_steps);
+
+#ifdef ESP32
+  ledc_set_fade_with_time(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)bl->channel, bl->brightness,
+    bl->fade_step_ms);
+  ledc_fade_start(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)bl->channel, LEDC_FADE_NO_WAIT);
+#else
+  analogWrite(bl->led_pin, bl->brightness);
+#endif
 }
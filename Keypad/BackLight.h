@@ -24,6 +24,8 @@
 #define	_BACKLIGHT_H_
 
 #include "TimeLib.h"
+#include "Touch.h"
+#include <Ticker.h>
 
 enum BackLightStatus {
   BACKLIGHT_NONE,	// Out, not initialized
@@ -33,6 +35,11 @@ enum BackLightStatus {
   BACKLIGHT_TEMP_CHANGING,	// Slowly dim backlight
 };
 
+enum BackLightCurve {
+  FADE_LINEAR,		// Duty cycle proportional to the percentage
+  FADE_GAMMA,		// Percentage of perceived brightness (gamma 2.2)
+};
+
 class BackLight {
 public:
   BackLight(int pin);
@@ -41,7 +48,9 @@ public:
   void Trigger(time_t);
   void SetTimeout(int);
   void SetBrightness(int percentage);
+  void SetFade(uint32_t ms, BackLightCurve curve);
   void touched(time_t);
+  static void Touched(void *pw, const TouchEvent *ev);
 
 private:
   time_t trigger_ts;
@@ -50,10 +59,24 @@ private:
   int led_pin;
   int brightness, percentage;	// Current brightness
   int bright_low, bright_high;	// brightness for passive and active states
-  int timeout,			// number of seconds for backlight to stay lit
-      slow;			// Counter to slow down dimming
+  int timeout;			// number of seconds for backlight to stay lit
 
   uint16_t pwmrange, resolution, channel, freq;
+
+  // Fading happens in the background, in steps started by a timer
+  BackLightCurve curve;
+  uint32_t fade_ms;		// Duration
+  Ticker fade_timer;
+  int fade_from, fade_to, fade_steps;
+  uint32_t fade_step_ms;
+  volatile int fade_step;
+  volatile boolean fading;
+  static const int fade_segments = 8;	// ESP32, for curves
+
+  uint32_t Duty(int percentage);
+  void Write(uint32_t duty);
+  void Fade(int to);
+  static void FadeStep(BackLight *bl);
 };
 
 extern BackLight *backlight;
@@ -33,7 +33,7 @@ extern "C" {
 
 #include <preferences.h>
 
-Clock::Clock(Oled *oled) {
+Clock::Clock(Oled *oled) : OledWidget(0, 0, 0, 0) {
   this->oled = oled;
   hr = min = sec = 0;
   counter = 0;
@@ -53,7 +53,7 @@ Clock::Clock(Oled *oled) {
 
   // Specify default clock
   for (int i=0; i<PREF_CLOCK_NB; i++) {
-    first[i] = 1;
+    field[i] = -1;
     format[i] = 0;
     tposx[i] = 0;
     tposy[i] = 0;
@@ -156,31 +156,71 @@ void Clock::timeString(char *buffer, int len) {
   timeString(now, buffer, len);
 }
 
-void Clock::draw() {
+/*
+ * As a widget : the text fields only send what changed, so a full redraw is the same thing
+ * as an update, and erasing is showing empty strings.
+ */
+void Clock::redraw(Oled *) {
+  draw();
+}
+
+void Clock::erase(Oled *) {
   if (oled == 0)
+    return;
+  for (int i=0; i<PREF_CLOCK_NB; i++)
+    if (field[i] >= 0)
+      oled->setText(field[i], "");
+  oled->flush();
+}
+
+void Clock::draw() {
+  if (oled == 0 || ! visible)
     return;
 				// Serial.printf("Clock draw(");
   for (int i=0; i<PREF_CLOCK_NB; i++)
     if (format[i] != 0 && format[i][0] != 0) { 
-      oled->fontSize(font[i]);
-
-      if (first[i] == 0) {
-        oled->setTextColor(ILI9341_BLACK);
-        oled->drawString(buffer[i], tposx[i], tposy[i]);
-        oled->setTextColor(ILI9341_WHITE);
+      if (field[i] < 0) {
+        field[i] = oled->addTextField(tposx[i], tposy[i], font[i]);
+#ifdef	PREF_CLOCK_SPRITES
+	char chars[16];
+	if (SpriteChars(format[i], chars, sizeof(chars)))
+	  oled->addSprites(field[i], chars);
+#endif
       }
-      first[i] = 0;
 
       struct tm *ptm = localtime(&the_time);
       strftime(buffer[i], sizeof(buffer[i]), format[i], ptm);
 
 				// Serial.printf("%d %s,", i, buffer[i]);
 
-      oled->setTextSize(1);
-      oled->drawString(buffer[i], tposx[i], tposy[i]);
+      oled->setText(field[i], buffer[i]);
     }
   				// Serial.printf(")\n");
-    oled->fontSize(1);
+  oled->flush();			// Only sends what changed
+}
+
+/*
+ * Which characters can this format produce ? Only for formats with numbers and fixed text,
+ * there's no point in pre-rendering month and day names.
+ */
+bool Clock::SpriteChars(const char *format, char *chars, int len) {
+  strcpy(chars, "0123456789");
+  int n = strlen(chars);
+
+  for (const char *p = format; *p; p++) {
+    if (*p == '%') {
+      if (*++p == 0 || strchr("HMSdmyYIje", *p) == 0)
+        return false;
+      continue;
+    }
+    if (strchr(chars, *p) == 0) {
+      if (n == len - 1)
+        return false;
+      chars[n++] = *p;
+      chars[n] = 0;
+    }
+  }
+  return true;
 }
 
 bool Clock::IsDST(int day, int month, int dow, int hr) {
@@ -21,6 +21,7 @@
  */
 
 #include <Oled.h>
+#include <Widget.h>
 #include <preferences.h>
 
 #ifndef _CLOCK_H_
@@ -32,10 +33,12 @@ enum DstHandled {
   DST_OK
 };
 
-class Clock {
+class Clock : public OledWidget {
 public:
   Clock(Oled *);
   void loop(time_t);
+  void redraw(Oled *);
+  void erase(Oled *);
   void timeString(char *, int);
   void timeString(time_t, char *, int);
 
@@ -44,10 +47,11 @@ protected:
 private:
   Oled		*oled;
   void		draw(void);
+  static bool	SpriteChars(const char *format, char *chars, int len);
   char		hr, min, sec;
 
   // Stuff that is duplicated, one per displayed zone
-  int		first[PREF_CLOCK_NB];
+  int		field[PREF_CLOCK_NB];		// Oled text field, -1 until there is one
   char		buffer[PREF_CLOCK_NB][32];
   char		*format[PREF_CLOCK_NB];		// Description of the content
   int		font[PREF_CLOCK_NB];		// Font
@@ -48,6 +48,7 @@ Config::Config() {
   radio_pin = -1;
   siren_pin = -1;
   oled = false;
+  touch_irq_pin = -1;
   rfid = false;
   rfidType = 0;
   secure = false;
@@ -117,6 +118,7 @@ void Config::ParseConfig(JsonObject &jo) {
   radio_pin = jo["radioPin"] | -1;
   oled = jo["haveOled"] | false;
   oled_led_pin = jo["oledLedPin"] | -1;
+  touch_irq_pin = jo["touchIrqPin"] | -1;
   i2c_sda_pin = jo["i2cSdaPin"] | -1;
   i2c_scl_pin = jo["i2cSclPin"] | -1;
 
@@ -196,6 +198,10 @@ int Config::GetOledLedPin() {
   return oled_led_pin;
 }
 
+int Config::GetTouchIrqPin() {
+  return touch_irq_pin;
+}
+
 boolean Config::haveRadio() {
   return (radio_pin >= 0);
 }
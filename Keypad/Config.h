@@ -49,6 +49,7 @@ public:
   const char *myName();
   boolean haveRadio();
   int GetOledLedPin();
+  int GetTouchIrqPin();
   boolean haveWeather();
 
   boolean haveSecure();
@@ -71,6 +72,7 @@ private:
   boolean oled;
   const char *name;
   int oled_led_pin;
+  int touch_irq_pin;		// XPT2046 T_IRQ, -1 to poll
 
   boolean rfid;
   boolean weather;
@@ -0,0 +1,429 @@
+/*
+ * This module decodes a GIF while it is being downloaded
+ *
+ * Rather than buffering the whole file and then running libnsgif over it (which needs
+ * the file, a 4 byte per pixel bitmap, and an RGB565 copy of that), network chunks are
+ * passed to Feed() as they arrive. A small input window holds what the parser hasn't
+ * consumed yet, the LZW decoder reads sub-blocks from there into a row of palette
+ * indices, and each completed row is converted into the caller's RGB565 canvas.
+ *
+ * Frames of an animated GIF are painted over each other (transparent pixels are left
+ * alone), so the result is the last frame, same as before. Disposal methods are ignored,
+ * LoadGif has libnsgif play animations afterwards.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <GifStream.h>
+#include <Pixels.h>
+
+// Interlaced images come in four passes
+static const uint8_t pass_start[4] = { 0, 4, 2, 1 };
+static const uint8_t pass_step[4] = { 8, 8, 4, 2 };
+
+static inline uint16_t Rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+GifStream::GifStream(GifCanvasCallback canvas, GifRowCallback row, void *pw) {
+  canvas_cb = canvas;
+  row_cb = row;
+  this->pw = pw;
+
+  rpos = wpos = 0;
+  state = GS_HEADER;
+  row_budget = 0;
+  paused = false;
+
+  this->canvas = 0;
+  width = height = 0;
+  frames = 0;
+  looping = false;
+
+  memset(global, 0, sizeof(global));
+  palette = global;
+  ct_size = ct_index = 0;
+
+  transparent = false;
+  transparent_index = 0;
+
+  lzw = 0;
+  indices = 0;
+}
+
+GifStream::~GifStream() {
+  if (lzw)
+    lzw_context_destroy(lzw);
+  lzw = 0;
+  free(indices);
+  indices = 0;
+}
+
+/*
+ * Limit the work done in one Feed() call. When the budget is used up, Paused() is true,
+ * and Feed() should be called again (possibly with no new data) to continue.
+ */
+void GifStream::SetRowBudget(int rows) {
+  row_budget = rows;
+}
+
+boolean GifStream::Paused() {
+  return paused;
+}
+
+boolean GifStream::Done() {
+  return state == GS_DONE;
+}
+
+boolean GifStream::Failed() {
+  return state == GS_ERROR;
+}
+
+int GifStream::Frames() {
+  return frames;
+}
+
+boolean GifStream::Started() {
+  return frames > 0 || state >= GS_IMAGE_DESC;
+}
+
+boolean GifStream::Looping() {
+  return looping;
+}
+
+int GifStream::Available() {
+  return wpos - rpos;
+}
+
+/*
+ * Take (part of) a chunk of input, and decode as far as we can.
+ * Returns the number of bytes taken, the caller should offer the rest again.
+ * Returns -1 on error.
+ */
+int GifStream::Feed(const uint8_t *data, int len) {
+  if (state == GS_ERROR)
+    return -1;
+  if (state == GS_DONE)
+    return len;			// Ignore anything after the trailer
+
+  // Make room
+  if (rpos > 0 && wpos + len > bufsize) {
+    memmove(inbuf, inbuf + rpos, wpos - rpos);
+    wpos -= rpos;
+    rpos = 0;
+  }
+
+  int nb = bufsize - wpos;
+  if (nb > len)
+    nb = len;
+  memcpy(inbuf + wpos, data, nb);
+  wpos += nb;
+
+  Parse();
+
+  if (state == GS_ERROR)
+    return -1;
+  return nb;
+}
+
+/*
+ * Run the state machine until it runs out of input, or the row budget
+ */
+void GifStream::Parse() {
+  uint8_t *p;
+  int flags;
+
+  rows_left = row_budget;
+  paused = false;
+
+  for (;;) {
+    p = inbuf + rpos;
+
+    switch (state) {
+    case GS_HEADER:
+      if (Available() < 13)
+        return;
+      if (strncmp((const char *)p, "GIF87a", 6) != 0 && strncmp((const char *)p, "GIF89a", 6) != 0) {
+        Serial.printf("GifStream: not a GIF\n");
+	state = GS_ERROR;
+	return;
+      }
+      width = p[6] | (p[7] << 8);
+      height = p[8] | (p[9] << 8);
+      flags = p[10];
+      rpos += 13;
+
+      canvas = canvas_cb(pw, width, height);
+      if (canvas == 0) {
+        state = GS_ERROR;
+	return;
+      }
+      memset(canvas, 0, width * height * 2);
+
+      if (flags & 0x80) {
+        ct_size = 2 << (flags & 0x07);
+	ct_index = 0;
+	state = GS_GLOBAL_CT;
+      } else
+        state = GS_BLOCK;
+      break;
+
+    case GS_GLOBAL_CT:
+      ColourTable(global);
+      if (ct_index < ct_size)
+        return;
+      state = GS_BLOCK;
+      break;
+
+    case GS_BLOCK:
+      if (Available() < 1)
+        return;
+      rpos++;
+      switch (p[0]) {
+      case 0x21:
+        state = GS_EXT_LABEL;
+	break;
+      case 0x2C:
+        state = GS_IMAGE_DESC;
+	break;
+      case 0x3B:			// Trailer
+        state = GS_DONE;
+	return;
+      default:				// Garbage, keep what we have if anything
+        state = frames ? GS_DONE : GS_ERROR;
+	return;
+      }
+      break;
+
+    case GS_EXT_LABEL:
+      if (Available() < 1)
+        return;
+      ext_label = p[0];
+      ext_first = true;
+      rpos++;
+      state = GS_SUBBLOCKS;
+      break;
+
+    case GS_SUBBLOCKS:		// Extension data, or image data we no longer need
+      if (Available() < 1 || Available() < 1 + p[0])
+        return;
+      if (p[0] == 0) {
+        rpos++;
+	state = GS_BLOCK;
+	break;
+      }
+      if (ext_label == 0xF9 && ext_first && p[0] >= 4) {	// Graphic Control Extension
+        transparent = (p[1] & 0x01) != 0;
+	transparent_index = p[4];
+      }
+      if (ext_label == 0xFF && ext_first && p[0] == 11
+          && (memcmp(p + 1, "NETSCAPE2.0", 11) == 0 || memcmp(p + 1, "ANIMEXTS1.0", 11) == 0))
+        looping = true;
+      ext_first = false;
+      rpos += 1 + p[0];
+      break;
+
+    case GS_IMAGE_DESC:
+      if (row_budget && rows_left <= 0) {
+        paused = true;			// Budget used up by the previous image
+	return;
+      }
+      if (Available() < 9)
+        return;
+      fx = p[0] | (p[1] << 8);
+      fy = p[2] | (p[3] << 8);
+      fw = p[4] | (p[5] << 8);
+      fh = p[6] | (p[7] << 8);
+      flags = p[8];
+      rpos += 9;
+
+      if (fw == 0 || fh == 0 || fx + fw > width || fy + fh > height) {
+        Serial.printf("GifStream: frame (%d,%d) %d x %d outside of image\n", fx, fy, fw, fh);
+	state = GS_ERROR;
+	return;
+      }
+      interlaced = (flags & 0x40) != 0;
+
+      if (flags & 0x80) {
+        ct_size = 2 << (flags & 0x07);
+	ct_index = 0;
+	memset(local, 0, sizeof(local));
+	palette = local;
+	state = GS_LOCAL_CT;
+      } else {
+        palette = global;
+	state = GS_LZW_MIN;
+      }
+      break;
+
+    case GS_LOCAL_CT:
+      ColourTable(local);
+      if (ct_index < ct_size)
+        return;
+      state = GS_LZW_MIN;
+      break;
+
+    case GS_LZW_MIN:
+      if (Available() < 1)
+        return;
+      min_code_size = p[0];
+      rpos++;
+      if (min_code_size >= LZW_CODE_MAX) {
+        state = GS_ERROR;
+	return;
+      }
+      StartImage();
+      break;
+
+    case GS_IMAGE_DATA:
+      DecodeImage();
+      if (state == GS_IMAGE_DATA)
+        return;			// Need more input, or out of budget
+      break;
+
+    case GS_DONE:
+    case GS_ERROR:
+      return;
+    }
+  }
+}
+
+/*
+ * Convert as many colour table entries as we have complete triplets for
+ */
+void GifStream::ColourTable(uint16_t *table) {
+  while (ct_index < ct_size && Available() >= 3) {
+    uint8_t *p = inbuf + rpos;
+    table[ct_index++] = Rgb565(p[0], p[1], p[2]);
+    rpos += 3;
+  }
+}
+
+void GifStream::StartImage() {
+  if (lzw == 0 && lzw_context_create(&lzw) != LZW_OK) {
+    Serial.printf("GifStream: no memory for LZW\n");
+    state = GS_ERROR;
+    return;
+  }
+  free(indices);
+  indices = (uint8_t *)malloc(fw);
+  if (indices == 0) {
+    Serial.printf("GifStream: no memory for a row\n");
+    state = GS_ERROR;
+    return;
+  }
+  lzw_decode_init_stream(lzw, ReadBlock, this, min_code_size);
+
+  col = rows_done = 0;
+  pass = 0;
+  row = 0;
+  line = canvas + fy * width + fx;
+
+  state = GS_IMAGE_DATA;
+}
+
+/*
+ * Called by the LZW decoder to get the next sub-block, only if all of it is here.
+ */
+int GifStream::ReadBlock(void *pw, uint8_t *buf) {
+  GifStream *gs = (GifStream *)pw;
+
+  if (gs->Available() < 1)
+    return -1;
+
+  int n = gs->inbuf[gs->rpos];
+  if (gs->Available() < 1 + n)
+    return -1;
+
+  memcpy(buf, gs->inbuf + gs->rpos + 1, n);
+  gs->rpos += 1 + n;
+  return n;
+}
+
+void GifStream::DecodeImage() {
+  lzw_result res;
+  uint32_t nb;
+
+  while (rows_done < fh) {
+    res = lzw_decode_buffer(lzw, indices + col, fw - col, &nb);
+    col += nb;
+    if (col == fw) {
+      NextRow();
+      if (row_budget && --rows_left <= 0 && res == LZW_OK) {
+        paused = true;
+	return;
+      }
+    }
+
+    if (res == LZW_OK)
+      continue;
+    if (res == LZW_NO_DATA)
+      return;			// Wait for more input
+
+    // End of the image data, keep what we have
+    EndImage();
+    if (res == LZW_OK_EOD) {		// Terminator has been read
+      state = GS_BLOCK;
+    } else {
+      if (res != LZW_EOI_CODE)
+        Serial.printf("GifStream: LZW error %d at row %d\n", res, rows_done);
+      state = GS_SUBBLOCKS;
+      ext_label = 0;
+    }
+    return;
+  }
+
+  // Done, skip what's left of the image data
+  EndImage();
+  state = GS_SUBBLOCKS;
+  ext_label = 0;
+}
+
+/*
+ * A row of indices is complete, put it in the canvas
+ */
+void GifStream::NextRow() {
+  if (! transparent)
+    pixels_palette_to_565(line, indices, fw, palette);
+  else
+    for (int i = 0; i < fw; i++)
+      if (indices[i] != transparent_index)
+        line[i] = palette[indices[i]];
+
+  if (row_cb)
+    row_cb(pw, fx, fy + row, fw);
+
+  col = 0;
+  rows_done++;
+  if (interlaced) {
+    row += pass_step[pass];
+    while (row >= fh && pass < 3) {
+      pass++;
+      row = pass_start[pass];
+    }
+  } else
+    row++;
+  line = canvas + (fy + row) * width + fx;
+}
+
+void GifStream::EndImage() {
+  frames++;
+  transparent = false;		// Graphic Control Extension only applies to one image
+}
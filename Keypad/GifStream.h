@@ -0,0 +1,113 @@
+/*
+ * This module decodes a GIF while it is being downloaded
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_GIF_STREAM_H_
+#define	_GIF_STREAM_H_
+
+#include <Arduino.h>
+#include "lzw.h"
+
+// Allocate the RGB565 output (width * height pixels), return NULL to refuse the image
+typedef uint16_t *(*GifCanvasCallback)(void *pw, uint16_t width, uint16_t height);
+// A row of the output has been completed
+typedef void (*GifRowCallback)(void *pw, uint16_t x, uint16_t y, uint16_t width);
+
+enum GifStreamState {
+  GS_HEADER,
+  GS_GLOBAL_CT,
+  GS_BLOCK,
+  GS_EXT_LABEL,
+  GS_SUBBLOCKS,
+  GS_IMAGE_DESC,
+  GS_LOCAL_CT,
+  GS_LZW_MIN,
+  GS_IMAGE_DATA,
+  GS_DONE,
+  GS_ERROR
+};
+
+class GifStream {
+public:
+  GifStream(GifCanvasCallback canvas, GifRowCallback row, void *pw);
+  ~GifStream();
+
+  int Feed(const uint8_t *data, int len);
+  void SetRowBudget(int rows);
+
+  boolean Paused();
+  boolean Done();
+  boolean Failed();
+  int Frames();
+  boolean Started();		// The first image has begun
+  boolean Looping();		// There was a loop extension, so it's an animation
+
+private:
+  static const int	bufsize = 512;	// At least two maximal sub-blocks
+  uint8_t		inbuf[bufsize];
+  int			rpos, wpos;
+
+  GifStreamState	state;
+  int			row_budget;	// Rows to decode per Feed() call, 0 is no limit
+  int			rows_left;
+  boolean		paused;		// Stopped on the row budget, not for lack of input
+  GifCanvasCallback	canvas_cb;
+  GifRowCallback	row_cb;
+  void			*pw;
+
+  uint16_t		*canvas;
+  uint16_t		width, height;
+  int			frames;
+  boolean		looping;
+
+  // Colour tables, converted to RGB565 as they come in
+  uint16_t		global[256], local[256];
+  uint16_t		*palette;
+  int			ct_size, ct_index;
+
+  // From the Graphic Control Extension, valid for the next image only
+  uint8_t		ext_label;
+  boolean		ext_first;
+  boolean		transparent;
+  uint8_t		transparent_index;
+
+  // Current image
+  uint16_t		fx, fy, fw, fh;
+  boolean		interlaced;
+  uint8_t		min_code_size;
+  uint16_t		col, row, rows_done;
+  uint8_t		pass;
+  uint16_t		*line;
+
+  struct lzw_ctx	*lzw;
+  uint8_t		*indices;	// One row of the current image
+
+  int Available();
+  void Parse();
+  void ColourTable(uint16_t *table);
+  void StartImage();
+  void DecodeImage();
+  void EndImage();
+  void NextRow();
+  static int ReadBlock(void *pw, uint8_t *buf);
+};
+
+#endif	/* _GIF_STREAM_H_ */
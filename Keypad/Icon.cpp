@@ -0,0 +1,156 @@
+/*
+ * Packed weather icons : an RGB565 palette and 4 or 8 bit pixels
+ *
+ * Weather icons are GIFs, so they have at most 256 colours, mostly a lot less. Keeping
+ * them as palette indices takes half (8 bit) or a quarter (4 bit, up to 16 colours) of
+ * the memory that RGB565 does, and the same goes for the transfer to peers.
+ * Oled::drawIcon() looks up the palette while sending the pixels.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <Icon.h>
+
+static const int	hash_size = 512;	// Power of two, twice the maximum palette size
+
+static inline int Hash(uint16_t c) {
+  return ((c * 40503u) >> 7) & (hash_size - 1);
+}
+
+/*
+ * Find colour c in the hash table, add it to the palette if it's not there yet.
+ * Table entries are palette index + 1, zero means empty.
+ * Returns the palette index, or -1 if the palette is full.
+ */
+static int Lookup(uint16_t *table, uint16_t *palette, uint16_t *colours, uint16_t c) {
+  int h = Hash(c);
+
+  while (table[h]) {
+    if (palette[table[h] - 1] == c)
+      return table[h] - 1;
+    h = (h + 1) & (hash_size - 1);
+  }
+
+  if (*colours == 256)
+    return -1;
+  palette[*colours] = c;
+  table[h] = ++*colours;
+  return *colours - 1;
+}
+
+int Icon::Size(uint16_t width, uint16_t height, uint16_t colours, uint8_t bpp) {
+  int n = width * height;
+  return sizeof(IconHeader) + colours * 2 + (bpp == 4 ? (n + 1) / 2 : n * bpp / 8);
+}
+
+/*
+ * Convert RGB565 pixels into a packed icon, allocated here. The caller keeps pixels.
+ */
+uint8_t *Icon::Pack(const uint16_t *pixels, uint16_t width, uint16_t height) {
+  int		n = width * height;
+  uint16_t	palette[256], colours = 0;
+  uint8_t	bpp;
+
+  uint16_t *table = (uint16_t *)calloc(hash_size, sizeof(uint16_t));
+  if (table == 0)
+    return 0;
+
+  int i;
+  for (i = 0; i < n; i++)
+    if (Lookup(table, palette, &colours, pixels[i]) < 0)
+      break;
+  if (i < n)
+    colours = 0;				// More than 256, no palette
+  bpp = (colours == 0) ? 16 : (colours <= 16) ? 4 : 8;
+
+  int nb = Size(width, height, colours, bpp);
+  uint8_t *icon = (uint8_t *)malloc(nb);
+  if (icon == 0) {
+    Serial.printf("Icon: malloc(%d) failed\n", nb);
+    free(table);
+    return 0;
+  }
+
+  IconHeader *hdr = (IconHeader *)icon;
+  hdr->width = width;
+  hdr->height = height;
+  hdr->colours = colours;
+  hdr->bpp = bpp;
+  hdr->reserved = 0;
+  memcpy(icon + sizeof(IconHeader), palette, colours * 2);
+
+  uint8_t *p = icon + sizeof(IconHeader) + colours * 2;
+  if (bpp == 16) {
+    memcpy(p, pixels, n * 2);
+  } else if (bpp == 8) {
+    for (int i = 0; i < n; i++)
+      p[i] = Lookup(table, palette, &colours, pixels[i]);
+  } else {
+    for (int i = 0; i < n; i += 2) {
+      uint8_t b = Lookup(table, palette, &colours, pixels[i]) << 4;
+      if (i + 1 < n)
+        b |= Lookup(table, palette, &colours, pixels[i + 1]);
+      *p++ = b;
+    }
+  }
+
+  free(table);
+  return icon;
+}
+
+/*
+ * Check something that came from a file or a peer
+ */
+boolean Icon::Valid(const uint8_t *icon, int len) {
+  if (icon == 0 || len < (int)sizeof(IconHeader))
+    return false;
+
+  const IconHeader *hdr = (const IconHeader *)icon;
+  if (hdr->bpp == 16 && hdr->colours != 0)
+    return false;
+  if (hdr->bpp == 8 && (hdr->colours == 0 || hdr->colours > 256))
+    return false;
+  if (hdr->bpp == 4 && (hdr->colours == 0 || hdr->colours > 16))
+    return false;
+  if (hdr->bpp != 4 && hdr->bpp != 8 && hdr->bpp != 16)
+    return false;
+  return len == Size(icon);
+}
+
+uint16_t Icon::Width(const uint8_t *icon) {
+  return ((const IconHeader *)icon)->width;
+}
+
+uint16_t Icon::Height(const uint8_t *icon) {
+  return ((const IconHeader *)icon)->height;
+}
+
+int Icon::Size(const uint8_t *icon) {
+  const IconHeader *hdr = (const IconHeader *)icon;
+  return Size(hdr->width, hdr->height, hdr->colours, hdr->bpp);
+}
+
+const uint16_t *Icon::Palette(const uint8_t *icon) {
+  return (const uint16_t *)(icon + sizeof(IconHeader));
+}
+
+const uint8_t *Icon::Pixels(const uint8_t *icon) {
+  return icon + sizeof(IconHeader) + ((const IconHeader *)icon)->colours * 2;
+}
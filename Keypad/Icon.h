@@ -0,0 +1,59 @@
+/*
+ * Packed weather icons : an RGB565 palette and 4 or 8 bit pixels
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_ICON_H_
+#define	_ICON_H_
+
+#include <Arduino.h>
+
+/*
+ * An icon is one block of memory : this header, the palette (colours entries), and the
+ * pixels. That way it can be copied, cached, stored in a file and sent to peers as is.
+ *
+ * Pixels are 4 bit (two per byte, the first one in the high nibble) or 8 bit palette
+ * indices, without padding between rows. Icons with more than 256 colours are kept as
+ * plain RGB565 (bpp 16, no palette).
+ */
+struct IconHeader {
+  uint16_t	width, height;
+  uint16_t	colours;	// Palette entries
+  uint8_t	bpp;		// 4, 8 or 16
+  uint8_t	reserved;
+};
+
+class Icon {
+public:
+  static uint8_t *Pack(const uint16_t *pixels, uint16_t width, uint16_t height);
+  static boolean Valid(const uint8_t *icon, int len);
+
+  static uint16_t Width(const uint8_t *icon);
+  static uint16_t Height(const uint8_t *icon);
+  static int Size(const uint8_t *icon);
+
+  static const uint16_t *Palette(const uint8_t *icon);
+  static const uint8_t *Pixels(const uint8_t *icon);
+
+private:
+  static int Size(uint16_t width, uint16_t height, uint16_t colours, uint8_t bpp);
+};
+
+#endif	/* _ICON_H_ */
@@ -0,0 +1,218 @@
+/*
+ * This module keeps decoded weather icons, so we don't download and decode them again
+ *
+ * The weather icon changes a couple of times per day, but only between a small set of
+ * images ("rain", "cloudy", ...). Each of these is kept here as a packed icon (see Icon.cpp),
+ * keyed by a hash of the icon URL. When the byte budget is exhausted, the least recently used
+ * icons are dropped.
+ *
+ * With PREF_ICON_CACHE_SPIFFS, each icon is also written to flash, so that after a reboot
+ * (or after eviction from RAM) we still don't need to go to the network.
+ *
+ * Get() returns a copy, the caller owns it (typically passed to Weather::drawIcon).
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <IconCache.h>
+#include <Icon.h>
+#include <preferences.h>
+#ifdef	PREF_ICON_CACHE_SPIFFS
+# include <FS.h>
+# if defined(ESP32)
+#  include <SPIFFS.h>
+# endif
+#endif
+
+#include <list>
+using namespace std;
+
+IconCache::IconCache(int budget) {
+  this->budget = budget;
+  used = 0;
+
+#ifdef	PREF_ICON_CACHE_SPIFFS
+  SPIFFS.begin();
+#endif
+}
+
+IconCache::~IconCache() {
+  for (IconCacheEntry e : entries)
+    free(e.icon);
+  entries.clear();
+  used = 0;
+}
+
+/*
+ * FNV-1a, 32 bit. Zero is used as "no key", so avoid it.
+ */
+uint32_t IconCache::Hash(const char *url) {
+  uint32_t h = 2166136261u;
+
+  if (url == 0)
+    return 0;
+  for (; *url; url++) {
+    h ^= (uint8_t)*url;
+    h *= 16777619u;
+  }
+  return h ? h : 1;
+}
+
+/*
+ * Look up an icon, return a copy (caller must free) or NULL.
+ */
+uint8_t *IconCache::Get(uint32_t key) {
+  if (key == 0)
+    return 0;
+
+  list<IconCacheEntry>::iterator e = entries.begin();
+  while (e != entries.end()) {
+    if (e->key == key)
+      break;
+    e++;
+  }
+
+  if (e != entries.end()) {
+    uint8_t *r = (uint8_t *)malloc(e->size);
+    if (r == 0)
+      return 0;
+    memcpy(r, e->icon, e->size);
+
+    // Move to the front : most recently used
+    entries.splice(entries.begin(), entries, e);
+    // Serial.printf("IconCache hit %08x (%d bytes)\n", key, e->size);
+    return r;
+  }
+
+#ifdef	PREF_ICON_CACHE_SPIFFS
+  uint8_t *p = ReadFile(key);
+  if (p) {
+    // Keep a RAM copy too
+    int nb = Icon::Size(p);
+    uint8_t *r = (uint8_t *)malloc(nb);
+    if (r) {
+      memcpy(r, p, nb);
+      Insert(key, r, nb);
+    }
+    return p;
+  }
+#endif
+
+  return 0;
+}
+
+/*
+ * Store a copy of an icon. The caller keeps ownership of it.
+ */
+void IconCache::Put(uint32_t key, const uint8_t *icon) {
+  if (key == 0 || icon == 0)
+    return;
+
+  int nb = Icon::Size(icon);
+  if (nb > budget)
+    return;
+
+  for (IconCacheEntry e : entries)
+    if (e.key == key)
+      return;	// Already there
+
+  uint8_t *p = (uint8_t *)malloc(nb);
+  if (p == 0)
+    return;
+  memcpy(p, icon, nb);
+  Insert(key, p, nb);
+
+#ifdef	PREF_ICON_CACHE_SPIFFS
+  WriteFile(key, icon, nb);
+#endif
+}
+
+/*
+ * Add to the front of the list, we own icon from here.
+ */
+void IconCache::Insert(uint32_t key, uint8_t *icon, int size) {
+  Evict(size);
+
+  IconCacheEntry e;
+  e.key = key;
+  e.size = size;
+  e.icon = icon;
+  entries.push_front(e);
+  used += size;
+}
+
+/*
+ * Drop least recently used entries until nbytes more fit in the budget
+ */
+void IconCache::Evict(int nbytes) {
+  while (! entries.empty() && used + nbytes > budget) {
+    IconCacheEntry &e = entries.back();
+    // Serial.printf("IconCache evict %08x\n", e.key);
+    used -= e.size;
+    free(e.icon);
+    entries.pop_back();
+  }
+}
+
+#ifdef	PREF_ICON_CACHE_SPIFFS
+/*
+ * The file holds the packed icon as is. The name differs from the one used when
+ * icons were stored as RGB565, so such files are simply not found.
+ */
+void IconCache::FileName(char *fn, uint32_t key) {
+  sprintf(fn, "/picon-%08x", key);
+}
+
+uint8_t *IconCache::ReadFile(uint32_t key) {
+  char fn[20];
+
+  FileName(fn, key);
+  File f = SPIFFS.open(fn, "r");
+  if (!f)
+    return 0;
+
+  int nb = f.size();
+  uint8_t *r = (uint8_t *)malloc(nb);
+  if (r == 0 || f.read(r, nb) != nb || ! Icon::Valid(r, nb)) {
+    Serial.printf("IconCache: could not read %s\n", fn);
+    free(r);
+    f.close();
+    return 0;
+  }
+  f.close();
+  return r;
+}
+
+void IconCache::WriteFile(uint32_t key, const uint8_t *icon, int size) {
+  char fn[20];
+
+  FileName(fn, key);
+  if (SPIFFS.exists(fn))
+    return;
+
+  File f = SPIFFS.open(fn, "w");
+  if (!f) {
+    Serial.printf("IconCache: could not write %s\n", fn);
+    return;
+  }
+  f.write(icon, size);
+  f.close();
+}
+#endif
@@ -0,0 +1,65 @@
+/*
+ * This module keeps decoded weather icons, so we don't download and decode them again
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_ICON_CACHE_H_
+#define	_ICON_CACHE_H_
+
+#include <Arduino.h>
+#include <preferences.h>
+
+#include <list>
+using namespace std;
+
+struct IconCacheEntry {
+  uint32_t	key;		// Hash of the icon URL
+  int		size;
+  uint8_t	*icon;		// Packed, see Icon.h
+};
+
+class IconCache {
+public:
+  IconCache(int budget);
+  ~IconCache();
+
+  static uint32_t Hash(const char *url);
+
+  uint8_t *Get(uint32_t key);
+  void Put(uint32_t key, const uint8_t *icon);
+
+private:
+  list<IconCacheEntry>	entries;	// Most recently used first
+  int			budget;		// Maximum number of bytes of icon data
+  int			used;
+
+  void Insert(uint32_t key, uint8_t *icon, int size);
+  void Evict(int nbytes);
+
+#ifdef	PREF_ICON_CACHE_SPIFFS
+  void FileName(char *fn, uint32_t key);
+  uint8_t *ReadFile(uint32_t key);
+  void WriteFile(uint32_t key, const uint8_t *icon, int size);
+#endif
+};
+
+extern IconCache *iconcache;
+
+#endif	/* _ICON_CACHE_H_ */
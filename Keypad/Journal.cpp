@@ -0,0 +1,222 @@
+/*
+ * This module keeps a log of alarm events on flash
+ *
+ * The log is one SPIFFS file of fixed size records, used as a ring : when it is full, the
+ * oldest record is overwritten. SPIFFS spreads the writes over the flash.
+ * Records are numbered, so after a reboot a binary search finds where the ring wraps.
+ * As they are also written in time order, looking up a time is a binary search too.
+ *
+ * Log() is called from the alarm code, it only copies the record into RAM. Writing to
+ * flash happens in loop(), every PREF_JOURNAL_FLUSH seconds or when the buffer fills up.
+ *
+ * The file can be fetched over the peer REST port ({"journal" : true}), and decoded with
+ * tools/journal.c .
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <Journal.h>
+#include <preferences.h>
+#include <FS.h>
+#if defined(ESP32)
+# include <SPIFFS.h>
+#endif
+
+Journal::Journal(const char *fn, int nrecords) {
+  this->fn = fn;
+  this->nrecords = nrecords;
+  first = count = 0;
+  seq = 0;
+  npending = 0;
+  dropped = 0;
+  now_ts = flush_ts = 0;
+
+  SPIFFS.begin();
+
+  // Allocate the whole ring at once, empty slots are zero
+  if (! SPIFFS.exists(fn)) {
+    File nf = SPIFFS.open(fn, "w");
+    if (!nf) {
+      Serial.printf("Journal: could not create %s\n", fn);
+      return;
+    }
+    JournalRecord empty;
+    memset(&empty, 0, sizeof(empty));
+    for (int i = 0; i < nrecords; i++)
+      nf.write((const uint8_t *)&empty, sizeof(empty));
+    nf.close();
+  }
+
+  f = SPIFFS.open(fn, "r+");
+  if (!f) {
+    Serial.printf("Journal: could not open %s\n", fn);
+    return;
+  }
+  if (f.size() != nrecords * sizeof(JournalRecord)) {
+    Serial.printf("Journal: %s has the wrong size, ignored\n", fn);
+    f.close();
+    return;
+  }
+
+  Scan();
+  Serial.printf("Journal: %d records, last %d\n", count, seq);
+}
+
+Journal::~Journal() {
+  Flush();
+  if (f)
+    f.close();
+}
+
+boolean Journal::Read(int slot, JournalRecord *r) {
+  if (! f.seek(slot * sizeof(JournalRecord)))
+    return false;
+  return f.read((uint8_t *)r, sizeof(JournalRecord)) == sizeof(JournalRecord);
+}
+
+/*
+ * Find the newest record. From slot 0, numbers go up until the ring wraps (or ends), after
+ * that they're either older or empty.
+ */
+void Journal::Scan() {
+  JournalRecord r;
+
+  if (! Read(0, &r) || r.seq == 0)
+    return;				// Empty
+
+  uint32_t seq0 = r.seq;
+  int lo = 0, hi = nrecords - 1;	// Last slot that is at least as new as slot 0
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (Read(mid, &r) && r.seq != 0 && r.seq >= seq0)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+
+  Read(lo, &r);
+  seq = r.seq;
+
+  if (lo + 1 < nrecords && Read(lo + 1, &r) && r.seq != 0) {
+    first = lo + 1;			// Wrapped
+    count = nrecords;
+  } else {
+    first = 0;
+    count = lo + 1;
+  }
+}
+
+/*
+ * Called from the alarm code, so don't touch flash here
+ */
+void Journal::Log(JournalType type, const char *source, uint8_t zone, uint8_t arg) {
+  if (npending == PREF_JOURNAL_BUFFER) {
+    dropped++;
+    return;
+  }
+
+  JournalRecord *r = &pending[npending++];
+  memset(r, 0, sizeof(JournalRecord));
+  r->seq = ++seq;
+  r->ts = now_ts;
+  r->type = type;
+  r->zone = zone;
+  r->arg = arg;
+  if (source)
+    strncpy(r->source, source, sizeof(r->source) - 1);
+}
+
+void Journal::loop(time_t nowts) {
+  if (nowts > 1000)
+    now_ts = nowts;
+
+  if (npending > 0 && (npending >= PREF_JOURNAL_BUFFER / 2 || nowts - flush_ts >= PREF_JOURNAL_FLUSH))
+    Flush();
+}
+
+void Journal::Flush() {
+  flush_ts = now_ts;
+  if (npending == 0 || !f)
+    return;
+
+  for (int i = 0; i < npending; i++) {
+    int slot = (first + count) % nrecords;
+    if (count == nrecords)
+      first = (first + 1) % nrecords;	// Overwrite the oldest
+    else
+      count++;
+
+    f.seek(slot * sizeof(JournalRecord));
+    f.write((const uint8_t *)&pending[i], sizeof(JournalRecord));
+  }
+  f.flush();
+  npending = 0;
+}
+
+int Journal::Count() {
+  return count;
+}
+
+boolean Journal::Get(int i, JournalRecord *r) {
+  Flush();
+  if (i < 0 || i >= count)
+    return false;
+  return Read((first + i) % nrecords, r);
+}
+
+/*
+ * Binary search on time. Returns Count() if everything is older.
+ *
+ * Records logged before the time was known have ts 0, they end up between timed ones after
+ * a reboot. They don't count : from a record without a time, look ahead for one with.
+ */
+int Journal::Find(time_t ts) {
+  JournalRecord r;
+  int lo = 0, hi = count;
+
+  Flush();
+  while (lo < hi) {
+    int mid = (lo + hi) / 2, j = mid;
+    boolean ok = false;
+    while (j < hi && (ok = Get(j, &r)) && r.ts == 0)
+      j++;
+    if (j < hi && ok && (time_t)r.ts < ts)
+      lo = j + 1;
+    else
+      hi = mid;			// From mid on, none is older
+  }
+  return lo;
+}
+
+/*
+ * All records, oldest first, as they are in the file
+ */
+void Journal::Dump(Print *out) {
+  JournalRecord r;
+
+  Flush();
+  for (int i = 0; i < count; i++)
+    if (Get(i, &r))
+      out->write((const uint8_t *)&r, sizeof(r));
+}
+
+uint32_t Journal::GetDropped() {
+  return dropped;
+}
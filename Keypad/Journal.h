@@ -0,0 +1,79 @@
+/*
+ * This module keeps a log of alarm events on flash
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_JOURNAL_H_
+#define	_JOURNAL_H_
+
+#include <Arduino.h>
+#include <FS.h>
+#include <preferences.h>
+
+// Keep in sync with tools/journal.c
+enum JournalType {
+  JOURNAL_NONE,
+  JOURNAL_ALARM,	// Sensor (or peer) set off the alarm
+  JOURNAL_ARM,		// Armed state changed, arg is the AlarmStatus
+  JOURNAL_RESET,	// Alarm reset by a user or a peer
+};
+
+struct JournalRecord {
+  uint32_t	seq;		// Goes up by one per record, 0 in an empty slot
+  uint32_t	ts;		// time_t, 0 if we didn't have the time yet
+  uint8_t	type;		// JournalType
+  uint8_t	zone;		// AlarmZone
+  uint8_t	arg;
+  char		source[21];	// Sensor, user or peer name
+};
+
+class Journal {
+public:
+  Journal(const char *fn, int nrecords);
+  ~Journal();
+  void loop(time_t);
+  void Log(JournalType type, const char *source, uint8_t zone, uint8_t arg = 0);
+  void Flush();
+
+  int Count();
+  boolean Get(int i, JournalRecord *r);	// 0 is the oldest
+  int Find(time_t ts);			// First record at or after ts, untimed ones skipped
+  void Dump(Print *out);
+  uint32_t GetDropped();
+
+private:
+  const char		*fn;
+  File			f;
+  int			nrecords;
+  int			first, count;	// Oldest slot, records in the file
+  uint32_t		seq;		// Last one handed out
+
+  // Write-behind : Log() only copies here, loop() writes to flash
+  JournalRecord		pending[PREF_JOURNAL_BUFFER];
+  int			npending;
+  uint32_t		dropped;	// Records lost because pending was full
+  time_t		now_ts, flush_ts;
+
+  boolean Read(int slot, JournalRecord *r);
+  void Scan();
+};
+
+extern Journal *journal;
+#endif	/* _JOURNAL_H_ */
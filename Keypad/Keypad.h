@@ -33,6 +33,9 @@
 #include <Rfid.h>
 #include <Weather.h>
 #include <LoadGif.h>
+#include <IconCache.h>
+#include <Journal.h>
+#include <AlarmStore.h>
 #include <Wire.h>
 
 extern "C" {
@@ -51,6 +54,9 @@ extern Peers			*peers;
 extern Rfid			*rfid;
 extern Weather			*weather;
 extern LoadGif			*gif;
+extern IconCache		*iconcache;
+extern Journal			*journal;
+extern AlarmStore		*alarmstore;
 extern boolean			in_ota;
 extern int			OTAprogress;
 
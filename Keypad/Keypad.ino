@@ -33,41 +33,45 @@
 #include <Rfid.h>
 #include <Weather.h>
 #include <LoadGif.h>
+#include <IconCache.h>
+#include <Touch.h>
+#include <Widget.h>
+#include <Journal.h>
+#include <AlarmStore.h>
 #include <Wire.h>
 
 extern "C" {
 #include <sntp.h>
 }
 
-void s1b1(struct OledScreen *scr, int button);
-void s1b2(struct OledScreen *scr, int button);
-void s1b3(struct OledScreen *scr, int button);
-void s2b1(struct OledScreen *scr, int button);
-void s2b2(struct OledScreen *scr, int button);
-void s2b3(struct OledScreen *scr, int button);
-void s1draw(OledScreen *pscr);
-void s2draw(OledScreen *pscr);
+void s1b1(void *pw, const TouchEvent *ev);
+void s1b2(void *pw, const TouchEvent *ev);
+void s1b3(void *pw, const TouchEvent *ev);
 
-String xxx[] = { "yes", "no", "maybe" };
+const char *xxx[] = { "yes", "no", "maybe" };
 
-void (*yyy[])(struct OledScreen *, int) = { s1b1, s1b2, s1b3, NULL };
-void (*zzz[])(struct OledScreen *, int) = { s2b1, s2b2, s2b3, NULL };
+TouchHandler yyy[] = { s1b1, s1b2, s1b3 };
 
+// Keypad start position, key sizes and spacing
+#define KEY_X		40	// Centre of key
+#define KEY_Y		300	// 96
+#define KEY_W		62	// Width and height
+#define KEY_H		30
+#define KEY_SPACING_X	18 // X and Y gap
+#define KEY_SPACING_Y	20
+#define KEY_TEXTSIZE	1   // Font size multiplier
+#define	KEY_FONT	1	// FreeSans9pt7b
+
+// Widgets are added in setup()
 OledScreen screen1 = {
   "home",				// name
   0,					// number
-  3,					// #buttons
-  0, // { "yes", "no", "maybe" },
-  0, // { s1b1, s1b2, s1b3 },
-  s1draw
+  0					// draw
 };
 OledScreen screen2 = {
   "detail",
   0,
-  3,
-  0, 
-  0,
-  s2draw
+  0
 };
 int	s1, s2;
 
@@ -86,6 +90,10 @@ Peers			*peers = 0;
 Rfid			*rfid = 0;
 Weather			*weather = 0;
 LoadGif			*gif = 0;
+IconCache		*iconcache = 0;
+Touch			*touch = 0;
+Journal			*journal = 0;
+AlarmStore		*alarmstore = 0;
 boolean			in_ota = false;
 int			OTAprogress = 0;
 
@@ -104,9 +112,21 @@ uint16_t keyColor[NUMKEYS] = {TFT_RED, TFT_BLUE, TFT_GREEN };
 OledButton key[NUMKEYS];
 
 void setup(void) {
+  // Armed state from before a reboot, first thing : this only reads a bit of flash
+  uint32_t t0 = micros();
+  AlarmStatus restored;
+  time_t restored_ts;
+  alarmstore = new AlarmStore();
+  boolean have_restored = alarmstore->Load(&restored, &restored_ts);
+  uint32_t t1 = micros();
+
 				Serial.begin(115200);
 				Serial.println("\nAlarm Controller (c) 2017, 2018 by Danny Backx");
 				Serial.printf("Free heap : %d\n", ESP.getFreeHeap());
+  if (alarmstore->GetWarning())
+    Serial.printf("AlarmStore: %s\n", alarmstore->GetWarning());
+  if (have_restored)
+    Serial.printf("Armed state %d (since %ld) restored in %d us\n", restored, (long)restored_ts, t1 - t0);
 				Serial.print("Starting WiFi "); 
   SetupWifi();
   config = new Config();
@@ -133,14 +153,27 @@ void setup(void) {
     backlight->SetStatus(BACKLIGHT_TEMP_ON);			// Display on, fades after timeout
     backlight->SetTimeout(PREF_BACKLIGHT_TIMEOUT);		// Hardcoded timeout in seconds
 
-    screen1.buttonText = xxx;
-    screen1.buttonHandler = yyy;
+    touch = new Touch(oled, config->GetTouchIrqPin());
+    touch->Subscribe(Oled::Touched, oled);
+    touch->Subscribe(BackLight::Touched, backlight);
+
     s1 = oled->addScreen(screen1);
     s2 = oled->addScreen(screen2);
-    oled->showScreen(s1);
-
+    for (int col = 0; col < 3; col++) {
+      OledButtonWidget *b = new OledButtonWidget(
+        KEY_X + col * (KEY_W + KEY_SPACING_X),	// x
+        KEY_Y,					// y
+        KEY_W, KEY_H,				// w, h
+        TFT_WHITE, TFT_RED, TFT_WHITE,		// outline, fill, text colours
+        xxx[col], KEY_TEXTSIZE,			// text, size
+	yyy[col], (void *)xxx[col]);
+      b->setFont(KEY_FONT);
+      oled->addWidget(s1, b);
+    }
   }
 
+  journal = new Journal(PREF_JOURNAL_FN, PREF_JOURNAL_RECORDS);
+  iconcache = new IconCache(PREF_ICON_CACHE_SIZE);
   gif = new LoadGif(oled);
   _clock = new Clock(oled);
   peers = new Peers();
@@ -158,6 +191,18 @@ void setup(void) {
   }
 
   _alarm = new Alarm(oled);
+  if (have_restored)
+    _alarm->Restore(restored);
+
+  if (config->haveOled()) {
+    // The clock is on both screens, it stays put when switching
+    oled->addWidget(s1, _clock);
+    oled->addWidget(s1, weather);
+    oled->addWidget(s1, _alarm->GetButton());
+    oled->addWidget(s2, _clock);
+    oled->showScreen(s1);
+				Serial.println("OLED ready.");
+  }
 
   Serial.println("Ready");
 }
@@ -165,10 +210,6 @@ void setup(void) {
 
 void loop()
 {
-  uint16_t	t_x, t_y, t_z;	// To store the touch coordinates
-  uint16_t	d_x, d_y;
-  uint8_t	pressed;
-
   ArduinoOTA.handle();
 
 #ifdef ESP32
@@ -191,6 +232,7 @@ void loop()
 
   if (weather) weather->loop(nowts);
   if (config->haveOled()) {
+    touch->loop(nowts);			// The only place that reads the touch panel
     oled->loop(nowts);
     _clock->loop(nowts);
     backlight->loop(nowts);
@@ -201,18 +243,7 @@ void loop()
   _alarm->loop(nowts);
   peers->loop(nowts);
   if (rfid) rfid->loop(nowts);
-
-  if (config->haveOled()) {
-    pressed = oled->getTouchRaw(&t_x, &t_y);
-    t_z = oled->getTouchRawZ();
-
-    if (pressed == 0 || t_z < 500) 
-      return;
-
-//				  Serial.printf("X = %4d\tY = %4d\tZ = %4d\n", t_x, t_y, t_z);
-    // oled->fillCircle(t_x, t_y, PENRADIUS, ILI9341_RED);
-
-  }
+  journal->loop(nowts);			// Writes to flash what the others logged
 }
 
 /*
@@ -321,40 +352,19 @@ void SetupWifi() {
   Serial.printf(" -> IP %s gw %s\n", ips.c_str(), gws.c_str());
 }
 
-void s1b1(struct OledScreen *scr, int button) {
-  Serial.printf("s1b1: screen %s button %d %s\n", scr->name.c_str(), button, scr->buttonText[button].c_str());
-}
-
-void s1b2(struct OledScreen *scr, int button) {
-  Serial.printf("s1b2: screen %s button %d %s\n", scr->name.c_str(), button, scr->buttonText[button].c_str());
-}
-
-void s1b3(struct OledScreen *scr, int button) {
-  Serial.printf("s1b3: screen %s button %d %s\n", scr->name.c_str(), button, scr->buttonText[button].c_str());
-}
-
-void s2b1(struct OledScreen *scr, int button) {
-  Serial.printf("s2b1: screen %s button %d %s\n", scr->name.c_str(), button, scr->buttonText[button].c_str());
-}
-
-void s2b2(struct OledScreen *scr, int button) {
-  Serial.printf("s2b2: screen %s button %d %s\n", scr->name.c_str(), button, scr->buttonText[button].c_str());
-}
-
-void s2b3(struct OledScreen *scr, int button) {
-  Serial.printf("s2b3: screen %s button %d %s\n", scr->name.c_str(), button, scr->buttonText[button].c_str());
+void s1b1(void *pw, const TouchEvent *ev) {
+  if (ev->type == TOUCH_PRESS)
+    Serial.printf("s1b1: screen home button %s\n", (const char *)pw);
 }
 
-void s1draw(OledScreen *pscr) {
-  Serial.printf("s1draw: drawing screen %s\n", pscr->name.c_str());
-
-  oled->fillScreen(ILI9341_BLACK);
-
-				Serial.println("OLED ready.");
+void s1b2(void *pw, const TouchEvent *ev) {
+  if (ev->type == TOUCH_PRESS)
+    Serial.printf("s1b2: screen home button %s\n", (const char *)pw);
 }
 
-void s2draw(OledScreen *pscr) {
-  Serial.printf("s2draw: drawing screen %s\n", pscr->name.c_str());
+void s1b3(void *pw, const TouchEvent *ev) {
+  if (ev->type == TOUCH_PRESS)
+    Serial.printf("s1b3: screen home button %s\n", (const char *)pw);
 }
 
 extern "C" {
@@ -1,5 +1,17 @@
 /*
- * This module loads a GIF and calls libnsgif to convert into raw bitmap format
+ * This module loads a GIF and converts it into raw bitmap format
+ *
+ * With PREF_GIF_STREAMING, the GIF is decoded while it downloads (see GifStream.cpp),
+ * otherwise the whole file is downloaded and handed to libnsgif.
+ *
+ * The streaming download is a job that loadGif() only starts. Each call to loop() then
+ * reads and decodes for at most PREF_GIF_SLICE_US microseconds, a few rows at a time,
+ * so the rest of the keypad keeps running. Rows are shown as soon as they're decoded.
+ *
+ * With PREF_GIF_ANIMATION, the file of an animated GIF (one with a loop extension) is kept,
+ * and loop() has libnsgif decode its frames one by one as their delays expire. libnsgif
+ * takes care of the disposal methods, only the rectangle that changed is sent to the display.
+ * For a still picture, the copy is dropped as soon as its first image starts.
  *
  * Copyright (c) 2018 Danny Backx
  *
@@ -33,6 +45,10 @@
 #include <Oled.h>
 #include <Peers.h>
 #include <Weather.h>
+#include <IconCache.h>
+#include <Icon.h>
+#include <GifStream.h>
+#include <preferences.h>
 
 static void *bitmap_create(int width, int height);
 static void bitmap_destroy(void *bitmap);
@@ -48,6 +64,16 @@ LoadGif::LoadGif(Oled *oled) {
   buf = 0;
   url = 0;
 
+  job = JOB_IDLE;
+  gs = 0;
+  pic = 0;
+
+#ifdef	PREF_GIF_ANIMATION
+  anim_data = 0;
+  anim_len = anim_size = 0;
+  animating = false;
+#endif
+
   bitmap_callbacks.bitmap_create = bitmap_create;
   bitmap_callbacks.bitmap_destroy = bitmap_destroy;
   bitmap_callbacks.bitmap_get_buffer = bitmap_get_buffer;
@@ -57,6 +83,10 @@ LoadGif::LoadGif(Oled *oled) {
 }
 
 LoadGif::~LoadGif() {
+  StopJob();
+#ifdef	PREF_GIF_ANIMATION
+  StopAnimation();
+#endif
   if (buf)
     free(buf);
 				// Serial.printf("LoadGif dtor free(%p)\n", buf);
@@ -69,16 +99,88 @@ void LoadGif::loadGif(const char *url) {
     // Serial.printf("Same URL as before (%s)\n", this->url);
     return;
   }
+  StopJob();			// A download for the previous URL may still be going on
+#ifdef	PREF_GIF_ANIMATION
+  StopAnimation();
+#endif
   if (this->url)
     free(this->url);
   this->url = strdup(url);
 
+  // Seen this one before ? Then no need to download and decode.
+  uint32_t key = IconCache::Hash(url);
+  uint8_t *icon;
+  if (iconcache && (icon = iconcache->Get(key)) != 0) {
+    if (weather)
+      weather->drawIcon(icon);
+    if (peers)
+      peers->SendImage(icon, key);
+    return;
+  }
+
+#ifdef	PREF_GIF_STREAMING
+  StartJob(url, key);
+#else
+  pic = BufferedGif(url);
+  if (pic)
+    Deliver(key);
+  else
+    Forget();
+#endif
+}
+
+/*
+ * Pack the new icon, show it, and pass it on
+ */
+void LoadGif::Deliver(uint32_t key) {
+				// Serial.printf("LoadGif::pic %p weather %p peers %p\n", pic, weather, peers);
+  if (oled)
+    oled->endBatch();		// Rows may still be queued, they point into pic
+  uint8_t *icon = Icon::Pack(pic, picw, pich);
+  free(pic);
+  pic = 0;
+  if (icon == 0)
+    return;
+
+  if (iconcache)
+    iconcache->Put(key, icon);
+
+  if (weather)
+    weather->drawIcon(icon);		// Weather knows where to draw it, and keeps icon
+
+  // Pass on to other nodes
+  if (peers)
+    peers->SendImage(icon, key);
+
+#ifdef	PREF_GIF_ANIMATION
+  if (anim_data)
+    StartAnimation();
+#endif
+
+				// Serial.println("done"); Serial.flush();
+				// Serial.printf("After GIF decode : heap %d\n", ESP.getFreeHeap());
+}
+
+/*
+ * Failed, so don't treat the next query for this URL as a duplicate
+ */
+void LoadGif::Forget() {
+  if (url)
+    free(url);
+  url = 0;
+}
+
+/*
+ * Download the complete file, then have libnsgif decode it.
+ */
+uint16_t *LoadGif::BufferedGif(const char *url) {
   size_t giflen;
   gif_result code;
   unsigned char *gifdata;
 
 				// Serial.printf("Before GIF : heap %d\n", ESP.getFreeHeap());
   gif_create(&gif, &bitmap_callbacks);
+  gif.format = GIF_FORMAT_RGB565;	// Ready for drawIcon, no conversion pass
 				// Serial.printf("Before download : heap %d\n", ESP.getFreeHeap());
 
   // Download it
@@ -89,30 +191,36 @@ void LoadGif::loadGif(const char *url) {
 				// Serial.println();
 				// Serial.printf("After download : heap %d\n", ESP.getFreeHeap());
   if (gifdata == 0)
-    return;
+    return 0;
 
 				// Serial.print("Begin decoding .. ");
   /* begin decoding */
   do {
+    yield();
     code = gif_initialise(&gif, giflen, gifdata);
     if (code != GIF_OK && code != GIF_WORKING) {
       // warning("gif_initialise", code);
-
-      // FIXME
       free(buf);
-				// Serial.printf("LoadGif return, free buf %p\n", buf);
       buf = 0;
-
-      return;
+      gif_finalise(&gif);
+      return 0;
     }
   } while (code != GIF_OK);
 
+#ifdef	PREF_GIF_ANIMATION
+  // Same rule as the streaming path : only a GIF with a loop extension is animated
+  if (gif.looping && gif.frame_count > 1 && giflen <= PREF_GIF_ANIMATION) {
+    anim_data = buf;	// Played from loop() later on
+    anim_len = giflen;
+    buf = 0;
+  }
+#endif
 				// Serial.printf("LoadGif free buf %p\n", buf);
   free(buf);		// Frees the buffer allocated in loadGif()
   buf = 0;
 
   // Converted picture
-  pic = Decode2(&gif);
+  uint16_t *r = Decode2(&gif);
   picw = gif.width;
   pich = gif.height;
 
@@ -121,23 +229,304 @@ void LoadGif::loadGif(const char *url) {
   gif_finalise(&gif);
 
 				// Serial.printf("LoadGif conversion done (%d x %d)\n", picw, pich);
+  return r;
+}
 
-				// Serial.printf("LoadGif::pic %p weather %p peers %p\n", pic, weather, peers);
-  if (pic) {
-    if (weather)
-      weather->drawIcon(pic, picw, pich);	// Weather knows where to draw it
+/*
+ * Start downloading, the rest happens in loop()
+ */
+void LoadGif::StartJob(const char *url, uint32_t key) {
+  StopJob();
 
-    // Pass on to other nodes
-    if (peers)
-      peers->SendImage(pic, picw, pich);
+  if (! Connect(http, url)) {
+    Forget();
+    return;
   }
 
-				// Serial.println("done"); Serial.flush();
-				// Serial.printf("After GIF decode : heap %d\n", ESP.getFreeHeap());
+  gs = new GifStream(StreamCanvas, StreamRow, this);
+  gs->SetRowBudget(rows_per_step);
+
+  job = JOB_HEADERS;
+  job_key = key;
+  job_last = millis();
+  line_len = 0;
+  chunk_len = chunk_pos = 0;
+}
+
+/*
+ * Abandon the download, if any
+ */
+void LoadGif::StopJob() {
+  if (job == JOB_IDLE)
+    return;
+
+  http.stop();
+  delete gs;
+  gs = 0;
+  if (oled)
+    oled->endBatch();
+  free(pic);
+  pic = 0;
+  job = JOB_IDLE;
+#ifdef	PREF_GIF_ANIMATION
+  StopAnimation();
+#endif
+}
+
+/*
+ * The download has ended. A truncated one is still good if at least one image came through.
+ */
+void LoadGif::EndJob() {
+  http.stop();
+  boolean ok = ! gs->Failed() && gs->Frames() > 0;
+  delete gs;
+  gs = 0;
+  job = JOB_IDLE;
+
+  if (ok) {
+    Deliver(job_key);
+  } else {
+    Serial.printf("LoadGif: could not decode %s\n", url ? url : "");
+    if (oled)
+      oled->endBatch();
+    free(pic);
+    pic = 0;
+#ifdef	PREF_GIF_ANIMATION
+    StopAnimation();
+#endif
+    Forget();
+  }
+}
+
+/*
+ * Do a small amount of work : skip some header bytes, or read a chunk, or decode a few rows.
+ * Returns false if there's nothing to do now.
+ */
+boolean LoadGif::Step() {
+  if (job == JOB_HEADERS) {
+    // Headers end after an empty line
+    while (http.available()) {
+      int c = http.read();
+      job_last = millis();
+      if (c == '\n') {
+        if (line_len == 0) {
+	  job = JOB_BODY;
+	  return true;
+	}
+	line_len = 0;
+      } else if (c != '\r')
+        line_len++;
+    }
+  } else if (chunk_pos < chunk_len || gs->Paused()) {
+    int r = gs->Feed(chunk + chunk_pos, chunk_len - chunk_pos);
+    if (r < 0 || gs->Done()) {
+      EndJob();
+      return false;
+    }
+    chunk_pos += r;
+#ifdef	PREF_GIF_ANIMATION
+    // Animations have their loop extension before the first image, without one it's a still
+    if (anim_len >= 0 && gs->Started() && ! gs->Looping()) {
+      free(anim_data);
+      anim_data = 0;
+      anim_len = -1;
+      anim_size = 0;
+    }
+#endif
+    return true;
+  } else if (http.available()) {
+    int nb = http.read(chunk, sizeof(chunk));
+    if (nb > 0) {
+      chunk_len = nb;
+      chunk_pos = 0;
+      job_last = millis();
+#ifdef	PREF_GIF_ANIMATION
+      Keep(chunk, nb);
+#endif
+      return true;
+    }
+  }
+
+  // Nothing came in
+  if (! http.connected() || millis() - job_last > timeout) {
+    if (job == JOB_HEADERS) {
+      Serial.printf("LoadGif: no reply for %s\n", url ? url : "");
+      StopJob();
+      Forget();
+    } else
+      EndJob();
+  }
+  return false;
+}
+
+void LoadGif::loop(time_t) {
+  // Rows and frames are sent in one go, they're still there at the end of this call
+  if (oled)
+    oled->beginBatch();
+
+#ifdef	PREF_GIF_ANIMATION
+  if (animating)
+    Animate();
+#endif
+  if (job != JOB_IDLE) {
+    uint32_t start = micros();
+    while (Step() && (micros() - start < PREF_GIF_SLICE_US))
+      ;
+  }
+
+  if (oled)
+    oled->endBatch();
+}
+
+#ifdef	PREF_GIF_ANIMATION
+/*
+ * Hang on to the file while it downloads, in case it turns out to be animated
+ */
+void LoadGif::Keep(const uint8_t *data, int len) {
+  if (anim_len < 0)
+    return;
+  if (anim_len + len > PREF_GIF_ANIMATION) {
+    free(anim_data);
+    anim_data = 0;
+    anim_len = -1;			// Too large, don't try again for this file
+    return;
+  }
+  if (anim_len + len > anim_size) {
+    int ns = anim_size ? 2 * anim_size : std_buflen;
+    while (ns < anim_len + len)
+      ns *= 2;
+    if (ns > PREF_GIF_ANIMATION)
+      ns = PREF_GIF_ANIMATION;
+    unsigned char *p = (unsigned char *)realloc(anim_data, ns);
+    if (p == 0) {
+      free(anim_data);
+      anim_data = 0;
+      anim_len = -1;
+      return;
+    }
+    anim_data = p;
+    anim_size = ns;
+  }
+  memcpy(anim_data + anim_len, data, len);
+  anim_len += len;
 }
 
-// Note : can't change this. The library works with 4 bytes per pixel internally
-#define BYTES_PER_PIXEL 4
+/*
+ * The still picture (the last frame) is on display, start over at the first frame after its delay
+ */
+void LoadGif::StartAnimation() {
+  gif_result code;
+
+  gif_create(&gif, &bitmap_callbacks);
+  gif.format = GIF_FORMAT_RGB565;
+  do {
+    yield();
+    code = gif_initialise(&gif, anim_len, anim_data);
+  } while (code == GIF_WORKING);
+
+  if (code != GIF_OK || gif.frame_count < 2) {
+    gif_finalise(&gif);
+    free(anim_data);
+    anim_data = 0;
+    anim_len = anim_size = 0;
+    return;
+  }
+
+  animating = true;
+  anim_frame = 0;
+  anim_loops = 0;
+  anim_next = millis() + gif.frames[gif.frame_count - 1].frame_delay * 10;
+}
+
+void LoadGif::StopAnimation() {
+  if (animating && oled)
+    oled->endBatch();		// A frame may still be queued, it points into gif.frame_image
+  if (animating)
+    gif_finalise(&gif);
+  animating = false;
+  free(anim_data);
+  anim_data = 0;
+  anim_len = anim_size = 0;
+}
+
+/*
+ * Show the next frame if it's time to
+ */
+void LoadGif::Animate() {
+  if ((int32_t)(millis() - anim_next) < 0)
+    return;
+
+  unsigned int i = anim_frame;
+  if (gif_decode_frame(&gif, i) != GIF_OK) {
+    StopAnimation();
+    return;
+  }
+
+  // What changed : this frame, and the previous one if that got cleared.
+  // libnsgif restores (disposal method 3) by decoding an older frame again, that can be anywhere.
+  gif_frame *f = &gif.frames[i];
+  unsigned int x0 = f->redraw_x, y0 = f->redraw_y,
+    x1 = f->redraw_x + f->redraw_width, y1 = f->redraw_y + f->redraw_height;
+  if (i == 0 || gif.frames[i - 1].disposal_method == 3) {
+    x0 = y0 = 0;
+    x1 = gif.width;
+    y1 = gif.height;
+  } else if (gif.frames[i - 1].redraw_required) {
+    gif_frame *p = &gif.frames[i - 1];
+    if (p->redraw_x < x0) x0 = p->redraw_x;
+    if (p->redraw_y < y0) y0 = p->redraw_y;
+    if (p->redraw_x + p->redraw_width > x1) x1 = p->redraw_x + p->redraw_width;
+    if (p->redraw_y + p->redraw_height > y1) y1 = p->redraw_y + p->redraw_height;
+  }
+  if (x1 > gif.width) x1 = gif.width;
+  if (y1 > gif.height) y1 = gif.height;
+
+  if (weather && x0 < x1 && y0 < y1)
+    weather->drawIconRect((uint16_t *)gif.frame_image, gif.width, x0, y0, x1 - x0, y1 - y0);
+
+  // Delays are in 1/100 s. Like browsers do, treat very short ones as 1/10 s.
+  unsigned int cs = f->frame_delay;
+  if (cs < 2)
+    cs = 10;
+  anim_next = millis() + cs * 10;
+
+  if (++anim_frame == gif.frame_count) {
+    anim_frame = 0;
+    if (gif.loop_count > 0 && ++anim_loops >= gif.loop_count)
+      StopAnimation();			// The last frame stays on display
+  }
+}
+#endif
+
+/*
+ * Called from GifStream when a row is complete, show it already
+ */
+void LoadGif::StreamRow(void *pw, uint16_t x, uint16_t y, uint16_t width) {
+  LoadGif *lg = (LoadGif *)pw;
+
+  if (weather)
+    weather->drawIconRow(lg->pic + y * lg->picw + x, x, y, width);
+}
+
+/*
+ * Called from GifStream when the image size is known
+ */
+uint16_t *LoadGif::StreamCanvas(void *pw, uint16_t width, uint16_t height) {
+  LoadGif *lg = (LoadGif *)pw;
+
+  if (width > 75 || height > 75)
+    return 0;
+
+  lg->picw = width;
+  lg->pich = height;
+  lg->pic = (uint16_t *)malloc(width * height * 2);
+  if (lg->pic == 0)
+    Serial.printf("LoadGif: malloc failed (free heap %d)\n", ESP.getFreeHeap());
+  return lg->pic;
+}
+
+// libnsgif writes RGB565 for us, see gif.format
+#define BYTES_PER_PIXEL 2
 #define MAX_IMAGE_BYTES (48 * 1024 * 1024)
 
 static void *bitmap_create(int width, int height) {
@@ -192,18 +581,16 @@ const char *LoadGif::pattern = "GET %s HTTP/1.1\r\n"
 	"Connection: close\r\n"
 	"\r\n";
 
-// Fetch a gif over the internet
-// FIX ME this needs to handle timeouts
-// FIX ME this needs to handle slow connections better
-// Return points to a buffer which the caller needs to free.
-unsigned char *LoadGif::loadGif(const char *url, size_t *data_size) {
+/*
+ * Connect, and send the HTTP request.
+ */
+boolean LoadGif::Connect(WiFiClient &http, const char *url) {
   char		*query, *host = 0;
-  WiFiClient	http;
 
-  char *proto = strstr(url, "://");
+  const char *proto = strstr(url, "://");
   if (proto) {
     proto += 3;
-    char *s = strchr(proto, '/');
+    const char *s = strchr(proto, '/');
     if (s != 0) {
       host = (char *)malloc(s - proto + 2);
       for (int i=0; proto[i] != '/'; i++) {
@@ -213,10 +600,8 @@ unsigned char *LoadGif::loadGif(const char *url, size_t *data_size) {
     }
   }
   if (host == 0) {
-    // FIX ME maybe just give up here and return NULL
-    // host = strdup(url);
     Serial.printf("Could not get host from %s\n", url);
-    return 0;
+    return false;
   }
 
   query = (char *)malloc(strlen(url) + strlen(host) + strlen(pattern) + 8);
@@ -225,62 +610,81 @@ unsigned char *LoadGif::loadGif(const char *url, size_t *data_size) {
 
   if (! http.connect(host, 80)) {	// Not connected
     Serial.printf("Could not connect to %s\n", host);
-    return 0;
+    free(query);
+    free(host);
+    return false;
   }
   http.print(query);
   http.flush();
+  free(query);
+  free(host);
+  return true;
+}
 
-  buflen = std_buflen;		// Postpone allocating buffer, base buffer length on header info
-  boolean skip = true;
-  int rl = 0;
-  while (http && (http.connected() || http.available())) {
-    if (skip) {			// Skip headers, but read Content-Length
-      String line = http.readStringUntil('\n');
-      const char *l = line.c_str();
-      if (strncmp(l, "Content-Length:", 15) == 0) {
-        buflen = atoi(l + 15) + 1;
-      }
-      if (line.length() <= 1)	// Headers end after an empty line
-        skip = false;
-    } else {
-      // Allocate here, based on the header info
-      if (buf) {		// Prevent leak
-        free(buf);
-					// Serial.printf("Free buf %p, pending alloc\n", buf);
-      }
-      buf = (unsigned char *)malloc(buflen);
-      					// Serial.printf("Malloc buf(%d) -> %p\n", buflen, buf);
-
-      int nb = http.read((uint8_t *)&buf[rl], buflen - rl);
-      if (nb > 0) {
-        rl += nb;
-	if (rl > buflen)
-	  rl = buflen;
-      } else if (nb <= 0) {
-        Serial.println("Read error");
-	free(query); query = 0;
-	free(host); host = 0;
-	if (buf) {
-					// Serial.printf("Free buf %p\n", buf);
-	  free(buf);
-	  buf = 0;
-	}
-
-	http.stop();
-
-	if (data_size)
-	  *data_size = 0;
-	return 0;
-      }
+/*
+ * Wait for the reply, and skip its headers.
+ * Returns false if that didn't work out, the connection is closed then.
+ */
+boolean LoadGif::SkipHeaders(WiFiClient &http, int *content_length) {
+  // Skip headers, but read Content-Length
+  uint32_t start = millis();
+  while (http.connected() || http.available()) {
+    if (! http.available()) {
+      if (millis() - start > timeout)
+        break;
+      delay(10);
+      continue;
     }
-    delay(100);
+    String line = http.readStringUntil('\n');
+    const char *l = line.c_str();
+    if (content_length && strncmp(l, "Content-Length:", 15) == 0)
+      *content_length = atoi(l + 15);
+    if (line.length() <= 1)	// Headers end after an empty line
+      return true;
   }
-				// Serial.printf("reply ok, downloaded %d bytes\n", rl);
 
+  Serial.printf("No reply for %s\n", url);
   http.stop();
+  return false;
+}
+
+// Fetch a gif over the internet
+// Return points to a buffer which the caller needs to free.
+unsigned char *LoadGif::loadGif(const char *url, size_t *data_size) {
+  WiFiClient	http;
+  int		len = 0;
+
+  if (data_size)
+    *data_size = 0;
+
+  if (! Connect(http, url) || ! SkipHeaders(http, &len))
+    return 0;
 
-  free(query); query = 0;
-  free(host); host = 0;
+  buflen = (len > 0) ? len + 1 : std_buflen;
+  if (buf)
+    free(buf);
+  buf = (unsigned char *)malloc(buflen);
+  if (buf == 0) {
+    Serial.printf("LoadGif: malloc(%d) failed\n", buflen);
+    http.stop();
+    return 0;
+  }
+
+  int rl = 0;
+  uint32_t start = millis();
+  while (rl < buflen && (http.connected() || http.available())) {
+    int nb = http.read((uint8_t *)&buf[rl], buflen - rl);
+    if (nb > 0) {
+      rl += nb;
+      start = millis();
+    } else if (millis() - start > timeout) {
+      Serial.println("Read timeout");
+      break;
+    } else
+      delay(10);
+  }
+				// Serial.printf("reply ok, downloaded %d bytes\n", rl);
+  http.stop();
 
   if (data_size)
     *data_size = rl;
@@ -288,54 +692,32 @@ unsigned char *LoadGif::loadGif(const char *url, size_t *data_size) {
   return buf;
 }
 
-void LoadGif::loop(time_t) {
-}
-
+/*
+ * Decode all frames (each is drawn over the previous one), then take the
+ * RGB565 frame image away from libnsgif so gif_finalise() doesn't free it.
+ */
 uint16_t *LoadGif::Decode2(gif_animation *gif) {
   gif_result code;
 
-				// Serial.printf("Decode2 : sz %d (%d x %d)", gif->width * gif->height * 2, gif->width, gif->height);
-
-  uint16_t *outbuf = (uint16_t *)malloc(gif->width * gif->height * 2 + 16);
-				// Serial.printf(" -> %p\n", outbuf);
-
-  if (outbuf == 0) {
-    Serial.printf("LoadGif::Decode2 malloc failed (free heap %d)\n", ESP.getFreeHeap());
-    return 0;
-  }
-
   /* decode the frames */
   for (int i = 0; i != gif->frame_count; i++) {
-    int row, col, k;
-    unsigned char *image;
-
+    yield();			// A GIF can have thousands of frames, keep the watchdog happy
     code = gif_decode_frame(gif, i);
     if (code != GIF_OK)
       ; // warning("gif_decode_frame", code);
-
-    image = (unsigned char *) gif->frame_image;
-    for (row = 0, k = 0; row != gif->height; row++) {
-      for (col = 0; col != gif->width; col++) {
-	size_t z = (row * gif->width + col) * 4;
-	// 5 + 6 + 5 bits coded
-	// k++ is equivalent to (row * gif->width + col)
-	// outbuf[k++] = image[z] << 11 | image[z+1] << 6 | image[z+2];
-	outbuf[k++] =	((image[z]  & 0xF8)	<< 8)	// red
-		      | ((image[z+1] & 0xFC)	<< 3)	// green
-		      | ((image[z+2])		>> 3);	// blue
-      }
-    }
   }
+
+  uint16_t *outbuf = (uint16_t *)gif->frame_image;
+  gif->frame_image = 0;
   				// Serial.printf("Decode2 : done\n");
   return outbuf;
 }
 
 /*
- * FIX ME
- * This is meant to be a way to read a rectangle from the screen, but incomplete
- * implementation, and untested.
- * See examples/320 x 240/TFT_Screen_Capture/screenServer.ino
+ * Read a rectangle from the screen, in display byte order. Anything still queued is drawn first.
+ * For the whole screen, see Oled::snapshot().
  */
 void LoadGif::ReadScreen(uint16_t *data, int x, int y, int width, int height) {
-  oled->readRect(x, y, width * height, 1, data);
+  oled->endBatch();
+  oled->readRect(x, y, width, height, data);
 }
@@ -24,7 +24,10 @@
 #define	_LOADGIF_H_
 
 #include "libnsgif.h"
+#include <preferences.h>
 #include <Oled.h>
+#include <GifStream.h>
+#include <WiFiClient.h>
 
 class LoadGif {
 public:
@@ -47,7 +50,47 @@ private:
   uint16_t		*pixels;
   gif_animation		gif;
 
+  const uint32_t		timeout = 10000;	// ms without data before giving up
+
+  boolean Connect(WiFiClient &http, const char *url);
+  boolean SkipHeaders(WiFiClient &http, int *content_length);
   unsigned char *loadGif(const char *url, size_t *data_size);
+  uint16_t *BufferedGif(const char *url);
+  void Deliver(uint32_t key);
+  void Forget();
+
+  // Streaming download, done a bit at a time from loop()
+  enum { JOB_IDLE, JOB_HEADERS, JOB_BODY } job;
+  WiFiClient		http;
+  GifStream		*gs;
+  uint32_t		job_key;	// IconCache key of the URL
+  uint32_t		job_last;	// millis() when data last came in
+  int			line_len;	// Length of the header line being skipped
+  uint8_t		chunk[256];
+  int			chunk_len, chunk_pos;
+  static const int	rows_per_step = 4;
+
+  void StartJob(const char *url, uint32_t key);
+  void StopJob();
+  void EndJob();
+  boolean Step();
+  static uint16_t *StreamCanvas(void *pw, uint16_t width, uint16_t height);
+  static void StreamRow(void *pw, uint16_t x, uint16_t y, uint16_t width);
+
+#ifdef	PREF_GIF_ANIMATION
+  // Animation, libnsgif decodes the frames from the GIF file kept here
+  unsigned char		*anim_data;
+  int			anim_len, anim_size;	// anim_len is -1 if too large, or a still
+  boolean		animating;
+  unsigned int		anim_frame;		// Next frame to show
+  uint32_t		anim_next;		// millis() when to show it
+  int			anim_loops;
+
+  void Keep(const uint8_t *data, int len);
+  void StartAnimation();
+  void StopAnimation();
+  void Animate();
+#endif
   gif_bitmap_callback_vt bitmap_callbacks;
   uint16_t *Decode2(gif_animation *gif);
 
@@ -29,38 +29,52 @@
  */
 
 #include <Oled.h>
-#include <BackLight.h>
-
-const int ctrx = 1;	// Translate coordinates ?
+#include <Pixels.h>
+#include <Icon.h>
+#include <Touch.h>
+#include <Widget.h>
 
 Oled::Oled(int16_t _W, int16_t _H) {
   TFT_eSPI(_W, _H);
   verbose = 0;
+  current = 0;
+  pressed = 0;
+  memset(grid, 0, sizeof(grid));
+
+  nqueue = 0;
+  batching = false;
+  memset(&stats, 0, sizeof(stats));
 }
 
 void Oled::init(void) {
   TFT_eSPI::init();
   screens = std::vector<OledScreen>(0);
+  fields = std::vector<OledTextField>(0);
 }
 
 void Oled::begin(void) {
   TFT_eSPI::begin();
 }
 
+/*
+ * The drawing primitives below don't talk to the display themselves, they append to a
+ * queue. Outside of a batch, the queue is run right away, so that looks the same as
+ * before. Between beginBatch() and endBatch(), commands pile up (the queue is only run
+ * early when it's full), and then go out in one SPI transaction. Adjacent commands are
+ * merged as they come in : fills of the same colour that continue each other, and
+ * consecutive rows of the same image, such as what LoadGif shows while decoding.
+ *
+ * Images are not copied, the caller must keep them until the batch ends.
+ */
 void Oled::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
-  if (verbose) Serial.printf("drawRect(%d,%d,%d,%d, %08x)\n", x, 320 - y - h, w, h, color);
-  if (ctrx)
-    TFT_eSPI::drawRect(x, 320 - y - h, w, h, color);
-  else
-    TFT_eSPI::drawRect(x, y, w, h, color);
+  if (verbose) Serial.printf("drawRect(%d,%d,%d,%d, %08x)\n", x, OledPanel::Y(y, h), w, h, color);
+  Queue(OLED_RECT, x, OledPanel::Y(y, h), w, h, color);
 }
 
 void Oled::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
-  if (verbose) Serial.printf("fillRect(%d,%d,%d,%d, %08x)\n", x, 320 - y - h, w, h, color);
-  if (ctrx)
-    TFT_eSPI::fillRect(x, 320 - y - h, w, h, color);
-  else
-    TFT_eSPI::fillRect(x, y, w, h, color);
+  if (verbose) Serial.printf("fillRect(%d,%d,%d,%d, %08x)\n", x, OledPanel::Y(y, h), w, h, color);
+  Queue(OLED_FILL, x, OledPanel::Y(y, h), w, h, color);
+  Damage(x, OledPanel::Y(y, h), w, h);
 }
 
 void Oled::setRotation(uint8_t r) {
@@ -68,36 +82,190 @@ void Oled::setRotation(uint8_t r) {
 }
 
 void Oled::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
-  if (verbose) Serial.printf("drawCircle(%d,%d,%d, %08x)\n", x0, 320 - y0, r, color);
-  if (ctrx)
-    TFT_eSPI::drawCircle(x0, 320 - y0, r, color);
-  else
-    TFT_eSPI::drawCircle(x0, y0, r, color);
+  if (verbose) Serial.printf("drawCircle(%d,%d,%d, %08x)\n", x0, OledPanel::Y(y0), r, color);
+  Queue(OLED_CIRCLE, x0, OledPanel::Y(y0), r, 0, color);
 }
 
 void Oled::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
-  if (verbose) Serial.printf("fillCircle(%d,%d,%d, %08x)\n", x0, 320 - y0, r, color);
-  if (ctrx)
-    TFT_eSPI::fillCircle(x0, 320 - y0, r, color);
-  else
-    TFT_eSPI::fillCircle(x0, y0, r, color);
+  if (verbose) Serial.printf("fillCircle(%d,%d,%d, %08x)\n", x0, OledPanel::Y(y0), r, color);
+  Queue(OLED_FILL_CIRCLE, x0, OledPanel::Y(y0), r, 0, color);
 }
 
 void Oled::fillScreen(uint32_t color) {
+  nqueue = 0;			// Would be painted over anyway
   TFT_eSPI::fillScreen(color);
+  stats.transactions++;
+  stats.pixels += OledPanel::width * OledPanel::height;
+
+  // Text fields and widgets need to be drawn completely next time
+  for (OledTextField &f : fields)
+    f.shown[0] = 0;
+  if (current)
+    for (OledWidget *w : current->widgets)
+      w->invalidate();
+}
+
+void Oled::beginBatch() {
+  batching = true;
+}
+
+void Oled::endBatch() {
+  batching = false;
+  Drain();
+}
+
+/*
+ * Counters, to see what a screen update costs
+ */
+OledStats Oled::getStats(boolean reset) {
+  OledStats r = stats;
+  if (reset)
+    memset(&stats, 0, sizeof(stats));
+  return r;
+}
+
+/*
+ * Write what is on the display as a binary PPM image, one row at a time.
+ */
+void Oled::snapshot(Print *out) {
+  const int16_t w = OledPanel::width, h = OledPanel::height;
+  uint16_t row[w];
+  uint8_t rgb[3 * w];
+
+  endBatch();
+  out->printf("P6\n%d %d\n255\n", w, h);
+  for (int16_t y = 0; y < h; y++) {
+    readRect(0, y, w, 1, row);
+    for (int16_t x = 0; x < w; x++) {
+      uint16_t c = (row[x] >> 8) | (row[x] << 8);	// Display byte order
+      rgb[3 * x] = ((c >> 11) * 527 + 23) >> 6;
+      rgb[3 * x + 1] = (((c >> 5) & 0x3F) * 259 + 33) >> 6;
+      rgb[3 * x + 2] = ((c & 0x1F) * 527 + 23) >> 6;
+    }
+    out->write(rgb, sizeof(rgb));
+    yield();
+  }
+}
+
+void Oled::Queue(uint8_t op, int16_t x, int16_t y, uint16_t w, uint16_t h, uint32_t colour,
+  const void *data, uint16_t stride) {
+  OledCommand c;
+
+  c.op = op;
+  c.x = x;
+  c.y = y;
+  c.w = w;
+  c.h = h;
+  c.colour = colour;
+  c.data = data;
+  c.stride = stride;
+
+  stats.commands++;
+  if (Merge(&c))
+    stats.merged++;
+  else {
+    if (nqueue == max_queue)
+      Drain();
+    queue[nqueue++] = c;
+  }
+
+  if (! batching)
+    Drain();
+}
+
+/*
+ * Extend the last command in the queue with c, if that draws the same thing
+ */
+boolean Oled::Merge(const OledCommand *c) {
+  if (nqueue == 0)
+    return false;
+
+  OledCommand *p = &queue[nqueue - 1];
+  if (p->op != c->op)
+    return false;
+
+  switch (c->op) {
+  case OLED_FILL:
+    if (p->colour != c->colour)
+      return false;
+    // Either side, callers' y goes up where the display's goes down
+    if (p->y == c->y && p->h == c->h && (p->x + p->w == c->x || c->x + c->w == p->x)) {
+      if (c->x < p->x)
+        p->x = c->x;
+      p->w += c->w;
+      return true;
+    }
+    if (p->x == c->x && p->w == c->w && (p->y + p->h == c->y || c->y + c->h == p->y)) {
+      if (c->y < p->y)
+        p->y = c->y;
+      p->h += c->h;
+      return true;
+    }
+    return false;
+
+  case OLED_IMAGE:
+    if (p->x == c->x && p->w == c->w && p->stride == c->stride && p->y + p->h == c->y
+     && (const uint16_t *)p->data + p->h * p->stride == c->data) {
+      p->h += c->h;
+      return true;
+    }
+    return false;
+  }
+  return false;
+}
+
+/*
+ * Run the queue in one transaction
+ */
+void Oled::Drain() {
+  if (nqueue == 0)
+    return;
+
+  startWrite();
+  for (int i = 0; i < nqueue; i++)
+    Run(&queue[i]);
+  endWrite();
+
+  stats.transactions++;
+  nqueue = 0;
+}
+
+void Oled::Run(const OledCommand *c) {
+  // Circles are estimates : 2 pi r, and pi r * r
+  switch (c->op) {
+  case OLED_FILL:
+    TFT_eSPI::fillRect(c->x, c->y, c->w, c->h, c->colour);
+    stats.pixels += c->w * c->h;
+    break;
+  case OLED_RECT:
+    TFT_eSPI::drawRect(c->x, c->y, c->w, c->h, c->colour);
+    stats.pixels += 2 * (c->w + c->h);
+    break;
+  case OLED_CIRCLE:
+    TFT_eSPI::drawCircle(c->x, c->y, c->w, c->colour);
+    stats.pixels += 6 * c->w;
+    break;
+  case OLED_FILL_CIRCLE:
+    TFT_eSPI::fillCircle(c->x, c->y, c->w, c->colour);
+    stats.pixels += (2 * c->w + 1) * (2 * c->w + 1) * 201 / 256;
+    break;
+  case OLED_IMAGE:
+    RunImage(c);
+    stats.pixels += c->w * c->h;
+    break;
+  case OLED_PACKED:
+    RunPacked(c);
+    stats.pixels += c->w * c->h;
+    break;
+  }
 }
 
 uint8_t Oled::getTouchRaw(uint16_t *x, uint16_t *y) {
   uint16_t a, b;
   uint8_t r = TFT_eSPI::getTouchRaw(&a, &b);
 
-  if (ctrx) {
-    *x = 240 - 240 * (a - 300) / 3460;
-    *y = 320 - 320 * (b - 300) / 3460;
-  } else {
-    *x = a;
-    *y = b;
-  }
+  *x = OledPanel::TouchX(a);
+  *y = OledPanel::TouchY(b);
 
   return r;
 }
@@ -118,69 +286,81 @@ void Oled::setLED(int tm) {
 
 /*
  * Screen handling
+ *
+ * A screen is a list of widgets (see Widget.cpp). Switching from one screen to another
+ * only erases the widgets that the new one doesn't have, and draws the ones that the old
+ * one didn't have. A screen with a draw callback is painted from scratch.
  */
 int Oled::addScreen(OledScreen screen) {
   screens.push_back(screen);
-  if (verbose) Serial.printf("addScreen(%s) -> pos %d\n", screen.name.c_str(), screens.size()-1);
+  if (current)
+    current = &screens[curr_screen];	// The vector may have moved
+  if (verbose) Serial.printf("addScreen(%s) -> pos %d\n", screen.name.c_str(), (int)screens.size()-1);
   return screens.size()-1;
 }
 
-// FIX ME needs cleanup
+int Oled::addWidget(int ix, OledWidget *widget) {
+  if (ix < 0 || ix >= (int)screens.size() || widget == 0)
+    return -1;
 
-// #define	LABEL_FONT		&FreeSans12pt7b
-#define	LABEL_FONT		&FreeSans9pt7b
-
-// Keypad start position, key sizes and spacing
-#define KEY_X		40	// Centre of key
-#define KEY_Y		300	// 96
-#define KEY_W		62	// Width and height
-#define KEY_H		30
-#define KEY_SPACING_X	18 // X and Y gap
-#define KEY_SPACING_Y	20
-#define KEY_TEXTSIZE	1   // Font size multiplier
-
-void Oled::showScreenButtons(int ix) {
-  uint8_t row = 0;
-  if (current->key == 0)
-    current->key = (OledButton **)calloc(sizeof(OledButton *), current->nbuttons+1);
-  for (uint8_t col = 0; col < current->nbuttons; col++) {
-    uint8_t b = col + row * 3;
-
-    if (current->key[b] == nullptr) {
-      OledButton *btn = new OledButton();
-      current->key[b] = btn;
-    }
+  OledScreen *scr = &screens[ix];
+  if (scr->widgets.size() >= max_widgets) {
+    Serial.printf("Oled: screen %s is full\n", scr->name.c_str());
+    return -1;
+  }
+  scr->widgets.push_back(widget);
 
-    setFreeFont(LABEL_FONT);
-
-    // if (verbose)
-      Serial.printf("initButton(x %d, y %d, w %d, h %d) %s\n",
-        KEY_X + col * (KEY_W + KEY_SPACING_X),
-        KEY_Y + row * (KEY_H + KEY_SPACING_Y),
-        KEY_W, KEY_H,
-        (char *)current->buttonText[b].c_str());
-    current->key[b]->initButton(this,
-      KEY_X + col * (KEY_W + KEY_SPACING_X),	// x
-      KEY_Y + row * (KEY_H + KEY_SPACING_Y),	// y
-      KEY_W, KEY_H,				// w, h
-      TFT_WHITE, TFT_RED, TFT_WHITE,		// outline, fill, text colours
-      (char *)current->buttonText[b].c_str(), KEY_TEXTSIZE);	// text, size
-    current->key[b]->drawButton();
+  if (scr == current) {
+    widget->visible = true;
+    widget->invalidate();
+    BuildGrid();
   }
+  return scr->widgets.size() - 1;
+}
+
+static boolean OnScreen(const OledScreen *scr, const OledWidget *widget) {
+  for (const OledWidget *w : scr->widgets)
+    if (w == widget)
+      return true;
+  return false;
 }
 
 void Oled::showScreen(int ix) {
+  OledScreen *prev = current;
+
   curr_screen = ix;
   current = &screens[curr_screen];
 
   if (verbose) Serial.printf("ShowScreen(%d) %s\n", ix, screens[ix].name.c_str());
 
-  fillScreen(TFT_BLACK);			// Clear the screen
-  if (screens[curr_screen].draw != 0) {
-    screens[curr_screen].draw(&screens[curr_screen]);
+  if (prev == current)
+    return;
+
+  if (prev)
+    for (OledWidget *w : prev->widgets)
+      if (! OnScreen(current, w)) {
+        if (current->draw == 0)
+	  w->erase(this);
+	w->visible = false;
+      }
+
+  if (prev == 0 || current->draw != 0) {
+    fillScreen(TFT_BLACK);			// Clear the screen
+    if (current->draw != 0)
+      current->draw(current);
+    for (OledWidget *w : current->widgets)
+      w->visible = false;
   }
 
-  showScreenButtons(ix);
+  for (OledWidget *w : current->widgets)
+    if (! w->visible) {
+      w->visible = true;
+      w->invalidate();
+    }
+
+  pressed = 0;
+  BuildGrid();
+  update();
 }
 
 boolean Oled::isScreenVisible(int ix) {
@@ -188,35 +368,89 @@ boolean Oled::isScreenVisible(int ix) {
 }
 
 /*
- * When called periodically, this triggers button callback functions
+ * Redraw the widgets that changed
  */
+void Oled::update() {
+  if (current == 0)
+    return;
+
+  boolean any = false;
+  beginBatch();
+  for (OledWidget *w : current->widgets)
+    if (w->dirty) {
+      w->dirty = false;
+      w->redraw(this);
+      any = true;
+    }
+  if (any)
+    flush();
+  else
+    endBatch();
+}
+
 void Oled::loop(time_t nowts) {
-  if (getTouchRawZ() > 500) {
-    uint16_t tx, ty;
-
-    backlight->touched(nowts);
-
-    (void) getTouchRaw(&tx, &ty);
-
-    for (int btn=0; btn<current->nbuttons; btn++)
-      if (ctrx) {
-        if (current->key[btn]->contains(tx, 320 - ty)) {
-          current->buttonHandler[btn](current, btn);
-        }
-      } else {
-        if (current->key[btn]->contains(tx, ty)) {
-          current->buttonHandler[btn](current, btn);
-        }
-      }
+  update();
+}
+
+void Oled::BuildGrid() {
+  memset(grid, 0, sizeof(grid));
+  if (current == 0)
+    return;
+
+  for (unsigned int i = 0; i < current->widgets.size(); i++) {
+    OledWidget *w = current->widgets[i];
+    if (w->w == 0 || w->h == 0)
+      continue;
+
+    int c0 = w->x * grid_cols / OledPanel::width,
+      c1 = (w->x + w->w - 1) * grid_cols / OledPanel::width,
+      r0 = w->y * grid_rows / OledPanel::height,
+      r1 = (w->y + w->h - 1) * grid_rows / OledPanel::height;
+    c0 = constrain(c0, 0, grid_cols - 1);
+    c1 = constrain(c1, 0, grid_cols - 1);
+    r0 = constrain(r0, 0, grid_rows - 1);
+    r1 = constrain(r1, 0, grid_rows - 1);
+
+    for (int r = r0; r <= r1; r++)
+      for (int c = c0; c <= c1; c++)
+        grid[r][c] |= 1UL << i;
   }
 }
 
+/*
+ * Topmost widget at x,y (display coordinates)
+ */
+OledWidget *Oled::HitTest(int16_t x, int16_t y) {
+  if (current == 0 || x < 0 || x >= OledPanel::width || y < 0 || y >= OledPanel::height)
+    return 0;
+
+  uint32_t mask = grid[y * grid_rows / OledPanel::height][x * grid_cols / OledPanel::width];
+  for (int i = current->widgets.size() - 1; i >= 0; i--)
+    if ((mask & (1UL << i)) && current->widgets[i]->contains(x, y))
+      return current->widgets[i];
+  return 0;
+}
+
+/*
+ * Touch events come from the Touch module. The widget under a press gets that event,
+ * and the moves and the release that follow, wherever they are.
+ */
+void Oled::Touched(void *pw, const TouchEvent *ev) {
+  Oled *oled = (Oled *)pw;
+
+  if (ev->type == TOUCH_PRESS)
+    oled->pressed = oled->HitTest(ev->x, OledPanel::Y(ev->y));
+
+  OledWidget *w = oled->pressed;
+  if (ev->type == TOUCH_RELEASE)
+    oled->pressed = 0;
+  if (w)
+    w->touched(ev);
+}
+
 void OledButton::initButton(TFT_eSPI *gfx, int16_t x, int16_t y, uint16_t w, uint16_t h,
 	uint16_t outline, uint16_t fill, uint16_t textcolor, char *label, uint8_t textsize) {
-  if (ctrx)
-    TFT_eSPI_Button::initButton(gfx, x, 320 - y, w, h, outline, fill, textcolor, label, textsize);
-  else
-    TFT_eSPI_Button::initButton(gfx, x, y, w, h, outline, fill, textcolor, label, textsize);
+  TFT_eSPI_Button::initButton(gfx, x, OledPanel::Y(y), w, h, outline, fill, textcolor, label, textsize);
 }
 
 /*
@@ -237,7 +471,7 @@ void OledButton::initButton(TFT_eSPI *gfx, int16_t x, int16_t y, uint16_t w, uin
  */
 boolean OledButton::contains(int16_t x, int16_t y) {
 #if 0
-  y = 320 - y;
+  y = OledPanel::Y(y);
 
   boolean r = ((x >= _x1) && (x < (_x1 + _w)) && (y >= _y1) && (y < (_y1 + _h)));
   Serial.printf("Contains ? {%d,%d} [%d .. %d, %d .. %d] -> %s\n",
@@ -257,49 +491,432 @@ boolean OledButton::contains(int16_t x, int16_t y) {
  * See TFT_eSPI/examples/320 x 240/TFT_Flash_Bitmap , moved from example to class method here.
  */
 void Oled::drawIcon(const uint16_t *icon, int16_t x, int16_t y, uint16_t width, uint16_t height) {
-#if 1
-  // Use buffering to increase transfer speed.
-  // We don't need this speed, but the examples are coded this way so what the hell.
+  Queue(OLED_IMAGE, x, y, width, height, 0, icon, width);
+}
 
-  uint16_t pixbuf[OLED_BS];
+/*
+ * Draw part of a larger image : rows of the icon are stride pixels apart.
+ */
+void Oled::drawIcon(const uint16_t *icon, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t stride) {
+  Queue(OLED_IMAGE, x, y, width, height, 0, icon, stride);
+}
 
-  setWindow(x, y, x + width - 1, y + height - 1);
+/*
+ * Draw a packed icon (see Icon.cpp)
+ */
+void Oled::drawIcon(const uint8_t *icon, int16_t x, int16_t y) {
+  const IconHeader *hdr = (const IconHeader *)icon;
 
-  // How many whole buffers to send ?
-  uint16_t nb = ((uint16_t)height * width) / OLED_BS;
+  if (hdr->bpp == 16)
+    drawIcon((const uint16_t *)Icon::Pixels(icon), x, y, hdr->width, hdr->height);
+  else
+    Queue(OLED_PACKED, x, y, hdr->width, hdr->height, 0, icon, hdr->width);
+}
 
-  // Fill and send that many buffers to TFT
-  for (int i = 0; i < nb; i++) {
-    for (int j = 0; j < OLED_BS; j++) {
-      pixbuf[j] = icon[i * OLED_BS + j];
+/*
+ * Send RGB565 pixels, a buffer at a time, already in display byte order
+ */
+void Oled::RunImage(const OledCommand *c) {
+  const uint16_t *icon = (const uint16_t *)c->data;
+  uint32_t width = c->w, rows = c->h;
+
+  // Without gaps between the rows, it's all one long row
+  if (c->stride == c->w) {
+    width *= rows;
+    rows = 1;
+  }
+
+  setWindow(c->x, c->y, c->x + c->w - 1, c->y + c->h - 1);
+  for (uint32_t r = 0; r < rows; r++, icon += c->stride)
+    for (uint32_t i = 0; i < width; i += OLED_BS) {
+      uint16_t np = (width - i < OLED_BS) ? width - i : OLED_BS;
+      pixels_565_swap(pixbuf, icon + i, np);
+      pushColors(pixbuf, np, false);
     }
-    pushColors(pixbuf, OLED_BS);
+}
+
+/*
+ * The palette is put in display byte order first, so the lookup produces pixels that
+ * can be sent as they are.
+ */
+void Oled::RunPacked(const OledCommand *c) {
+  const uint8_t *icon = (const uint8_t *)c->data;
+  const IconHeader *hdr = (const IconHeader *)icon;
+  uint16_t palette[256];
+  const uint8_t *pixels = Icon::Pixels(icon);
+  uint32_t n = hdr->width * hdr->height;
+
+  pixels_565_swap(palette, Icon::Palette(icon), hdr->colours);
+  setWindow(c->x, c->y, c->x + hdr->width - 1, c->y + hdr->height - 1);
+
+  // OLED_BS is even, so with 4 bit pixels each buffer starts on a byte
+  for (uint32_t i = 0; i < n; i += OLED_BS) {
+    uint16_t np = (n - i < OLED_BS) ? n - i : OLED_BS;
+    if (hdr->bpp == 8)
+      pixels_palette_to_565(pixbuf, pixels + i, np, palette);
+    else
+      pixels_palette4_to_565(pixbuf, pixels + i / 2, np, palette);
+    pushColors(pixbuf, np, false);
   }
+}
 
-  // How many pixels not yet sent ?
-  uint16_t np = ((uint16_t)height * width) % OLED_BS;
+const GFXfont *Oled::Font(int i) {
+  switch (i) {
+  default:	return &FreeSans9pt7b;
+  case 2:	return &FreeSans12pt7b;
+  case 3:	return &FreeSans18pt7b;
+  case 4:	return &FreeSans24pt7b;
+  }
+}
 
-  // Send any partial buffer left over
-  if (np) {
-    for (int i = 0; i < np; i++)
-      pixbuf[i] = icon[nb * OLED_BS + i];
+void Oled::fontSize(int i) {
+  setFreeFont(Font(i));
+}
 
-      pushColors(pixbuf, np);
+/*
+ * Text fields
+ *
+ * Clock and Weather used to erase a string by drawing it again in black, and then draw the
+ * new one : every glyph went over SPI twice, even if only a digit changed. A text field
+ * remembers what it shows. flush() compares that with the new text, and only redraws the
+ * part that differs : the glyphs between the common prefix and the common suffix (the
+ * suffix only if it stays in place). That rectangle is rendered here, background included,
+ * a row at a time, and sent with one window and a pushColors() per row.
+ *
+ * Glyphs come straight from the GFX font, positioned like drawString() does with the
+ * default (top left) datum : the baseline is the largest ascent in the font below y.
+ *
+ * Fields may overlap (the weather line runs into the descent of the temperature), so the
+ * glyphs of the others are rendered into the rectangle too. A fillRect() over a field
+ * (a widget being erased) marks it damaged : it is redrawn completely on the next flush().
+ */
+int Oled::addTextField(int16_t x, int16_t y, int font, uint16_t colour) {
+  OledTextField f;
+
+  f.x = x;
+  f.y = y;
+  f.font = Font(font);
+  f.colour = colour;
+  f.shown[0] = f.text[0] = 0;
+  f.damaged = false;
+  f.nsprites = 0;
+  f.sprite_char[0] = 0;
+
+  // Font wide ascent and descent, to know the height of the field
+  const GFXglyph *glyphs = (const GFXglyph *)pgm_read_ptr(&f.font->glyph);
+  uint16_t nglyphs = pgm_read_word(&f.font->last) - pgm_read_word(&f.font->first) + 1;
+  int ab = 0, bb = 0;
+  for (int i = 0; i < nglyphs; i++) {
+    int a = - (int8_t)pgm_read_byte(&glyphs[i].yOffset);
+    int b = pgm_read_byte(&glyphs[i].height) - a;
+    if (a > ab) ab = a;
+    if (b > bb) bb = b;
+  }
+  f.ascent = ab;
+  f.descent = bb;
+
+  fields.push_back(f);
+  return fields.size() - 1;
+}
+
+/*
+ * Change the text of a field. Nothing is drawn until flush().
+ */
+void Oled::setText(int field, const char *text) {
+  if (field < 0 || field >= (int)fields.size())
+    return;
+  strncpy(fields[field].text, text, sizeof(fields[field].text) - 1);
+  fields[field].text[sizeof(fields[field].text) - 1] = 0;
+}
+
+/*
+ * Run what is queued, then update all fields whose text changed
+ */
+void Oled::flush() {
+  endBatch();			// Queued commands go first, fields are drawn directly
+
+  boolean any = false;
+  for (OledTextField &f : fields)
+    if (f.damaged || strcmp(f.shown, f.text) != 0) {
+      if (! any)
+        startWrite();		// All of them in one transaction
+      any = true;
+      FlushField(&f);
     }
-#else
-  // Slow version, no buffering
-  for (int i=0; i<width*height; i++)
-    pushColor(icon[i]);
-#endif
+  if (any) {
+    endWrite();
+    stats.transactions++;
+  }
 }
 
-void Oled::fontSize(int i) {
-  switch (i) {
-  default:	setFreeFont(&FreeSans9pt7b); break;
-  case 2:	setFreeFont(&FreeSans12pt7b); break;
-  case 3:	setFreeFont(&FreeSans18pt7b); break;
-  case 4:	setFreeFont(&FreeSans24pt7b); break;
+/*
+ * Text fields whose glyphs were (partly) filled over
+ */
+void Oled::Damage(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+  for (OledTextField &f : fields) {
+    if (f.shown[0] == 0 || f.damaged || y >= f.y + f.ascent + f.descent || y + h <= f.y)
+      continue;
+    int16_t x0 = 32767, x1 = -32768;
+    InkBox(f.font, f.shown, strlen(f.shown), f.x, &x0, &x1);
+    if (x < x1 && x + w > x0)
+      f.damaged = true;
+  }
+}
+
+/*
+ * Does another field show something in this rectangle
+ */
+boolean Oled::Covered(const OledTextField *f, int16_t x0, int16_t x1, int16_t y0, int16_t y1) {
+  for (const OledTextField &g : fields) {
+    if (&g == f || g.shown[0] == 0 || y0 >= g.y + g.ascent + g.descent || y1 <= g.y)
+      continue;
+    int16_t gx0 = 32767, gx1 = -32768;
+    InkBox(g.font, g.shown, strlen(g.shown), g.x, &gx0, &gx1);
+    if (x0 < gx1 && x1 > gx0)
+      return true;
+  }
+  return false;
+}
+
+/*
+ * Sum of the advances of the first n characters
+ */
+int Oled::TextWidth(const GFXfont *font, const char *text, int n) {
+  const GFXglyph *glyphs = (const GFXglyph *)pgm_read_ptr(&font->glyph);
+  uint16_t first = pgm_read_word(&font->first), last = pgm_read_word(&font->last);
+  int w = 0;
+
+  for (int i = 0; i < n; i++) {
+    uint8_t c = text[i];
+    if (c >= first && c <= last)
+      w += pgm_read_byte(&glyphs[c - first].xAdvance);
+  }
+  return w;
+}
+
+/*
+ * Extend [x0, x1) with the cells and the ink of n characters, the first one drawn at x
+ */
+void Oled::InkBox(const GFXfont *font, const char *text, int n, int16_t x, int16_t *x0, int16_t *x1) {
+  const GFXglyph *glyphs = (const GFXglyph *)pgm_read_ptr(&font->glyph);
+  uint16_t first = pgm_read_word(&font->first), last = pgm_read_word(&font->last);
+
+  for (int i = 0; i < n; i++) {
+    uint8_t c = text[i];
+    if (c < first || c > last)
+      continue;
+    const GFXglyph *g = &glyphs[c - first];
+    int16_t l = x + (int8_t)pgm_read_byte(&g->xOffset);
+    int16_t r = l + pgm_read_byte(&g->width);
+    int16_t adv = pgm_read_byte(&g->xAdvance);
+
+    if (l > x) l = x;
+    if (r < x + adv) r = x + adv;
+    if (l < *x0) *x0 = l;
+    if (r > *x1) *x1 = r;
+    x += adv;
+  }
+}
+
+void Oled::FlushField(OledTextField *f) {
+  const char *os = f->shown, *ns = f->text;
+  int lo = strlen(os), ln = strlen(ns);
+  boolean damaged = f->damaged;
+
+  // Common prefix, none if damaged
+  int p = 0;
+  while (! damaged && p < lo && p < ln && os[p] == ns[p])
+    p++;
+
+  // Common suffix, only useful if it doesn't move
+  int s = 0;
+  while (! damaged && s < lo - p && s < ln - p && os[lo - 1 - s] == ns[ln - 1 - s])
+    s++;
+  if (TextWidth(f->font, os, lo - s) != TextWidth(f->font, ns, ln - s))
+    s = 0;
+  f->damaged = false;
+
+  // Rectangle to redraw : everything the old and new glyphs in between touch
+  int16_t px = f->x + TextWidth(f->font, os, p);
+  int16_t x0 = 32767, x1 = -32768;
+  InkBox(f->font, os + p, lo - s - p, px, &x0, &x1);
+  InkBox(f->font, ns + p, ln - s - p, px, &x0, &x1);
+  if (x0 < 0) x0 = 0;
+  if (x1 > width()) x1 = width();
+  if (x1 - x0 > max_line) x1 = x0 + max_line;
+
+  if (x0 >= x1) {
+    strcpy(f->shown, f->text);
+    return;
+  }
+  if (! damaged && FlushSprites(f, p, px)) {
+    strcpy(f->shown, f->text);
+    return;
+  }
+  strcpy(f->shown, f->text);
+
+  // Render it a row at a time. Glyphs on either side may reach into the rectangle, so
+  // all of them are considered, and those of overlapping fields too.
+  int16_t w = x1 - x0, h = f->ascent + f->descent;
+  uint16_t line[max_line];
+  boolean covered = Covered(f, x0, x1, f->y, f->y + h);
+
+  setWindow(x0, f->y, x1 - 1, f->y + h - 1);
+  for (int16_t y = f->y; y < f->y + h; y++) {
+    memset(line, 0, w * 2);
+    if (covered)
+      for (const OledTextField &g : fields)
+        if (&g != f && y >= g.y && y < g.y + g.ascent + g.descent)
+          RenderRow(&g, g.shown, strlen(g.shown), g.x, y, x0, x1, line);
+    RenderRow(f, ns, ln, f->x, y, x0, x1, line);
+    pushColors(line, w, false);
+  }
+  stats.pixels += w * h;
+}
+
+/*
+ * Add one row (y) of the ink that n characters of text, starting at x, produce in [x0, x1).
+ * Pixels are in display byte order, the caller clears the background.
+ */
+void Oled::RenderRow(const OledTextField *f, const char *text, int n, int16_t x, int16_t y,
+    int16_t x0, int16_t x1, uint16_t *line) {
+  const GFXglyph *glyphs = (const GFXglyph *)pgm_read_ptr(&f->font->glyph);
+  const uint8_t *bitmap = (const uint8_t *)pgm_read_ptr(&f->font->bitmap);
+  uint16_t first = pgm_read_word(&f->font->first), last = pgm_read_word(&f->font->last);
+  uint16_t colour = (f->colour >> 8) | (f->colour << 8);
+  int16_t baseline = f->y + f->ascent;
+
+  for (int i = 0; i < n; i++) {
+    uint8_t c = text[i];
+    if (c < first || c > last)
+      continue;
+    const GFXglyph *g = &glyphs[c - first];
+    uint16_t bo = pgm_read_word(&g->bitmapOffset);
+    uint8_t gw = pgm_read_byte(&g->width), gh = pgm_read_byte(&g->height);
+    int16_t gl = x + (int8_t)pgm_read_byte(&g->xOffset);
+    int16_t gr = y - (baseline + (int8_t)pgm_read_byte(&g->yOffset));
+    x += pgm_read_byte(&g->xAdvance);
+
+    if (gr < 0 || gr >= gh || gl >= x1 || gl + gw <= x0)
+      continue;
+
+    // Glyph bitmaps are packed, rows aren't padded to a byte
+    uint32_t bit = gr * gw;
+    for (int16_t cx = 0; cx < gw; cx++, bit++) {
+      int16_t sx = gl + cx;
+      if (sx >= x0 && sx < x1 && (pgm_read_byte(&bitmap[bo + (bit >> 3)]) & (0x80 >> (bit & 7))))
+	line[sx - x0] = colour;
+    }
+  }
+}
+
+/*
+ * Glyph sprites
+ *
+ * For a field that shows a limited set of characters (the digits of the clock), these
+ * can be rendered once. The cell of each (its advance, times the rows any of them has ink
+ * in) is kept in display format, so a changed digit is one window and one pushColors().
+ * Only glyphs whose ink stays within their own cell qualify, so they never overlap.
+ */
+void Oled::addSprites(int field, const char *chars) {
+  if (field < 0 || field >= (int)fields.size())
+    return;
+  OledTextField *f = &fields[field];
+
+  const GFXglyph *glyphs = (const GFXglyph *)pgm_read_ptr(&f->font->glyph);
+  uint16_t first = pgm_read_word(&f->font->first), last = pgm_read_word(&f->font->last);
+
+  // Which ones qualify, and which rows do they use
+  char use[max_sprites + 1];
+  int n = 0;
+  int16_t top = f->ascent + f->descent, bottom = 0;
+  for (; *chars && n < max_sprites; chars++) {
+    uint8_t c = *chars;
+    if (c < first || c > last || memchr(use, c, n) != 0)
+      continue;
+    const GFXglyph *g = &glyphs[c - first];
+    int8_t xo = pgm_read_byte(&g->xOffset);
+    if (xo < 0 || xo + pgm_read_byte(&g->width) > pgm_read_byte(&g->xAdvance))
+      continue;
+    int16_t t = f->ascent + (int8_t)pgm_read_byte(&g->yOffset);
+    if (t < top) top = t;
+    if (t + pgm_read_byte(&g->height) > bottom) bottom = t + pgm_read_byte(&g->height);
+    use[n++] = c;
+  }
+  use[n] = 0;
+  if (n == 0 || bottom <= top)
+    return;
+
+  f->sprite_top = top;
+  f->sprite_h = bottom - top;
+  f->nsprites = 0;
+  for (int i = 0; i < n; i++) {
+    uint8_t w = pgm_read_byte(&glyphs[(uint8_t)use[i] - first].xAdvance);
+    uint16_t *p = (uint16_t *)malloc(w * f->sprite_h * 2);
+    if (p == 0) {
+      Serial.printf("Oled: no memory for sprites\n");
+      break;
+    }
+    memset(p, 0, w * f->sprite_h * 2);
+    for (int16_t r = 0; r < f->sprite_h; r++)
+      RenderRow(f, use + i, 1, 0, f->y + top + r, 0, w, p + r * w);
+    f->sprite_char[f->nsprites] = use[i];
+    f->sprite_w[f->nsprites] = w;
+    f->sprite[f->nsprites++] = p;
+  }
+  f->sprite_char[f->nsprites] = 0;
+}
+
+/*
+ * Draw the changed part of a field from sprites, if they're all there.
+ * Also the old text must be all sprites, so its ink is in the same rows.
+ */
+boolean Oled::FlushSprites(OledTextField *f, int p, int16_t px) {
+  if (f->nsprites == 0)
+    return false;
+
+  const char *os = f->shown, *ns = f->text;
+  for (const char *s = os; *s; s++)
+    if (strchr(f->sprite_char, *s) == 0)
+      return false;
+  for (const char *s = ns; *s; s++)
+    if (strchr(f->sprite_char, *s) == 0)
+      return false;
+
+  // Cells come with their background, which would wipe what another field has there
+  int16_t end = f->x + TextWidth(f->font, os, strlen(os));
+  if (end < f->x + TextWidth(f->font, ns, strlen(ns)))
+    end = f->x + TextWidth(f->font, ns, strlen(ns));
+  if (Covered(f, px, end, f->y + f->sprite_top, f->y + f->sprite_top + f->sprite_h))
+    return false;
+
+  // Blit what differs, up to the end of the new text. Cells don't overlap, so the
+  // unchanged ones around it are left alone.
+  const GFXglyph *glyphs = (const GFXglyph *)pgm_read_ptr(&f->font->glyph);
+  uint16_t first = pgm_read_word(&f->font->first);
+  int16_t x = px, ox = px, y = f->y + f->sprite_top;
+  int lo = strlen(os);
+  for (int i = p; ns[i]; i++) {
+    int k = strchr(f->sprite_char, ns[i]) - f->sprite_char;
+    int16_t w = f->sprite_w[k];
+
+    if ((i >= lo || os[i] != ns[i] || ox != x) && x + w <= width()) {
+      setWindow(x, y, x + w - 1, y + f->sprite_h - 1);
+      pushColors(f->sprite[k], w * f->sprite_h, false);
+      stats.pixels += w * f->sprite_h;
+    }
+    x += w;
+    if (i < lo)
+      ox += pgm_read_byte(&glyphs[(uint8_t)os[i] - first].xAdvance);
+  }
+
+  // The old text may have been longer
+  int16_t oend = f->x + TextWidth(f->font, os, lo);
+  if (oend > x) {
+    TFT_eSPI::fillRect(x, y, oend - x, f->sprite_h, TFT_BLACK);
+    stats.pixels += (oend - x) * f->sprite_h;
   }
+  return true;
 }
 
 void OledButton::setFillColor(uint16_t newfc) {
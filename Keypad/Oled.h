@@ -30,24 +30,106 @@
 #include <TFT_eSPI.h>
 #include <SPI.h>
 #include <vector>
+#include <preferences.h>
 
 #ifndef	_OLED_H_
 #define	_OLED_H_
 
 class OledButton;
+class OledWidget;
+struct TouchEvent;
+
+/*
+ * A line of text that gets updated in place, see Oled::setText()
+ */
+struct OledTextField {
+  int16_t	x, y;		// Top left, same as drawString()
+  const GFXfont	*font;
+  uint8_t	ascent, descent;
+  uint16_t	colour;
+  char		shown[32];	// What's on the display
+  char		text[32];	// What should be
+  boolean	damaged;	// Something was drawn over it, see Oled::fillRect()
+
+  // Pre-rendered glyphs, see Oled::addSprites()
+  int		nsprites;
+  char		sprite_char[17];
+  uint8_t	sprite_w[16];
+  uint16_t	*sprite[16];
+  int16_t	sprite_top, sprite_h;	// Rows, relative to y
+};
+
+/*
+ * A drawing operation waiting to be sent, see Oled::beginBatch(). In display coordinates.
+ */
+enum {
+  OLED_FILL,
+  OLED_RECT,
+  OLED_CIRCLE,			// Radius in w
+  OLED_FILL_CIRCLE,
+  OLED_IMAGE,			// RGB565
+  OLED_PACKED			// An Icon
+};
+
+struct OledCommand {
+  uint8_t	op;
+  int16_t	x, y;
+  uint16_t	w, h;
+  uint16_t	stride;		// Pixels from one row of data to the next
+  uint32_t	colour;
+  const void	*data;		// Not copied
+};
+
+struct OledStats {
+  uint32_t	commands;	// Drawing calls
+  uint32_t	merged;		// Of which, absorbed by the one before
+  uint32_t	transactions;	// SPI transactions to send them
+  uint32_t	pixels;		// Written, more than the screen size means overdraw
+};
 
 struct OledScreen {
   String	name;		// useful ?
   int		number;
 
-  int		nbuttons;
-  String	*buttonText;
-  void		(**buttonHandler)(struct OledScreen *, int);
+  void		(*draw)(struct OledScreen *);	// Background, optional
+  std::vector<OledWidget *>	widgets;	// Later ones are on top
+};
 
-  void		(*draw)(struct OledScreen *);
-  OledButton	**key;
+/*
+ * Display geometry and orientation, all known at compile time.
+ *
+ * Y() turns our y (0 at the bottom) into TFT_eSPI's (0 at the top), for something h pixels
+ * high. The touch panel reports raw values from TouchMin to TouchMin + TouchRange across
+ * the display; TouchX() and TouchY() scale them to pixels with a multiplication by a
+ * 16.16 constant instead of a division. Without Flip, coordinates are passed on unchanged.
+ * Another panel is another instance of the template.
+ */
+template <int16_t W, int16_t H, bool Flip, uint16_t TouchMin = 300, uint16_t TouchRange = 3460>
+struct OledGeometry {
+  static constexpr int16_t width = W;
+  static constexpr int16_t height = H;
+  static constexpr int16_t longest = (W > H) ? W : H;
+
+  static constexpr int32_t Y(int32_t y, int32_t h = 0) {
+    return Flip ? H - y - h : y;
+  }
+
+  static constexpr uint32_t Scale(int16_t size) {
+    return (((uint32_t)size << 16) + TouchRange / 2) / TouchRange;
+  }
+  static constexpr uint32_t Touch(uint16_t raw) {
+    return (raw < TouchMin) ? 0 : (raw - TouchMin > TouchRange) ? TouchRange : raw - TouchMin;
+  }
+  static constexpr uint16_t TouchX(uint16_t raw) {
+    return Flip ? W - ((Touch(raw) * Scale(W)) >> 16) : raw;
+  }
+  static constexpr uint16_t TouchY(uint16_t raw) {
+    return Flip ? H - ((Touch(raw) * Scale(H)) >> 16) : raw;
+  }
 };
 
+typedef OledGeometry<TFT_WIDTH, TFT_HEIGHT, true> OledPanel;
+
 class Oled : public TFT_eSPI {
   public:
     // Generic Arduino functions
@@ -66,25 +148,42 @@ class Oled : public TFT_eSPI {
     void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color);
     void fillScreen(uint32_t color);
 
+    // Queue drawing commands, and send them all at once
+    void beginBatch();
+    void endBatch();
+    OledStats getStats(boolean reset = true);
+    void snapshot(Print *out);
+
     // Get touch input
     uint8_t getTouchRaw(uint16_t *x, uint16_t *y);
     uint16_t getTouchRawZ(void);
     uint8_t getTouch(uint16_t *x, uint16_t *y);
+    static void Touched(void *pw, const TouchEvent *ev);
 
     // Control backlight
     void setLED(int tm);
 
     // Handle screens
     int addScreen(OledScreen screen);
+    int addWidget(int screen, OledWidget *widget);
     void showScreen(int);
     boolean isScreenVisible(int);
+    void update();
 
     // Draw images
     void drawIcon(const uint16_t *icon, int16_t x, int16_t y, uint16_t width, uint16_t height);
+    void drawIcon(const uint16_t *icon, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t stride);
+    void drawIcon(const uint8_t *icon, int16_t x, int16_t y);
 
     // My font size selector
     void fontSize(int i);
 
+    // Text fields : only the glyphs that change are sent to the display
+    int addTextField(int16_t x, int16_t y, int font, uint16_t colour = TFT_WHITE);
+    void addSprites(int field, const char *chars);
+    void setText(int field, const char *text);
+    void flush();
+
   private:
     int verbose;
     int	led_state;
@@ -93,13 +192,51 @@ class Oled : public TFT_eSPI {
     int curr_screen;	// screen number currently shown
 
     std::vector<OledScreen> screens;
+    std::vector<OledTextField> fields;
 
-    void showScreenButtons(int);
     OledScreen *current;
+    OledWidget *pressed;	// Gets the rest of the touch
+
+    // Which widgets are in each part of the screen, bit i is current->widgets[i]
+    static const int max_widgets = 32;
+    static const int grid_cols = 4, grid_rows = 4;
+    uint32_t grid[grid_rows][grid_cols];
+    void BuildGrid();
+    OledWidget *HitTest(int16_t x, int16_t y);
 
     static const unsigned int OLED_BS = 64;
+    uint16_t pixbuf[OLED_BS] __attribute__((aligned(4)));	// Word aligned for pixels_565_swap
+
+    static const int max_queue = 32;
+    OledCommand queue[max_queue];
+    int nqueue;
+    boolean batching;
+    OledStats stats;
+
+    void Queue(uint8_t op, int16_t x, int16_t y, uint16_t w, uint16_t h, uint32_t colour,
+      const void *data = 0, uint16_t stride = 0);
+    boolean Merge(const OledCommand *c);
+    void Drain();
+    void Run(const OledCommand *c);
+    void RunImage(const OledCommand *c);
+    void RunPacked(const OledCommand *c);
+
+    static const int max_line = OledPanel::longest;
+    static const int max_sprites = 16;		// Per text field
+
+    static const GFXfont *Font(int i);
+    int TextWidth(const GFXfont *font, const char *text, int n);
+    void InkBox(const GFXfont *font, const char *text, int n, int16_t x, int16_t *x0, int16_t *x1);
+    void Damage(int16_t x, int16_t y, uint16_t w, uint16_t h);
+    boolean Covered(const OledTextField *f, int16_t x0, int16_t x1, int16_t y0, int16_t y1);
+    void FlushField(OledTextField *f);
+    boolean FlushSprites(OledTextField *f, int p, int16_t px);
+    void RenderRow(const OledTextField *f, const char *text, int n, int16_t x, int16_t y,
+      int16_t x0, int16_t x1, uint16_t *line);
 };
 
+extern Oled *oled;
+
 /*
  * Class ported from the Adafruit_GFX library into TFT_eSPI.
  * Believed to be compatible with the original.
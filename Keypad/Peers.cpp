@@ -52,7 +52,12 @@ using namespace std;
 #include <Config.h>
 #include <ArduinoJson.h>
 #include <Alarm.h>
+#include <Sensors.h>
+#include <Rfid.h>
+#include <Journal.h>
 #include <Weather.h>
+#include <IconCache.h>
+#include <Icon.h>
 
 #include <PubSubClient.h>
 #include <RCSwitch.h>
@@ -67,7 +72,8 @@ extern "C" {
 
 // These used to be in the class, but need to be global for the background task
 const uint16_t portImage = 23457;		// contact this to query weather icon
-uint16_t	*tskPic, tskWid, tskHt;
+const uint8_t	*tskIcon;
+int		tskLen;
 
 // For MQTT
 WiFiClient	wifiClient;
@@ -84,7 +90,8 @@ WiFiServer	*imageTaskSrv;
 
 Peers::Peers() {
   image_host = 0;
-  image_port = image_wid = image_ht = 0;
+  image_port = image_wid = image_ht = image_len = 0;
+  image_key = 0;
 
 #ifdef ESP32
   imageTask = 0;
@@ -287,6 +294,13 @@ char *Peers::CallPeer(Peer *peer, char *json) {
  * Note : per-node queries have topic /alarm/node/%node-name%, e.g. /alarm/node/kitchen
  *
  *********************************************************************************/
+/*
+ * One line per sensor, a table doesn't fit in an MQTT message
+ */
+static void mqttSensorRow(const char *row) {
+  mqtt.publish("/alarm/sensors", row);
+}
+
 void mqttCallback(char *topic, byte *payload, unsigned int length) {
   char reply[80], pl[80];
   extern void mqttMyNodeCallback(char *);
@@ -317,9 +331,12 @@ void mqttCallback(char *topic, byte *payload, unsigned int length) {
         mqtt.publish("/alarm", msg);
       }
     } else if (strcmp(pl, "arm") == 0) {
-        _alarm->SetArmed(ALARM_ON, ZONE_FROMPEER);
+        _alarm->SetArmed(ALARM_ON, ZONE_FROMPEER, "mqtt");
     } else if (strcmp(pl, "disarm") == 0) {
-        _alarm->SetArmed(ALARM_OFF, ZONE_FROMPEER);
+        _alarm->SetArmed(ALARM_OFF, ZONE_FROMPEER, "mqtt");
+    } else if (strcmp(pl, "sensors") == 0) {
+      if (sensors)
+        sensors->Report(mqttSensorRow);
     } else if (strcmp(pl, "network") == 0) {
       IPAddress ip = WiFi.localIP();
       String ips = ip.toString();
@@ -398,6 +415,23 @@ void Peers::RestLoop() {
     // Serial.printf("JSON query %s\n", query);
   }
 
+  // Binary replies : {"snapshot" : true} gets a PPM image of the display,
+  // {"journal" : true} the event log (see tools/journal.c).
+  if (len > 0) {
+    DynamicJsonBuffer jb;
+    JsonObject &json = jb.parseObject((const char *)query);
+    if (json.success() && oled && json.containsKey("snapshot")) {
+      oled->snapshot(&client);
+      client.stop();
+      return;
+    }
+    if (json.success() && journal && json.containsKey("journal")) {
+      journal->Dump(&client);
+      client.stop();
+      return;
+    }
+  }
+
   char *reply = HandleQuery((const char *)query);
 
   // Answer
@@ -420,7 +454,7 @@ void ImageTaskLoop(void *ptr) {
     if (! client) {
       delay(50);
     } else {
-      int len = client.write((uint8_t *)tskPic, tskWid * tskHt * 2);
+      int len = client.write(tskIcon, tskLen);
       // Serial.printf("Peers::ImageTaskLoop: wrote %d\n", len);
       client.stop();
     }
@@ -438,10 +472,9 @@ void Peers::StopTask() {
 }
 #endif
 
-void Peers::StoreImage(uint16_t *pic, uint16_t wid, uint16_t ht) {
-  tskPic = pic;
-  tskWid = wid;
-  tskHt = ht;
+void Peers::StoreImage(const uint8_t *icon) {
+  tskIcon = icon;
+  tskLen = icon ? Icon::Size(icon) : 0;
 }
 
 /*
@@ -472,14 +505,14 @@ char *Peers::HandleQuery(const char *str) {
       _alarm->Signal(sensor_name, ZONE_FROMPEER);
     } else if (strcmp(query, "armed")) {
       // {"status" : "armed", "name" : "keypad02"}
-      _alarm->SetArmed(ALARM_ON, ZONE_FROMPEER);
+      _alarm->SetArmed(ALARM_ON, ZONE_FROMPEER, device_name);
     } else if (strcmp(query, "disarmed")) {
       // {"status" : "disarmed", "name" : "keypad02"}
-      _alarm->SetArmed(ALARM_OFF, ZONE_FROMPEER);
+      _alarm->SetArmed(ALARM_OFF, ZONE_FROMPEER, device_name);
       _alarm->Reset(device_name);
     } else if (strcmp(query, "reset")) {
       // {"status" : "reset", "name" : "keypad02"}
-      _alarm->SetArmed(ALARM_OFF, ZONE_FROMPEER);
+      _alarm->SetArmed(ALARM_OFF, ZONE_FROMPEER, device_name);
       _alarm->Reset(device_name);
     } else {
       return (char *)"{ \"reply\" : \"error\", \"message\" : \"Invalid query\" }";
@@ -549,6 +582,16 @@ char *Peers::HandleQuery(const char *str) {
     //   p->weather ? 1 : 0, p->radio ? 1 : 0,
     //   p->siren ? 1 : 0, p->secure ? 1 : 0);
     return 0;
+  } else if ((query = json["query"]) && strcmp(query, "sensors") == 0) {
+    // {"query" : "sensors"}
+    if (sensors == 0)
+      return (char *)"{ \"reply\" : \"error\", \"message\" : \"No sensors\" }";
+    return (char *)sensors->Table();
+  } else if ((query = json["cards"]) && strcmp(query, "reload") == 0) {
+    // {"cards" : "reload"} after uploading a new card table
+    if (rfid == 0 || ! rfid->Load(PREF_RFID_CARDS_FN))
+      return (char *)"{ \"reply\" : \"error\", \"message\" : \"No card table\" }";
+    return (char *)"{ \"reply\" : \"ok\" }";
   } else if (query = json["query"]) {		// Client requests weather info from central node
     IPAddress remote = mcsrv.remoteIP();
     char *json = weather->CreatePeerMessage();
@@ -681,20 +724,24 @@ void Peers::SendWeather(const char *json) {
 }
 
 /*
- * Send a raw image (converted GIF) to our peers, in a format immediately suitable for display.
- * Do this in chunks so buffers don't swallow all available memory, and we can use JSON.
+ * Announce a packed icon (converted GIF, see Icon.cpp) to our peers. They fetch it over TCP
+ * from the image task, it's sent as is so it's immediately suitable for display.
+ *
+ * The key identifies the icon (see IconCache), peers that already have it don't need to
+ * transfer the image again.
  */
-void Peers::SendImage(uint16_t *pic, uint16_t wid, uint16_t ht) {
-  // Any pixel is 16 bits. Transmission as hex string means 4 characters for this, e.g. 0xABCD .
-  // To keep below the limit, we'll send JSON max buffer length divided by 4, minus 80.
+void Peers::SendImage(const uint8_t *icon, uint32_t key) {
+  if (icon == 0)
+    return;
 
-  // Store the image and its dimensions
-  StoreImage(pic, wid, ht);
+  // Store the image, the image task serves it
+  StoreImage(icon);
 
-  // packet format : { "image" : offset, "w" : width, "h" : height, "host" : ip, "port" : port }
+  // packet format : { "image" : offset, "w" : width, "h" : height, "len" : bytes, "host" : ip,
+  //                   "port" : port, "key" : "hex" }
   sprintf((char *)packetBuffer,
-    "{\"image\": %d, \"w\": %d, \"h\": %d, \"host\": %s, \"port\" : %d }",
-    0, wid, ht, local.toString().c_str(), portImage);
+    "{\"image\": %d, \"w\": %d, \"h\": %d, \"len\": %d, \"host\": %s, \"port\" : %d, \"key\" : \"%08x\" }",
+    0, Icon::Width(icon), Icon::Height(icon), Icon::Size(icon), local.toString().c_str(), portImage, key);
   // Serial.printf("SendImage -> %s\n", packetBuffer);
   CallPeers((char *)packetBuffer);
 }
@@ -707,16 +754,22 @@ void Peers::SendImage(uint16_t *pic, uint16_t wid, uint16_t ht) {
 void Peers::ImageFromPeerBinary(const char *query, JsonObject &json, uint16_t port) {
   image_wid = json["w"];
   image_ht = json["h"];
+  image_len = json["len"];
   image_host = (json["host"]) ? strdup(json["host"]) : 0;
   image_port = port;
+
+  const char *key = json["key"];
+  image_key = key ? strtoul(key, 0, 16) : 0;
 }
 
 // port is not used
-void Peers::ImageFromPeerBinary(IPAddress ip, uint16_t port, uint16_t wid, uint16_t ht) {
+void Peers::ImageFromPeerBinary(IPAddress ip, uint16_t port, uint16_t wid, uint16_t ht, uint16_t len) {
   image_wid = wid;
   image_ht = ht;
+  image_len = len;
   image_host = strdup(ip.toString().c_str());
   image_port = portImage;
+  image_key = 0;
 }
 
 /*
@@ -726,6 +779,16 @@ void Peers::ImageFromPeerBinary(IPAddress ip, uint16_t port, uint16_t wid, uint1
 void Peers::ImageFromPeerBinaryAsync() {
   // Serial.printf("Peers::ImageFromPeerBinaryAsync(%s : %d) ... ", image_host, image_port);
 
+  // Maybe we already have this one
+  if (iconcache && image_key) {
+    uint8_t *icon = iconcache->Get(image_key);
+    if (icon) {
+      if (weather) weather->drawIcon(icon);
+      else free(icon);
+      return;
+    }
+  }
+
   WiFiClient	client;
   int		error;
   if (! (error = client.connect(image_host, image_port))) {
@@ -733,14 +796,16 @@ void Peers::ImageFromPeerBinaryAsync() {
     Serial.printf("failed, error %d\n", error);
     return;
   }
-  uint16_t nb = image_wid * image_ht * 2;
+  // Older nodes send RGB565
+  uint16_t nb = image_len ? image_len : image_wid * image_ht * 2;
   uint8_t *buf = (uint8_t *)malloc(nb);
   if (buf == 0) {
     Serial.printf("ImageFromPeerBinary: malloc(%d) failed\n", nb);
+    client.stop();
     return;
   }
   int cnt = 0, len;
-  while (cnt < nb) {
+  while (cnt < nb && (client.connected() || client.available())) {
     // Serial.printf("Reading %d\n", nb-cnt);
     len = client.read(buf+cnt, nb-cnt);
     if (len >= 0) cnt += len;
@@ -751,8 +816,23 @@ void Peers::ImageFromPeerBinaryAsync() {
   // Serial.printf("done\n");
   // Serial.printf("done (%d bytes read)\n", cnt);
 
-  if (weather) weather->drawIcon((uint16_t *)buf, image_wid, image_ht);
-  // Don't free(buf) here, this is used&freed in Weather::drawIcon.
+  uint8_t *icon = buf;
+  if (image_len == 0 && cnt == nb) {
+    icon = Icon::Pack((uint16_t *)buf, image_wid, image_ht);
+    free(buf);
+  } else if (! Icon::Valid(buf, cnt)) {
+    Serial.printf("ImageFromPeerBinary: bad icon (%d bytes)\n", cnt);
+    free(buf);
+    return;
+  }
+  if (icon == 0)
+    return;
+
+  if (iconcache)
+    iconcache->Put(image_key, icon);
+  if (weather) weather->drawIcon(icon);
+  else free(icon);
+  // Otherwise don't free(icon) here, this is used&freed in Weather::drawIcon.
 }
 
 int cnt = 3;
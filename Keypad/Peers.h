@@ -57,11 +57,11 @@ public:
   void AlarmReset(const char *user);		// Pass the user name
 
   void SendWeather(const char *json);
-  void SendImage(uint16_t *pic, uint16_t wid, uint16_t ht);
+  void SendImage(const uint8_t *icon, uint32_t key);
   Peer *FindWeatherNode();
   char *CallPeer(Peer *, char *json);
   void CallPeer0(Peer *, char *json);
-  void ImageFromPeerBinary(IPAddress ip, uint16_t port, uint16_t wid, uint16_t ht);
+  void ImageFromPeerBinary(IPAddress ip, uint16_t port, uint16_t wid, uint16_t ht, uint16_t len);
   void Report(const char *msg);
 
   void StopTask();
@@ -102,11 +102,13 @@ private:
   void mqttReconnect();
   void mqttSubscribe();
 
-  void StoreImage(uint16_t *pic, uint16_t wid, uint16_t ht);
+  void StoreImage(const uint8_t *icon);
 
   // If this is inited, need to grab the image
   uint16_t	image_wid, image_ht, image_port;
+  uint16_t	image_len;			// Packed icon size, 0 for RGB565 from older nodes
   char		*image_host;
+  uint32_t	image_key;			// IconCache key, 0 if unknown
 
   //
   void AlarmSetReset(const char *state, const char *user);
@@ -0,0 +1,174 @@
+/*
+ * Pixel conversion kernels
+ *
+ * These work a 32 bit word at a time (two RGB565 pixels, or four palette indices) rather
+ * than a byte at a time. The ESP cannot do unaligned word accesses, so a leading pixel is
+ * done separately when needed, and buffers whose alignment differs take the slow path.
+ *
+ * When built on Linux with SSE2 (host tools), the RGBA and byte swap kernels do eight
+ * pixels per step instead. There is no gather in SSE2, so palette lookups stay as they are.
+ * PIXELS_NO_SSE2 turns that off, PIXELS_SCALAR does everything a pixel at a time : both
+ * only so tools/gif/pixbench can compare them.
+ *
+ * All of this assumes a little endian machine, as both the ESPs and PCs are.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdint.h>
+#include "Pixels.h"
+
+#if defined(__linux__) && defined(__SSE2__) && !defined(PIXELS_NO_SSE2) && !defined(PIXELS_SCALAR)
+# define PIXELS_SSE2
+# include <emmintrin.h>
+#endif
+
+// Word access to pixel buffers declared as something else
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+static inline uint16_t rgba_to_565(uint32_t w) {
+  return ((w << 8) & 0xF800)		// red, bits 0..7
+       | ((w >> 5) & 0x07E0)		// green, bits 8..15
+       | ((w >> 19) & 0x001F);		// blue, bits 16..23
+}
+
+static inline uint16_t swap16(uint16_t p) {
+  return (p << 8) | (p >> 8);
+}
+
+void pixels_rgba_to_565(uint16_t *dst, const uint32_t *src, unsigned int n) {
+#ifdef PIXELS_SSE2
+  const __m128i red = _mm_set1_epi32(0xF800);
+  const __m128i green = _mm_set1_epi32(0x07E0);
+  const __m128i blue = _mm_set1_epi32(0x001F);
+
+  for (; n >= 8; n -= 8, src += 8, dst += 8) {
+    __m128i a = _mm_loadu_si128((const __m128i *)src);
+    __m128i b = _mm_loadu_si128((const __m128i *)(src + 4));
+
+    a = _mm_or_si128(_mm_or_si128(
+	  _mm_and_si128(_mm_slli_epi32(a, 8), red),
+	  _mm_and_si128(_mm_srli_epi32(a, 5), green)),
+	  _mm_and_si128(_mm_srli_epi32(a, 19), blue));
+    b = _mm_or_si128(_mm_or_si128(
+	  _mm_and_si128(_mm_slli_epi32(b, 8), red),
+	  _mm_and_si128(_mm_srli_epi32(b, 5), green)),
+	  _mm_and_si128(_mm_srli_epi32(b, 19), blue));
+
+    // Sign extend the low halves so the saturating pack keeps them intact
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    _mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(a, b));
+  }
+#elif !defined(PIXELS_SCALAR)
+  if (n && ((uintptr_t)dst & 2)) {
+    *dst++ = rgba_to_565(*src++);
+    n--;
+  }
+
+  word_t *d = (word_t *)dst;
+  for (; n >= 2; n -= 2, src += 2)
+    *d++ = rgba_to_565(src[0]) | ((uint32_t)rgba_to_565(src[1]) << 16);
+  dst = (uint16_t *)d;
+#endif
+
+  while (n--)
+    *dst++ = rgba_to_565(*src++);
+}
+
+void pixels_565_swap(uint16_t *dst, const uint16_t *src, unsigned int n) {
+#ifdef PIXELS_SSE2
+  for (; n >= 8; n -= 8, src += 8, dst += 8) {
+    __m128i a = _mm_loadu_si128((const __m128i *)src);
+    _mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8)));
+  }
+#elif !defined(PIXELS_SCALAR)
+  if ((((uintptr_t)dst ^ (uintptr_t)src) & 2) == 0) {
+    if (n && ((uintptr_t)dst & 2)) {
+      *dst++ = swap16(*src++);
+      n--;
+    }
+
+    word_t *d = (word_t *)dst;
+    const word_t *s = (const word_t *)src;
+    for (; n >= 2; n -= 2) {
+      uint32_t w = *s++;
+      *d++ = ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+    }
+    dst = (uint16_t *)d;
+    src = (const uint16_t *)s;
+  }
+#endif
+
+  while (n--)
+    *dst++ = swap16(*src++);
+}
+
+void pixels_palette_to_565(uint16_t *dst, const uint8_t *src, unsigned int n, const uint16_t *palette) {
+#ifndef PIXELS_SCALAR
+  // Get src word aligned
+  while (n && ((uintptr_t)src & 3)) {
+    *dst++ = palette[*src++];
+    n--;
+  }
+
+  const word_t *s = (const word_t *)src;
+  if (((uintptr_t)dst & 2) == 0) {
+    word_t *d = (word_t *)dst;
+    for (; n >= 4; n -= 4) {
+      uint32_t w = *s++;
+      *d++ = palette[w & 0xFF] | ((uint32_t)palette[(w >> 8) & 0xFF] << 16);
+      *d++ = palette[(w >> 16) & 0xFF] | ((uint32_t)palette[w >> 24] << 16);
+    }
+    dst = (uint16_t *)d;
+  } else {
+    for (; n >= 4; n -= 4) {
+      uint32_t w = *s++;
+      *dst++ = palette[w & 0xFF];
+      *dst++ = palette[(w >> 8) & 0xFF];
+      *dst++ = palette[(w >> 16) & 0xFF];
+      *dst++ = palette[w >> 24];
+    }
+  }
+  src = (const uint8_t *)s;
+#endif
+
+  while (n--)
+    *dst++ = palette[*src++];
+}
+
+void pixels_palette4_to_565(uint16_t *dst, const uint8_t *src, unsigned int n, const uint16_t *palette) {
+#ifndef PIXELS_SCALAR
+  if (((uintptr_t)dst & 2) == 0) {
+    word_t *d = (word_t *)dst;
+    for (; n >= 2; n -= 2, src++)
+      *d++ = palette[*src >> 4] | ((uint32_t)palette[*src & 0x0F] << 16);
+    dst = (uint16_t *)d;
+  } else
+#endif
+  {
+    for (; n >= 2; n -= 2, src++) {
+      *dst++ = palette[*src >> 4];
+      *dst++ = palette[*src & 0x0F];
+    }
+  }
+
+  if (n)
+    *dst = palette[*src >> 4];
+}
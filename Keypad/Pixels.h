@@ -0,0 +1,57 @@
+/*
+ * Pixel conversion kernels
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_PIXELS_H_
+#define	_PIXELS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * RGBA8888 (bytes r, g, b, a in memory, as libnsgif writes them) to RGB565
+ */
+void pixels_rgba_to_565(uint16_t *dst, const uint32_t *src, unsigned int n);
+
+/*
+ * Swap the bytes of RGB565 pixels, the display wants them big endian.
+ * dst and src may be the same.
+ */
+void pixels_565_swap(uint16_t *dst, const uint16_t *src, unsigned int n);
+
+/*
+ * Look up palette indices, palette holds RGB565
+ */
+void pixels_palette_to_565(uint16_t *dst, const uint8_t *src, unsigned int n, const uint16_t *palette);
+
+/*
+ * Same for 4 bit indices, two per byte with the first pixel in the high nibble
+ */
+void pixels_palette4_to_565(uint16_t *dst, const uint8_t *src, unsigned int n, const uint16_t *palette);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _PIXELS_H_ */
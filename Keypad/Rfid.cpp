@@ -5,6 +5,10 @@
  * In both cases, a list of cards is checked, the alarm can be unlocked/reset/armed
  * based on this authentication.
  *
+ * Cards come from secrets.h (a few, kept in RAM) and from a table on SPIFFS (could be
+ * thousands, made with tools/cards.c). Both are sorted by UID, so a card is found with
+ * a binary search. The SPIFFS table is read in place, only a dozen records per lookup.
+ *
  * Copyright (c) 2017, 2018 Danny Backx
  *
  * License (GNU Lesser General Public License) :
@@ -33,8 +37,14 @@
 #include <secrets.h>
 #include <Alarm.h>
 #include <Config.h>
+#include <preferences.h>
+#if defined(ESP32)
+# include <SPIFFS.h>
+#endif
 
 Rfid::Rfid() {
+  nbuiltin = nfile = 0;
+
   // Serial.println("Before MFRC522 CTOR"); delay(200);
   mfrc522 = new MFRC522(config->GetRfidSsPin(), config->GetRfidRstPin());
   // Serial.println("After MFRC522 CTOR"); delay(200);
@@ -92,15 +102,9 @@ Rfid::Rfid() {
   AddCard(RFID_16_ID, RFID_16_NAME);
 #endif
 
-  // Serial.println("After 6x AddCard"); delay(200);
+  Load(PREF_RFID_CARDS_FN);
 
-  int count = 0;
-  list<rfidcard>::iterator card = cardlist.begin();
-  while (card != cardlist.end()) {
-    card++; count++;
-  }
-
-  Serial.printf("There are %d cards in the list\n", count);
+  Serial.printf("There are %d cards in the list\n", Count());
 }
 
 void Rfid::loop(time_t nowts) {
@@ -115,12 +119,24 @@ void Rfid::loop(time_t nowts) {
   }
   mfrc522->PICC_HaltA();
 
-  for (rfidcard card : cardlist) {
-    if (card.uid.size == mfrc522->uid.size
-     && memcmp(card.uid.uidByte, mfrc522->uid.uidByte, card.uid.size) == 0) {
-      Serial.printf("Card recognized : %s\n", card.user);
+  RfidCard card;
+  if (Find(&mfrc522->uid, &card)) {
+    char user[sizeof(card.user) + 1];
+    memcpy(user, card.user, sizeof(card.user));
+    user[sizeof(card.user)] = 0;
+
+    // Without the time, a card with a validity window can't be checked
+    boolean valid = (card.from == 0 || (nowts > 1000 && nowts >= (time_t)card.from))
+      && (card.until == 0 || (nowts > 1000 && nowts < (time_t)card.until));
+    int need = (_alarm->GetArmed() == ALARM_OFF) ? RFID_ARM : RFID_DISARM;
 
-      _alarm->Toggle(nowts, card.user);
+    if (! valid) {
+      Serial.printf("Card %s is not valid now\n", user);
+    } else if ((card.actions & need) == 0) {
+      Serial.printf("Card %s may not %s\n", user, (need == RFID_ARM) ? "arm" : "disarm");
+    } else {
+      Serial.printf("Card recognized : %s\n", user);
+      _alarm->Toggle(nowts, user);
     }
   }
 
@@ -136,36 +152,131 @@ void Rfid::loop(time_t nowts) {
 }
 
 /*
- * Add a card to our known cards list
+ * Order of the tables : size first, then the UID bytes
+ */
+static int Compare(const RfidCard *a, const RfidCard *b) {
+  return memcmp(a, b, sizeof(a->size) + sizeof(a->uid));
+}
+
+/*
+ * Add a card to our known cards list, keeping it sorted
  * Cope with NULL or "" (these are arguments to ignore)
  */
 void Rfid::AddCard(const char *id, const char *name) {
   if (id == 0 || strlen(id) == 0) return;
   if (name == 0 || strlen(name) == 0) return;
+  if (nbuiltin == sizeof(builtin) / sizeof(builtin[0])) {
+    Serial.printf("Rfid: no room for card %s\n", name);
+    return;
+  }
 
-  rfidcard *card = new rfidcard(id, name);
-  cardlist.push_back(*card);
-}
-
-/*
- * Add a card
- */
-rfidcard::rfidcard(const char *id, const char *name) {
+  RfidCard	card;
   const char	*ptr = id;
   int		n = 3, r;
 
-  for (int i=0; i<sizeof(uid.uidByte); i++)
-    uid.uidByte[i] = 0;
-  for (int i=0; true; i++) {
+  memset(&card, 0, sizeof(card));
+  for (int i=0; i<sizeof(card.uid); i++) {
     unsigned int x;
     r = sscanf(ptr, "%02x %n", &x, &n);
-    uid.size = i;
-
     if (r <= 0) break;
 
-    uid.uidByte[i] = x;
+    card.uid[i] = x;
+    card.size = i + 1;
     ptr += n;
   }
-  user = (char *)name;
-  Serial.printf("rfidcard ctor(%s,%s), size %d\n", id, name, uid.size);
+  card.actions = RFID_ALL;
+  strncpy(card.user, name, sizeof(card.user));
+  Serial.printf("Rfid: card %s (%s), size %d\n", name, id, card.size);
+
+  int i = nbuiltin++;
+  for (; i > 0 && Compare(&card, &builtin[i-1]) < 0; i--)
+    builtin[i] = builtin[i-1];
+  builtin[i] = card;
+}
+
+/*
+ * (Re)open the card table on SPIFFS. Can be called again after uploading a new one.
+ */
+boolean Rfid::Load(const char *fn) {
+  RfidCard prev, card;
+
+  if (f)
+    f.close();
+  nfile = 0;
+
+  SPIFFS.begin();
+  if (! SPIFFS.exists(fn))
+    return false;
+  f = SPIFFS.open(fn, "r");
+  if (!f) {
+    Serial.printf("Rfid: could not open %s\n", fn);
+    return false;
+  }
+  if (f.size() % sizeof(RfidCard) != 0) {
+    Serial.printf("Rfid: %s has the wrong size, ignored\n", fn);
+    f.close();
+    return false;
+  }
+
+  // The lookup depends on the order, so check it once
+  int n = f.size() / sizeof(RfidCard);
+  for (int i = 0; i < n; i++) {
+    if (! Read(i, &card) || (i > 0 && Compare(&prev, &card) >= 0)) {
+      Serial.printf("Rfid: %s is not sorted at card %d, ignored\n", fn, i);
+      f.close();
+      return false;
+    }
+    prev = card;
+  }
+  nfile = n;
+  Serial.printf("Rfid: %d cards in %s\n", nfile, fn);
+  return true;
+}
+
+boolean Rfid::Read(int i, RfidCard *card) {
+  if (! f.seek(i * sizeof(RfidCard)))
+    return false;
+  return f.read((uint8_t *)card, sizeof(RfidCard)) == sizeof(RfidCard);
+}
+
+boolean Rfid::Find(const MFRC522::Uid *uid, RfidCard *card) {
+  RfidCard key;
+
+  if (uid->size > sizeof(key.uid))
+    return false;
+  memset(&key, 0, sizeof(key));
+  key.size = uid->size;
+  memcpy(key.uid, uid->uidByte, uid->size);
+
+  int lo = 0, hi = nbuiltin;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2, c = Compare(&key, &builtin[mid]);
+    if (c == 0) {
+      *card = builtin[mid];
+      return true;
+    }
+    if (c < 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+
+  lo = 0, hi = nfile;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (! Read(mid, card))
+      return false;
+    int c = Compare(&key, card);
+    if (c == 0)
+      return true;
+    if (c < 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return false;
+}
+
+int Rfid::Count() {
+  return nbuiltin + nfile;
 }
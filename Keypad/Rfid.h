@@ -20,17 +20,30 @@
  *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#ifndef	_RFID_H_
+#define	_RFID_H_
+
 #include <SPI.h>
 #include <MFRC522.h>
+#include <FS.h>
 
-#include <list>
-using namespace std;
-
-struct rfidcard {
-  char *user;
-  MFRC522::Uid uid;
+// What a card may do
+enum RfidAction {
+  RFID_ARM =	0x01,
+  RFID_DISARM =	0x02,
+  RFID_ALL =	0xFF,
+};
 
-  rfidcard(const char *, const char *);
+/*
+ * One card, 32 bytes. Keep in sync with tools/cards.c .
+ * Tables are sorted on the first 11 bytes (size, then the UID padded with zeroes).
+ */
+struct RfidCard {
+  uint8_t	size;		// As in MFRC522::Uid
+  uint8_t	uid[10];
+  uint8_t	actions;	// RfidAction bits
+  uint32_t	from, until;	// Valid between these (time_t), 0 for no limit
+  char		user[12];	// Not terminated if it fills the field
 };
 
 class Rfid {
@@ -38,8 +51,23 @@ class Rfid {
     Rfid();
     void loop(time_t nowts);
     void AddCard(const char *id, const char *name);
+    boolean Load(const char *fn);
+    boolean Find(const MFRC522::Uid *uid, RfidCard *card);
+    int Count();
 
   private:
     MFRC522	*mfrc522;
-    list<rfidcard> cardlist;
+
+    // From secrets.h, in RAM
+    RfidCard	builtin[16];
+    int		nbuiltin;
+
+    // From SPIFFS, looked up in place
+    File	f;
+    int		nfile;
+
+    boolean Read(int i, RfidCard *card);
 };
+
+extern Rfid *rfid;
+#endif	/* _RFID_H_ */
@@ -27,6 +27,8 @@
 #include <secrets.h>
 #include <Config.h>
 #include <Alarm.h>
+#include <Peers.h>
+#include <preferences.h>
 
 #include <list>
 using namespace std;
@@ -34,6 +36,12 @@ using namespace std;
 #include <RCSwitch.h>
 
 Sensors::Sensors() {
+  head = tail = 0;
+  overflows = reported = 0;
+  holdoff_us = PREF_SENSOR_HOLDOFF * 1000UL;
+  start_ts = last_sweep = now_ts = 0;
+  table = 0;
+
   // 
   radioPin = config->GetRadioPin();
 #if defined(ESP8266)
@@ -51,6 +59,7 @@ Sensors::Sensors() {
   //
   radio = new RCSwitch();
   radio->enableReceive(radioPin);
+  poll_timer.attach_ms(PREF_RADIO_POLL, Poll, this);
 
   // Add sensors predefined in secrets.h
   AddSensor(SENSOR_1_ID, SENSOR_1_NAME, SENSOR_1_ZONE);
@@ -71,6 +80,9 @@ Sensors::Sensors() {
 }
 
 Sensors::~Sensors() {
+  poll_timer.detach();
+  if (table)
+    free(table);
 }
 
 AlarmZone Sensors::AlarmZone2Zone(const char *zone) {
@@ -83,7 +95,7 @@ AlarmZone Sensors::AlarmZone2Zone(const char *zone) {
   return r;
 }
 
-void Sensors::AddSensor(int id, const char *name, const char *zone) {
+void Sensors::AddSensor(int id, const char *name, const char *zone, time_t interval) {
   if (id == 0)
     return;	// an undefined sensor
 
@@ -93,28 +105,185 @@ void Sensors::AddSensor(int id, const char *name, const char *zone) {
   sp->id = id;
   sp->name = (char *)name;
   sp->zone = AlarmZone2Zone(zone);
+  sp->active = false;
+  sp->last_us = 0;
+  sp->repeats = 0;
+  sp->last_seen = 0;
+  sp->triggers = 0;
+  sp->interval = interval;
+  sp->silent = false;
   sensorlist.push_back(*sp);
 }
 
 /*
- * Report environmental information periodically
+ * RCSwitch keeps only the last code it received, so pick codes up from a timer rather than
+ * waiting for loop(), which may be busy for a while (weather query, icon decoding).
+ * On ESP32 the timer preempts the loop. On ESP8266 it runs whenever the loop yields.
+ */
+void Sensors::Poll(Sensors *sensors) {
+  RCSwitch *radio = sensors->radio;
+
+  if (! radio->available())
+    return;
+
+  uint8_t n = (sensors->tail + 1) % queue_size;
+  if (n == sensors->head)
+    sensors->overflows++;
+  else {
+    volatile SensorEvent *e = &sensors->queue[sensors->tail];
+    e->code = radio->getReceivedValue();
+    e->bits = radio->getReceivedBitlength();
+    e->protocol = radio->getReceivedProtocol();
+    e->us = micros();
+    __sync_synchronize();		// Entry complete before loop() can see it
+    sensors->tail = n;
+  }
+  radio->resetAvailable();
+}
+
+uint32_t Sensors::GetOverflows() {
+  return overflows;
+}
+
+/*
+ * Codes from a sensor within this time of the previous one are repeats, not a new trigger
+ */
+void Sensors::SetHoldOff(uint32_t ms) {
+  holdoff_us = ms * 1000UL;
+}
+
+/*
+ * Handle everything the radio picked up since last time
  */
 void Sensors::loop(time_t nowts) {
-  int sv;
+  while (head != tail) {
+    __sync_synchronize();
+    SensorEvent e;
+    e.code = queue[head].code;
+    e.bits = queue[head].bits;
+    e.protocol = queue[head].protocol;
+    e.us = queue[head].us;
+    head = (head + 1) % queue_size;
+
+    Handle(&e, nowts);
+  }
+
+  // Sensors that went quiet can trigger again
+  uint32_t now_us = micros();
+  for (Sensor &s : sensorlist)
+    if (s.active && now_us - s.last_us > holdoff_us) {
+      s.active = false;
+    }
 
-  if (radio && radio->available()) {
-    sv = radio->getReceivedValue();
+  now_ts = nowts;
+  if (nowts > 1000) {
+    if (start_ts == 0)
+      start_ts = nowts;
+    if (nowts - last_sweep >= PREF_SENSOR_SWEEP) {
+      last_sweep = nowts;
+      Sweep(nowts);
+    }
+  }
+
+  if (overflows != reported) {
+    Serial.printf("Sensors: %d codes lost\n", overflows - reported);
+    reported = overflows;
+  }
+}
+
+void Sensors::Handle(const SensorEvent *e, time_t nowts) {
+  int sv = e->code;
 
-    // Serial.printf("Received %d (0x%08X) / %d bit, protocol %d\n",
-    //   sv, sv, radio->getReceivedBitlength(), radio->getReceivedProtocol());
+  // Serial.printf("Received %d (0x%08X) / %d bit, protocol %d\n",
+  //   sv, sv, e->bits, e->protocol);
 
-    radio->resetAvailable();
+  for (Sensor &s : sensorlist)
+    if (s.id == sv) {
+      if (nowts > 1000)
+        s.last_seen = nowts;
+      if (s.silent) {
+        Serial.printf("Sensor %s is back\n", s.name);
+        s.silent = false;
+      }
 
-    for (Sensor s : sensorlist)
-      if (s.id == sv) {
-        _alarm->Signal(s.name, ZONE_SECURE);
-	return;
+      if (s.active && e->us - s.last_us <= holdoff_us) {
+        s.last_us = e->us;		// Still active
+        s.repeats++;
+        return;
       }
-    Serial.printf("Sensor %d not recognized\n", sv);
+      s.active = true;
+      s.last_us = e->us;
+      s.triggers++;
+      _alarm->Signal(s.name, s.zone);
+      return;
+    }
+  Serial.printf("Sensor %d not recognized\n", sv);
+}
+
+/*
+ * Flag sensors we haven't heard from in a while. Those never seen count from when we got the time.
+ */
+void Sensors::Sweep(time_t nowts) {
+  for (Sensor &s : sensorlist) {
+    if (s.interval == 0 || s.silent)
+      continue;
+
+    time_t since = s.last_seen ? s.last_seen : start_ts;
+    if (nowts - since > s.interval) {
+      char msg[80];
+
+      s.silent = true;
+      sprintf(msg, "Sensor %s silent for %d hours", s.name, (int)((nowts - since) / 3600));
+      Serial.println(msg);
+      if (peers)
+        peers->Report(msg);
+    }
+  }
+}
+
+/*
+ * One sensor, compactly : [name, last seen, triggers, repeats, silent]
+ */
+int Sensors::Row(const Sensor *s, char *buf, int len) {
+  return snprintf(buf, len, "[\"%s\",%ld,%u,%u,%d]", s->name, (long)s->last_seen,
+    s->triggers, s->repeats, s->silent ? 1 : 0);
+}
+
+/*
+ * All sensors : { "sensors" : [ row, .. ], "now" : time }
+ * Valid until the next call. An error reply if there's no memory for it.
+ */
+const char *Sensors::Table() {
+  int len = 40 + sensorlist.size() * row_maxlen;
+  if (table)
+    free(table);
+  table = (char *)malloc(len);
+  if (table == 0) {
+    Serial.printf("Sensors: malloc(%d) failed\n", len);
+    return "{ \"reply\" : \"error\", \"message\" : \"Out of memory\" }";
+  }
+
+  int n = sprintf(table, "{\"sensors\":[");
+  boolean first = true;
+  for (Sensor &s : sensorlist) {
+    if (! first)
+      table[n++] = ',';
+    first = false;
+    int r = Row(&s, table + n, row_maxlen);
+    n += (r < row_maxlen) ? r : row_maxlen - 1;
+  }
+  sprintf(table + n, "],\"now\":%ld}", (long)now_ts);
+  return table;
+}
+
+/*
+ * The same as separate rows, for channels that don't take long messages (MQTT)
+ */
+void Sensors::Report(void (*out)(const char *)) {
+  char row[row_maxlen];
+
+  for (Sensor &s : sensorlist) {
+    Row(&s, row, sizeof(row));
+    out(row);
   }
 }
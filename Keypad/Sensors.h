@@ -25,6 +25,8 @@
 
 #include <Alarm.h>
 #include "RCSwitch.h"
+#include <Ticker.h>
+#include <preferences.h>
 #include <list>
 using namespace std;
 
@@ -36,16 +38,39 @@ struct Sensor {
   int			id;
   char			*name;
   enum AlarmZone	zone;
+
+  // A sensor sends its code many times per trigger, those repeats count as one
+  boolean		active;		// Sent its code less than the hold-off time ago
+  uint32_t		last_us;	// When that was
+  uint32_t		repeats;	// Codes absorbed
+
+  // Supervision : a sensor with a dead battery just goes quiet
+  time_t		last_seen;	// 0 if never
+  uint32_t		triggers;
+  time_t		interval;	// Silent for longer than this (s) is suspect, 0 to not check
+  boolean		silent;
 };
 
 typedef list<Sensor> SensorList;
 
+// A code picked up from the radio
+struct SensorEvent {
+  uint32_t		code;
+  uint8_t		bits, protocol;
+  uint32_t		us;		// micros() when it was picked up
+};
+
 class Sensors {
 public:
   Sensors();
   ~Sensors();
   void loop(time_t);
-  void AddSensor(int id, const char *name, const char *zone);
+  void AddSensor(int id, const char *name, const char *zone,
+    time_t interval = PREF_SENSOR_SUPERVISION);
+  uint32_t GetOverflows();
+  void SetHoldOff(uint32_t ms);
+  const char *Table();
+  void Report(void (*out)(const char *));
 
 private:
   enum SensorStatus	status;
@@ -55,6 +80,26 @@ private:
 
   list<Sensor>		sensorlist;
   AlarmZone AlarmZone2Zone(const char *);
+
+  // Codes from the radio, waiting for loop(). Only Poll() writes tail, only loop() writes head.
+  static const int	queue_size = 16;
+  volatile SensorEvent	queue[queue_size];
+  volatile uint8_t	head, tail;
+  volatile uint32_t	overflows;	// Codes lost because the queue was full
+  uint32_t		reported;
+
+  Ticker		poll_timer;
+  static void Poll(Sensors *sensors);
+  void Handle(const SensorEvent *e, time_t nowts);
+  uint32_t		holdoff_us;
+
+  time_t		start_ts, last_sweep, now_ts;
+  void Sweep(time_t nowts);
+  int Row(const Sensor *s, char *buf, int len);
+  char			*table;
+  static const int	row_maxlen = 64;
 };
 
+extern Sensors *sensors;
+
 #endif	/* _WIRELESS_SENSOR_H_ */
@@ -0,0 +1,169 @@
+/*
+ * Touch input, read once and passed on as events
+ *
+ * The XPT2046 shares the SPI bus with the display, so reading it is not free. Before,
+ * Oled, Alarm and the main loop each read it on every pass. Now this module is the only
+ * one that does.
+ *
+ * With T_IRQ wired up (touchIrqPin in the config), the panel isn't read at all until the
+ * interrupt says it's being touched. The interrupt only sets a flag : the bus may be in
+ * use by the display at that moment. While touched, and when there's no interrupt pin,
+ * it is read every PREF_TOUCH_INTERVAL ms.
+ *
+ * Each reading is the median of three samples. It goes through an IIR filter, and presses
+ * and releases have to be seen a few times in a row before they count. The result comes
+ * out as press, move and release events, which are queued and then handed to whoever
+ * subscribed : the Oled buttons, the alarm button and the backlight.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <Touch.h>
+#include <preferences.h>
+
+#if defined(ESP32)
+#define	TOUCH_ISR_ATTR	IRAM_ATTR
+#else
+#define	TOUCH_ISR_ATTR	ICACHE_RAM_ATTR
+#endif
+
+volatile boolean Touch::irq = false;
+
+Touch::Touch(Oled *oled, int irq_pin) {
+  this->oled = oled;
+  this->irq_pin = irq_pin;
+
+  pressed = false;
+  count = 0;
+  fx = fy = 0;
+  rx = ry = 0;
+  last_sample = 0;
+  head = tail = 0;
+  subscribers = vector<Subscriber>(0);
+
+  if (irq_pin >= 0) {
+    pinMode(irq_pin, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(irq_pin), Interrupt, FALLING);
+  }
+}
+
+Touch::~Touch() {
+  if (irq_pin >= 0)
+    detachInterrupt(digitalPinToInterrupt(irq_pin));
+}
+
+void TOUCH_ISR_ATTR Touch::Interrupt() {
+  irq = true;
+}
+
+void Touch::Subscribe(TouchHandler handler, void *pw) {
+  Subscriber s;
+
+  s.handler = handler;
+  s.pw = pw;
+  subscribers.push_back(s);
+}
+
+static inline uint16_t Median(uint16_t a, uint16_t b, uint16_t c) {
+  if (a > b) {
+    uint16_t t = a; a = b; b = t;
+  }
+  // Now a <= b
+  if (c <= a)
+    return a;
+  if (c >= b)
+    return b;
+  return c;
+}
+
+/*
+ * Read the panel. Returns false if it isn't touched (hard enough).
+ */
+boolean Touch::Sample(uint16_t *x, uint16_t *y) {
+  if (oled->getTouchRawZ() < threshold)
+    return false;
+
+  uint16_t xs[3], ys[3];
+  for (int i = 0; i < 3; i++)
+    (void) oled->getTouchRaw(&xs[i], &ys[i]);
+  *x = Median(xs[0], xs[1], xs[2]);
+  *y = Median(ys[0], ys[1], ys[2]);
+  return true;
+}
+
+void Touch::Post(TouchEventType type, time_t ts) {
+  int n = (tail + 1) % queue_size;
+  if (n == head)
+    return;				// Full, nobody is listening
+
+  queue[tail].type = type;
+  queue[tail].x = rx;
+  queue[tail].y = ry;
+  queue[tail].ts = ts;
+  tail = n;
+}
+
+void Touch::loop(time_t nowts) {
+  // Idle, and the interrupt will tell us when that changes. T_IRQ stays low while the panel
+  // is touched, so keep sampling a press that was too light at first.
+  if (irq_pin >= 0 && ! pressed && count == 0 && ! irq && digitalRead(irq_pin) == HIGH)
+    return;
+  if (millis() - last_sample < PREF_TOUCH_INTERVAL)
+    return;
+  last_sample = millis();
+  irq = false;
+
+  uint16_t x, y;
+  boolean down = Sample(&x, &y);
+
+  if (down != pressed) {
+    if (++count >= (down ? press_samples : release_samples)) {
+      count = 0;
+      pressed = down;
+      if (pressed) {
+        fx = x << 4;
+	fy = y << 4;
+	rx = x;
+	ry = y;
+	Post(TOUCH_PRESS, nowts);
+      } else
+	Post(TOUCH_RELEASE, nowts);	// Where it was last seen
+    }
+  } else {
+    count = 0;
+    if (pressed) {
+      fx += ((x << 4) - fx) >> iir_shift;
+      fy += ((y << 4) - fy) >> iir_shift;
+      uint16_t nx = fx >> 4, ny = fy >> 4;
+      if (abs(nx - rx) >= move_pixels || abs(ny - ry) >= move_pixels) {
+        rx = nx;
+	ry = ny;
+	Post(TOUCH_MOVE, nowts);
+      }
+    }
+  }
+
+  // Deliver
+  while (head != tail) {
+    for (Subscriber &s : subscribers)
+      s.handler(s.pw, &queue[head]);
+    head = (head + 1) % queue_size;
+  }
+}
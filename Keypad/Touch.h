@@ -0,0 +1,86 @@
+/*
+ * Touch input, read once and passed on as events
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_TOUCH_H_
+#define	_TOUCH_H_
+
+#include <Arduino.h>
+#include <Oled.h>
+#include <vector>
+using namespace std;
+
+enum TouchEventType {
+  TOUCH_PRESS,
+  TOUCH_MOVE,
+  TOUCH_RELEASE
+};
+
+struct TouchEvent {
+  TouchEventType	type;
+  uint16_t		x, y;		// Oled coordinates, 0,0 is the lower left corner
+  time_t		ts;
+};
+
+typedef void (*TouchHandler)(void *pw, const TouchEvent *ev);
+
+class Touch {
+public:
+  Touch(Oled *oled, int irq_pin);
+  ~Touch();
+  void loop(time_t);
+
+  void Subscribe(TouchHandler handler, void *pw);
+
+private:
+  Oled			*oled;
+  int			irq_pin;
+  static volatile boolean irq;	// T_IRQ went low since we last looked
+  static void Interrupt();
+
+  // Debouncing and filtering
+  static const int	threshold = 500;	// Pressure
+  static const int	press_samples = 2;	// In a row, to believe a change
+  static const int	release_samples = 3;
+  static const int	move_pixels = 2;	// Smaller moves aren't reported
+  static const int	iir_shift = 1;		// New sample weighs 1 / 2^iir_shift
+  boolean		pressed;
+  int			count;		// Samples in a row that disagree with pressed
+  int32_t		fx, fy;		// Filtered position, 4 fractional bits
+  uint16_t		rx, ry;		// Last reported position
+  uint32_t		last_sample;
+
+  static const int	queue_size = 8;
+  TouchEvent		queue[queue_size];
+  int			head, tail;
+
+  struct Subscriber {
+    TouchHandler	handler;
+    void		*pw;
+  };
+  vector<Subscriber>	subscribers;
+
+  boolean Sample(uint16_t *x, uint16_t *y);
+  void Post(TouchEventType type, time_t ts);
+};
+
+extern Touch *touch;
+#endif	/* _TOUCH_H_ */
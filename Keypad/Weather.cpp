@@ -39,6 +39,7 @@
 #include <LoadGif.h>
 #include <Peers.h>
 #include <Config.h>
+#include <Icon.h>
 
 const char *Weather::pattern = "GET /api/%s/conditions/q/%s/%s.json HTTP/1.1\r\n"
 	"User-Agent: ESP8266-ESP32 Alarm Console/1.0\r\n"
@@ -52,7 +53,7 @@ const char *Weather::pattern = "GET /api/%s/conditions/q/%s/%s.json HTTP/1.1\r\n
  * The parameter says whether this module is the one doing internet queries.
  * (Only one of the modules queries wunderground.com, the others share the info.)
  */
-Weather::Weather(boolean doit, Oled *oled) {
+Weather::Weather(boolean doit, Oled *oled) : OledWidget(0, 0, 0, 0) {
   Serial.printf("Weather ctor(%s)\n", doit ? "true" : "false");
 
   centralNode = doit;
@@ -65,7 +66,7 @@ Weather::Weather(boolean doit, Oled *oled) {
   changed = false;
 
   pic = 0;
-  picw = pich = 0;
+  picw = pich = piclen = 0;
   picx = 30;
   picy = 90;				// 100 descends too much
 
@@ -74,7 +75,7 @@ Weather::Weather(boolean doit, Oled *oled) {
   if (oled) {
     // Specify default clock
     for (int i=0; i<PREF_WEATHER_NB; i++) {
-      first[i] = 1;
+      field[i] = -1;
       format[i] = 0;
       wposx[i] = wposy[i] = 0;
       buffer[i][0] = 0;
@@ -298,7 +299,7 @@ void Weather::loop(time_t nowts) {
         free(json);
 
       // Arrange download of the image
-      peers->ImageFromPeerBinary(wn->ip, 0, picw, pich);
+      peers->ImageFromPeerBinary(wn->ip, 0, picw, pich, piclen);
     } else {
       // Serial.printf("Weather node not found\n");
     }
@@ -308,35 +309,49 @@ void Weather::loop(time_t nowts) {
     draw();
 }
 
+/*
+ * As a widget, see Clock::redraw()
+ */
+void Weather::redraw(Oled *) {
+  changed = true;
+  draw();
+  if (oled && pic)
+    oled->drawIcon(pic, picx, picy);
+}
+
+void Weather::erase(Oled *) {
+  if (oled == 0)
+    return;
+  for (int i=0; i<PREF_WEATHER_NB; i++)
+    if (field[i] >= 0)
+      oled->setText(field[i], "");
+  if (pic)
+    oled->fillRect(picx, OledPanel::Y(picy, pich), picw, pich, TFT_BLACK);
+  oled->flush();
+}
+
 void Weather::draw() {
   if (! changed)
     return;
-  if (oled == 0)
-    return;
+  if (oled == 0 || ! visible)
+    return;			// Keep changed, for when we're on screen again
 
   changed = false;
 				// Serial.printf("Weather draw(");
   for (int i=0; i<PREF_WEATHER_NB; i++)
     if (format[i] != 0 && format[i][0] != 0) { 
-      oled->fontSize(font[i]);
-
-      if (first[i] == 0) {
-        oled->setTextColor(ILI9341_BLACK);
-        oled->drawString(buffer[i], wposx[i], wposy[i]);
-        oled->setTextColor(ILI9341_WHITE);
-      }
-      first[i] = 0;
+      if (field[i] < 0)
+        field[i] = oled->addTextField(wposx[i], wposy[i], font[i]);
 
       // Print the weather info format-based : we don't have a function for that
       strfweather(buffer[i], sizeof(buffer[i]), format[i]);
 
 				// Serial.printf("%d %s,", i, buffer[i]);
 
-      oled->setTextSize(1);
-      oled->drawString(buffer[i], wposx[i], wposy[i]);
+      oled->setText(field[i], buffer[i]);
     }
   				// Serial.printf(")\n");
-    oled->fontSize(1);
+  oled->flush();			// Only sends what changed
 }
 
 /*
@@ -440,6 +455,7 @@ char *Weather::CreatePeerMessage() {
   // Image info
   jo["w"] = picw;
   jo["h"] = pich;
+  jo["len"] = piclen;
 
   // Send output
   jo.printTo(r, peer_message_maxlen);
@@ -522,6 +538,8 @@ void Weather::FromPeer(JsonObject &json) {
   if (x) picw = x;
   x = json["h"];
   if (x) pich = x;
+  x = json["len"];
+  if (x) piclen = x;
 
   changed = true;
 			// Serial.printf("Weather::FromPeer return\n");
@@ -530,16 +548,33 @@ void Weather::FromPeer(JsonObject &json) {
 /*
  * We store the icon here, gets passed either by Peers.cpp or LoadGif.cpp .
  */
-void Weather::drawIcon(const uint16_t *icon, uint16_t width, uint16_t height) {
-  // Serial.printf("Weather::drawIcon(%p, %d, %d)\n", icon, width, height);
+void Weather::drawIcon(const uint8_t *icon) {
+  // Serial.printf("Weather::drawIcon(%p)\n", icon);
   if (pic)
     free(pic);
-  pic = (uint16_t *)icon;
-  picw = width;
-  pich = height;
+  pic = (uint8_t *)icon;
+  picw = Icon::Width(icon);
+  pich = Icon::Height(icon);
+  piclen = Icon::Size(icon);
 
-  if (oled)
-    oled->drawIcon(icon, picx, picy, width, height);
+  if (oled && visible)
+    oled->drawIcon(icon, picx, picy);
+}
+
+/*
+ * Part of an icon that is still being decoded. It only gets stored when complete, see drawIcon().
+ */
+void Weather::drawIconRow(const uint16_t *row, uint16_t x, uint16_t y, uint16_t width) {
+  if (oled && visible)
+    oled->drawIcon(row, picx + x, picy + y, width, 1);
+}
+
+/*
+ * The part of an animation frame that changed. Also not stored.
+ */
+void Weather::drawIconRect(const uint16_t *frame, uint16_t stride, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+  if (oled && visible)
+    oled->drawIcon(frame + y * stride + x, picx + x, picy + y, width, height, stride);
 }
 
 /*
@@ -570,4 +605,5 @@ char *Weather::SkipHeaders(char *buf) {
     // Go to next line
     r = p;
   }
+  return r;
 }
@@ -26,15 +26,20 @@
 #include <WiFiClient.h>
 #include <preferences.h>
 #include <Oled.h>
+#include <Widget.h>
 #include <ArduinoJson.h>
 
-class Weather {
+class Weather : public OledWidget {
 public:
   Weather(boolean, Oled *);
   ~Weather();
   void loop(time_t);
+  void redraw(Oled *);
+  void erase(Oled *);
   void FromPeer(JsonObject &json);
-  void drawIcon(const uint16_t *icon, uint16_t width, uint16_t height);
+  void drawIcon(const uint8_t *icon);
+  void drawIconRow(const uint16_t *row, uint16_t x, uint16_t y, uint16_t width);
+  void drawIconRect(const uint16_t *frame, uint16_t stride, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
   char *CreatePeerMessage();
 
 private:
@@ -75,7 +80,7 @@ private:
 		precip_today_metric, precip_today_in;
 
   // Stuff that is duplicated, one per displayed zone
-  int		first[PREF_WEATHER_NB];
+  int		field[PREF_WEATHER_NB];	// Oled text field, -1 until there is one
   char		buffer[PREF_WEATHER_NB][32];
   char		*format[PREF_WEATHER_NB];	// Description of the content
   int		font[PREF_WEATHER_NB];		// Font
@@ -83,7 +88,8 @@ private:
 		wposy[PREF_WEATHER_NB];
 
   //
-  uint16_t	*pic, picw, pich, picx, picy;
+  uint8_t	*pic;				// Packed, see Icon.h
+  uint16_t	picw, pich, piclen, picx, picy;
 
   const int peer_message_maxlen = 400;
 };
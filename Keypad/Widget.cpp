@@ -0,0 +1,174 @@
+/*
+ * Things on an Oled screen that draw themselves
+ *
+ * A screen is a list of widgets. Each one knows how to draw and erase itself, and keeps a
+ * dirty flag : changing a button's colour or a label's text only marks it, Oled::loop()
+ * redraws what is marked. When switching screens, widgets that are on both (the clock, say)
+ * are left alone, the others are erased or drawn.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <Widget.h>
+#include <Icon.h>
+
+OledWidget::OledWidget(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+  this->x = x;
+  this->y = y;
+  this->w = w;
+  this->h = h;
+  dirty = false;
+  visible = false;
+}
+
+OledWidget::~OledWidget() {
+}
+
+/*
+ * Oled::fillRect() works in Oled coordinates, convert back
+ */
+void OledWidget::erase(Oled *oled) {
+  if (w && h)
+    oled->fillRect(x, OledPanel::Y(y, h), w, h, TFT_BLACK);
+}
+
+void OledWidget::touched(const TouchEvent *ev) {
+}
+
+void OledWidget::invalidate() {
+  dirty = true;
+}
+
+boolean OledWidget::contains(int16_t px, int16_t py) {
+  return px >= x && px < x + w && py >= y && py < y + h;
+}
+
+/*
+ * Buttons
+ */
+OledButtonWidget::OledButtonWidget(int16_t cx, int16_t cy, uint16_t w, uint16_t h,
+  uint16_t outline, uint16_t fill, uint16_t textcolour, const char *label, uint8_t textsize,
+  TouchHandler handler, void *pw)
+  : OledWidget(cx - w / 2, OledPanel::Y(cy) - h / 2, w, h) {
+  this->cx = cx;
+  this->cy = cy;
+  this->outline = outline;
+  this->fill = fill;
+  this->textcolour = textcolour;
+  this->textsize = textsize;
+  this->handler = handler;
+  this->pw = pw;
+  font = -1;
+  setText(label);
+}
+
+void OledButtonWidget::setFont(int font) {
+  this->font = font;
+  invalidate();
+}
+
+void OledButtonWidget::setFillColor(uint16_t fill) {
+  if (fill == this->fill)
+    return;
+  this->fill = fill;
+  invalidate();
+}
+
+void OledButtonWidget::setText(const char *label) {
+  strncpy(this->label, label, sizeof(this->label) - 1);
+  this->label[sizeof(this->label) - 1] = 0;
+  invalidate();
+}
+
+void OledButtonWidget::redraw(Oled *oled) {
+  if (font >= 0)
+    oled->fontSize(font);
+  button.initButton(oled, cx, cy, w, h, outline, fill, textcolour, label, textsize);
+  button.drawButton();
+}
+
+void OledButtonWidget::touched(const TouchEvent *ev) {
+  if (handler)
+    handler(pw, ev);
+}
+
+/*
+ * Labels, drawn as a text field
+ */
+OledLabel::OledLabel(int16_t x, int16_t y, int font, const char *text, uint16_t colour)
+  : OledWidget(x, y, 0, 0) {
+  field = -1;
+  tx = x;
+  ty = y;
+  this->font = font;
+  this->colour = colour;
+  setText(text);
+}
+
+void OledLabel::setText(const char *text) {
+  strncpy(this->text, text, sizeof(this->text) - 1);
+  this->text[sizeof(this->text) - 1] = 0;
+  invalidate();
+}
+
+void OledLabel::redraw(Oled *oled) {
+  if (field < 0)
+    field = oled->addTextField(tx, ty, font, colour);
+  oled->setText(field, text);		// Goes out with Oled::flush()
+}
+
+/*
+ * Only the ink goes, the text field knows where it is
+ */
+void OledLabel::erase(Oled *oled) {
+  if (field < 0)
+    return;
+  oled->setText(field, "");
+  oled->flush();
+}
+
+/*
+ * Icons
+ */
+OledIconWidget::OledIconWidget(int16_t x, int16_t y, const uint8_t *icon)
+  : OledWidget(x, y, 0, 0) {
+  this->icon = 0;
+  setIcon(icon);
+}
+
+void OledIconWidget::setIcon(const uint8_t *icon) {
+  this->icon = icon;
+  invalidate();
+}
+
+/*
+ * Clear what the previous icon covered, if this one is smaller
+ */
+void OledIconWidget::redraw(Oled *oled) {
+  uint16_t nw = icon ? Icon::Width(icon) : 0,
+    nh = icon ? Icon::Height(icon) : 0;
+
+  if (nw < w || nh < h)
+    erase(oled);
+  w = nw;
+  h = nh;
+  if (icon)
+    oled->drawIcon(icon, x, y);
+}
@@ -0,0 +1,115 @@
+/*
+ * Things on an Oled screen that draw themselves, see Oled::addWidget()
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef	_WIDGET_H_
+#define	_WIDGET_H_
+
+#include <Oled.h>
+#include <Touch.h>
+
+/*
+ * The rectangle is in display coordinates (0,0 is the top left corner), as for text fields
+ * and icons. It is what gets hit tested and, by default, erased. Widgets that are not meant
+ * to be touched can leave it empty.
+ */
+class OledWidget {
+public:
+  OledWidget(int16_t x, int16_t y, uint16_t w, uint16_t h);
+  virtual ~OledWidget();
+
+  virtual void redraw(Oled *oled) = 0;		// Draw all of it
+  virtual void erase(Oled *oled);		// It's not on the new screen
+  virtual void touched(const TouchEvent *ev);	// Events from a press that started here
+
+  void invalidate();
+  boolean contains(int16_t px, int16_t py);
+
+  int16_t	x, y;
+  uint16_t	w, h;
+  boolean	dirty;		// Needs a redraw()
+  boolean	visible;	// On the current screen
+};
+
+/*
+ * A button, positioned by its centre in Oled coordinates like OledButton::initButton().
+ * The handler gets press, move and release events.
+ */
+class OledButtonWidget : public OledWidget {
+public:
+  OledButtonWidget(int16_t cx, int16_t cy, uint16_t w, uint16_t h,
+    uint16_t outline, uint16_t fill, uint16_t textcolour, const char *label, uint8_t textsize,
+    TouchHandler handler, void *pw);
+
+  void setFont(int font);
+  void setFillColor(uint16_t fill);
+  void setText(const char *label);
+
+  void redraw(Oled *oled);
+  void touched(const TouchEvent *ev);
+
+private:
+  OledButton	button;
+  int16_t	cx, cy;
+  uint16_t	outline, fill, textcolour;
+  char		label[10];		// As much as TFT_eSPI_Button keeps
+  uint8_t	textsize;
+  int		font;			// -1 : whatever is selected
+  TouchHandler	handler;
+  void		*pw;
+};
+
+/*
+ * A line of text, top left at x,y
+ */
+class OledLabel : public OledWidget {
+public:
+  OledLabel(int16_t x, int16_t y, int font, const char *text, uint16_t colour = TFT_WHITE);
+
+  void setText(const char *text);
+
+  void redraw(Oled *oled);
+  void erase(Oled *oled);
+
+private:
+  int		field;			// Oled text field, -1 until drawn
+  int16_t	tx, ty;
+  int		font;
+  uint16_t	colour;
+  char		text[32];
+};
+
+/*
+ * A packed icon (see Icon.h), not copied
+ */
+class OledIconWidget : public OledWidget {
+public:
+  OledIconWidget(int16_t x, int16_t y, const uint8_t *icon = 0);
+
+  void setIcon(const uint8_t *icon);
+
+  void redraw(Oled *oled);
+
+private:
+  const uint8_t	*icon;
+};
+
+#endif	/* _WIDGET_H_ */
@@ -17,6 +17,7 @@
 // #include "utils/log.h"
 
 #include "lzw.h"
+#include "Pixels.h"
 
 /**
  *
@@ -66,6 +67,61 @@
 #define GIF_STANDARD_HEADER_SIZE 13
 
 
+/**
+ * Number of bytes per pixel in the frame image
+ */
+static inline unsigned int gif_bytes_per_pixel(gif_animation *gif)
+{
+        return (gif->format == GIF_FORMAT_RGB565) ? 2 : 4;
+}
+
+
+/**
+ * Convert a colour table to RGB565, so this happens once per frame rather
+ * than once per pixel.
+ *
+ * \param gif The animation context
+ * \param colour_table Table to convert, entries are r, g, b, a bytes
+ * \param colours Number of entries
+ */
+static void gif_colour_table_565(gif_animation *gif,
+                                 unsigned int *colour_table,
+                                 unsigned int colours)
+{
+        pixels_rgba_to_565(gif->colour_table_565, (const uint32_t *) colour_table, colours);
+}
+
+
+/**
+ * Fill a run of pixels in the frame image with one colour
+ *
+ * \param gif The animation context
+ * \param pixels Start of the run
+ * \param count Number of pixels
+ * \param colour Index in the colour table, or -1 for transparent
+ * \param colour_table Colour table of the frame
+ */
+static void gif_fill_pixels(gif_animation *gif,
+                            void *pixels,
+                            unsigned int count,
+                            int colour,
+                            unsigned int *colour_table)
+{
+        if (gif->format == GIF_FORMAT_RGB565) {
+                uint16_t *p = pixels;
+                uint16_t c = (colour < 0) ? GIF_TRANSPARENT_COLOUR :
+                                            gif->colour_table_565[colour];
+                while (count-- > 0) {
+                        *p++ = c;
+                }
+        } else {
+                memset(pixels,
+                       (colour < 0) ? GIF_TRANSPARENT_COLOUR : colour_table[colour],
+                       count * 4);
+        }
+}
+
+
 /**
  * Updates the sprite memory size
  *
@@ -188,11 +244,14 @@ gif_initialise_frame_extensions(gif_animation *gif, const int frame)
                                 return GIF_INSUFFICIENT_FRAME_DATA;
                         }
                         if ((gif_data[1] == 0x0b) &&
-                            (strncmp((const char *) gif_data + 2,
-                                     "NETSCAPE2.0", 11) == 0) &&
+                            ((strncmp((const char *) gif_data + 2,
+                                      "NETSCAPE2.0", 11) == 0) ||
+                             (strncmp((const char *) gif_data + 2,
+                                      "ANIMEXTS1.0", 11) == 0)) &&
                             (gif_data[13] == 0x03) &&
                             (gif_data[14] == 0x01)) {
                                 gif->loop_count = gif_data[15] | (gif_data[16] << 8);
+                                gif->looping = true;
                         }
                         gif_data += (2 + gif_data[1]);
                         break;
@@ -290,15 +349,21 @@ static gif_result gif_initialise_frame(gif_animation *gif)
                 return GIF_FRAME_DATA_ERROR;
         }
 
-        /* Get some memory to store our pointers in etc. */
+        /* Get some memory to store our pointers in etc. Grow by doubling,
+         * so GIFs with many frames don't realloc (and fragment the heap)
+         * for every one of them.
+         */
         if ((int)gif->frame_holders <= frame) {
-                /* Allocate more memory */
-                temp_buf = (gif_frame *)realloc(gif->frames, (frame + 1) * sizeof(gif_frame));
+                unsigned int holders = gif->frame_holders * 2;
+                if ((int)holders <= frame) {
+                        holders = frame + 1;
+                }
+                temp_buf = (gif_frame *)realloc(gif->frames, holders * sizeof(gif_frame));
                 if (temp_buf == NULL) {
                         return GIF_INSUFFICIENT_MEMORY;
                 }
                 gif->frames = temp_buf;
-                gif->frame_holders = frame + 1;
+                gif->frame_holders = holders;
         }
 
         /* Store our frame pointer. We would do it when allocating except we
@@ -589,8 +654,9 @@ gif_internal_decode_frame(gif_animation *gif,
         unsigned int width, height, offset_x, offset_y;
         unsigned int flags, colour_table_size, interlace;
         unsigned int *colour_table;
-        unsigned int *frame_data = 0;	// Set to 0 for no warnings
-        unsigned int *frame_scanline;
+        unsigned char *frame_data = 0;	// Set to 0 for no warnings
+        unsigned char *frame_scanline;
+        unsigned int bpp = gif_bytes_per_pixel(gif);
         unsigned int save_buffer_position;
         unsigned int return_value = 0;
         unsigned int x, y, decode_y, burst_bytes;
@@ -721,6 +787,10 @@ gif_internal_decode_frame(gif_animation *gif,
                 colour_table = gif->global_colour_table;
         }
 
+        if (gif->format == GIF_FORMAT_RGB565) {
+                gif_colour_table_565(gif, colour_table, GIF_MAX_COLOURS);
+        }
+
         /* Ensure sufficient data remains */
         if (gif_bytes < 1) {
                 return_value = GIF_INSUFFICIENT_FRAME_DATA;
@@ -769,7 +839,7 @@ gif_internal_decode_frame(gif_animation *gif,
                 if ((frame == 0) || (gif->decoded_frame == GIF_INVALID_FRAME)) {
                         memset((char*)frame_data,
                                GIF_TRANSPARENT_COLOUR,
-                               gif->width * gif->height * sizeof(int));
+                               gif->width * gif->height * bpp);
                         gif->decoded_frame = frame;
                         /* The line below would fill the image with its
                          * background color, but because GIFs support
@@ -783,6 +853,9 @@ gif_internal_decode_frame(gif_animation *gif,
                         if (return_value != GIF_OK) {
                                 goto gif_decode_frame_exit;
                         }
+                        if (gif->format == GIF_FORMAT_RGB565) {
+                                gif_colour_table_565(gif, colour_table, GIF_MAX_COLOURS);
+                        }
 
                 } else if ((frame != 0) &&
                            (gif->frames[frame - 1].disposal_method == GIF_FRAME_RESTORE)) {
@@ -804,12 +877,16 @@ gif_internal_decode_frame(gif_animation *gif,
                                  */
                                 memset((char*)frame_data,
                                        GIF_TRANSPARENT_COLOUR,
-                                       gif->width * gif->height * sizeof(int));
+                                       gif->width * gif->height * bpp);
                         } else {
                                 return_value = gif_internal_decode_frame(gif, last_undisposed_frame, false);
                                 if (return_value != GIF_OK) {
                                         goto gif_decode_frame_exit;
                                 }
+                                /* That used its own colour table */
+                                if (gif->format == GIF_FORMAT_RGB565) {
+                                        gif_colour_table_565(gif, colour_table, GIF_MAX_COLOURS);
+                                }
                                 /* Get this frame's data */
                                 assert(gif->bitmap_callbacks.bitmap_get_buffer);
                                 frame_data = (void *)gif->bitmap_callbacks.bitmap_get_buffer(gif->frame_image);
@@ -836,7 +913,7 @@ gif_internal_decode_frame(gif_animation *gif,
                         } else {
                                 decode_y = y + offset_y;
                         }
-                        frame_scanline = frame_data + offset_x + (decode_y * gif->width);
+                        frame_scanline = frame_data + (offset_x + (decode_y * gif->width)) * bpp;
 
                         /* Rather than decoding pixel by pixel, we try to burst
                          * out streams of data to remove the need for end-of
@@ -850,14 +927,28 @@ gif_internal_decode_frame(gif_animation *gif,
                                                 burst_bytes = x;
                                         }
                                         x -= burst_bytes;
+                                        if (gif->format == GIF_FORMAT_RGB565) {
+                                                uint16_t *scanline = (uint16_t *) frame_scanline;
+                                                const uint16_t *table = gif->colour_table_565;
+                                                frame_scanline += burst_bytes * 2;
+                                                while (burst_bytes-- > 0) {
+                                                        colour = *--stack_pos;
+                                                        if ((!gif->frames[frame].transparency) ||
+                                                            (colour != gif->frames[frame].transparency_index)) {
+                                                                *scanline = table[colour];
+                                                        }
+                                                        scanline++;
+                                                }
+                                                continue;
+                                        }
                                         while (burst_bytes-- > 0) {
                                                 colour = *--stack_pos;
                                                 if (((gif->frames[frame].transparency) &&
                                                      (colour != gif->frames[frame].transparency_index)) ||
                                                     (!gif->frames[frame].transparency)) {
-                                                        *frame_scanline = colour_table[colour];
+                                                        *(unsigned int *) frame_scanline = colour_table[colour];
                                                 }
-                                                frame_scanline++;
+                                                frame_scanline += 4;
                                         }
                                 } else {
                                         res = lzw_decode(gif->lzw_ctx, &stack_pos);
@@ -877,15 +968,13 @@ gif_internal_decode_frame(gif_animation *gif,
                 /* Clear our frame */
                 if (gif->frames[frame].disposal_method == GIF_FRAME_CLEAR) {
                         for (y = 0; y < height; y++) {
-                                frame_scanline = frame_data + offset_x + ((offset_y + y) * gif->width);
+                                frame_scanline = frame_data + (offset_x + ((offset_y + y) * gif->width)) * bpp;
                                 if (gif->frames[frame].transparency) {
-                                        memset(frame_scanline,
-                                               GIF_TRANSPARENT_COLOUR,
-                                               width * 4);
+                                        gif_fill_pixels(gif, frame_scanline, width,
+                                                        -1, colour_table);
                                 } else {
-                                        memset(frame_scanline,
-                                               colour_table[gif->background_index],
-                                               width * 4);
+                                        gif_fill_pixels(gif, frame_scanline, width,
+                                                        gif->background_index, colour_table);
                                 }
                         }
                 }
@@ -964,6 +1053,7 @@ gif_result gif_initialise(gif_animation *gif, size_t size, unsigned char *data)
                 gif->frames = NULL;
                 gif->local_colour_table = NULL;
                 gif->global_colour_table = NULL;
+                gif->colour_table_565 = NULL;
 
                 /* The caller may have been lazy and not reset any values */
                 gif->frame_count = 0;
@@ -1007,6 +1097,7 @@ gif_result gif_initialise(gif_animation *gif, size_t size, unsigned char *data)
                 gif->background_index = gif_data[5];
                 gif->aspect_ratio = gif_data[6];
                 gif->loop_count = 1;
+                gif->looping = false;
                 gif_data += 7;
 
                 /* Some broken GIFs report the size as the screen size they
@@ -1038,6 +1129,13 @@ gif_result gif_initialise(gif_animation *gif, size_t size, unsigned char *data)
                         gif_finalise(gif);
                         return GIF_INSUFFICIENT_MEMORY;
                 }
+                if (gif->format == GIF_FORMAT_RGB565) {
+                        gif->colour_table_565 = calloc(GIF_MAX_COLOURS, sizeof(uint16_t));
+                        if (gif->colour_table_565 == NULL) {
+                                gif_finalise(gif);
+                                return GIF_INSUFFICIENT_MEMORY;
+                        }
+                }
 
                 /* Set the first colour to a value that will never occur in
                  * reality so we know if we've processed it
@@ -1163,6 +1261,8 @@ void gif_finalise(gif_animation *gif)
         gif->local_colour_table = NULL;
         free(gif->global_colour_table);
         gif->global_colour_table = NULL;
+        free(gif->colour_table_565);
+        gif->colour_table_565 = NULL;
 
         lzw_context_destroy(gif->lzw_ctx);
         gif->lzw_ctx = NULL;
@@ -68,6 +68,12 @@ typedef struct gif_frame {
         unsigned int redraw_height;
 } gif_frame;
 
+/** Pixel format of the frame image */
+typedef enum {
+        GIF_FORMAT_RGBA8888 = 0,  /**< 4 bytes per pixel: r, g, b, a */
+        GIF_FORMAT_RGB565 = 1     /**< 16 bit 5-6-5, native byte order */
+} gif_format;
+
 /* API for Bitmap callbacks */
 typedef void* (*gif_bitmap_cb_create)(int width, int height);
 typedef void (*gif_bitmap_cb_destroy)(void *bitmap);
@@ -119,6 +125,10 @@ typedef struct gif_animation {
         void *frame_image;
         /** number of times to loop animation */
         int loop_count;
+        /** there was a loop extension, so this is meant as an animation */
+        bool looping;
+        /** pixel format of frame_image, set before gif_initialise() */
+        gif_format format;
 
         /* Internal members are listed below */
 
@@ -140,6 +150,8 @@ typedef struct gif_animation {
         unsigned int *global_colour_table;
         /** local colour table */
         unsigned int *local_colour_table;
+        /** colour table of the frame being decoded, for GIF_FORMAT_RGB565 */
+        uint16_t *colour_table_565;
 } gif_animation;
 
 /**
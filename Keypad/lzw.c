@@ -12,6 +12,7 @@
 #include <stdbool.h>
 
 #include "lzw.h"
+#include "preferences.h"	/* PREF_LZW_COMPACT */
 
 /**
  * \file
@@ -31,15 +32,30 @@
  * size entry.
  *
  * Note that an individual LZW code can be split over up to three sub-blocks.
+ *
+ * Codes are taken from a 32 bit reservoir, which is topped up a byte at a
+ * time from the current sub-block.  Only when the sub-block runs out is the
+ * next one looked at, so the boundary handling stays out of the common path.
+ * A code that is split over sub-blocks waits in the reservoir if the next
+ * sub-block isn't there yet.
+ *
+ * For streamed input, `read` is set and sub-blocks are copied into `sb_buf`
+ * one at a time, rather than being addressed in a buffer with all the data.
  */
 struct lzw_read_ctx {
 	const uint8_t *data;    /**< Pointer to start of input data */
 	uint32_t data_len;      /**< Input data length */
 	uint32_t data_sb_next;  /**< Offset to sub-block size */
 
-	const uint8_t *sb_data; /**< Pointer to current sub-block in data */
-	uint32_t sb_bit;        /**< Current bit offset in sub-block */
-	uint32_t sb_bit_count;  /**< Bit count in sub-block */
+	const uint8_t *sb_data; /**< Next byte in current sub-block */
+	const uint8_t *sb_end;  /**< End of current sub-block */
+
+	uint32_t bits;          /**< Bit reservoir, next bit is bit 0 */
+	uint32_t bit_count;     /**< Number of valid bits in reservoir */
+
+	lzw_read_fn read;       /**< Sub-block source for streamed input */
+	void *read_pw;          /**< Client data for read */
+	uint8_t sb_buf[255];    /**< Current sub-block, for streamed input */
 };
 
 /**
@@ -52,11 +68,24 @@ struct lzw_read_ctx {
  * If the previous_entry's index is < the current clear_code, then it
  * is the last entry in the record.
  */
+#ifdef PREF_LZW_COMPACT
+/*
+ * With PREF_LZW_COMPACT, an entry takes 3 bytes rather than 6.  The first
+ * value and the length of a record are found by following the entries.
+ */
+struct lzw_dictionary_entry {
+	uint8_t last_value;      /**< Last value for record ending at entry. */
+	uint8_t previous_lo;     /**< Previous entry, low 8 bits. */
+	uint8_t previous_hi;     /**< Previous entry, high 4 bits. */
+};
+#else
 struct lzw_dictionary_entry {
 	uint8_t last_value;      /**< Last value for record ending at entry. */
 	uint8_t first_value;     /**< First value for entry's record. */
 	uint16_t previous_entry; /**< Offset in dictionary to previous entry. */
+	uint16_t count;          /**< Length of record ending at entry. */
 };
+#endif
 
 /**
  * LZW decompression context.
@@ -77,6 +106,9 @@ struct lzw_ctx {
 
 	uint32_t current_entry; /**< Next position in table to fill. */
 
+	uint32_t output_code; /**< Code with output left, for lzw_decode_buffer */
+	uint32_t output_left; /**< Number of bytes of it still to be written */
+
 	/** Output value stack. */
 	uint8_t stack_base[1 << LZW_CODE_MAX];
 
@@ -85,10 +117,31 @@ struct lzw_ctx {
 };
 
 
+#ifdef PREF_LZW_COMPACT
+/*
+ * One context for all decodes, so they don't need a big allocation each
+ * time.  If it is in use (e.g. an animation is playing while an icon gets
+ * decoded), contexts are allocated as usual.
+ */
+static struct lzw_ctx lzw_pool;
+static bool lzw_pool_busy = false;
+#endif
+
+
 /* Exported function, documented in lzw.h */
 lzw_result lzw_context_create(struct lzw_ctx **ctx)
 {
-	struct lzw_ctx *c = malloc(sizeof(*c));
+	struct lzw_ctx *c;
+
+#ifdef PREF_LZW_COMPACT
+	if (!lzw_pool_busy) {
+		lzw_pool_busy = true;
+		*ctx = &lzw_pool;
+		return LZW_OK;
+	}
+#endif
+
+	c = malloc(sizeof(*c));
 	if (c == NULL) {
 		return LZW_NO_MEM;
 	}
@@ -101,10 +154,75 @@ lzw_result lzw_context_create(struct lzw_ctx **ctx)
 /* Exported function, documented in lzw.h */
 void lzw_context_destroy(struct lzw_ctx *ctx)
 {
+#ifdef PREF_LZW_COMPACT
+	if (ctx == &lzw_pool) {
+		lzw_pool_busy = false;
+		return;
+	}
+#endif
 	free(ctx);
 }
 
 
+/**
+ * Get the entry a dictionary entry continues from.
+ *
+ * \param[in] entry  Dictionary entry.
+ * \return previous entry's index.
+ */
+static inline uint32_t lzw__previous(const struct lzw_dictionary_entry *entry)
+{
+#ifdef PREF_LZW_COMPACT
+	return entry->previous_lo | (entry->previous_hi << 8);
+#else
+	return entry->previous_entry;
+#endif
+}
+
+
+/**
+ * Get the first value of the record ending at a dictionary entry.
+ *
+ * \param[in] ctx   LZW decompression context.
+ * \param[in] code  Dictionary entry.
+ * \return the value.
+ */
+static inline uint8_t lzw__first(const struct lzw_ctx *ctx, uint32_t code)
+{
+#ifdef PREF_LZW_COMPACT
+	while (code > ctx->clear_code) {
+		code = lzw__previous(ctx->table + code);
+	}
+	return ctx->table[code].last_value;
+#else
+	return ctx->table[code].first_value;
+#endif
+}
+
+
+/**
+ * Get the length of the record ending at a dictionary entry.
+ *
+ * \param[in] ctx   LZW decompression context.
+ * \param[in] code  Dictionary entry.
+ * \return number of values.
+ */
+static inline uint32_t lzw__count(const struct lzw_ctx *ctx, uint32_t code)
+{
+#ifdef PREF_LZW_COMPACT
+	uint32_t count = 1;
+
+	while (code > ctx->clear_code) {
+		code = lzw__previous(ctx->table + code);
+		count++;
+	}
+	return count;
+#else
+	return ctx->table[code].count;
+#endif
+}
+
+
 /**
  * Advance the context to the next sub-block in the input data.
  *
@@ -117,6 +235,19 @@ static lzw_result lzw__block_advance(struct lzw_read_ctx *ctx)
 	uint32_t next_block_pos = ctx->data_sb_next;
 	const uint8_t *data_next = ctx->data + next_block_pos;
 
+	if (ctx->read != NULL) {
+		int size = ctx->read(ctx->read_pw, ctx->sb_buf);
+
+		if (size < 0) {
+			return LZW_NO_DATA;
+		}
+
+		ctx->sb_data = ctx->sb_buf;
+		ctx->sb_end = ctx->sb_buf + size;
+
+		return (size == 0) ? LZW_OK_EOD : LZW_OK;
+	}
+
 	if (next_block_pos >= ctx->data_len) {
 		return LZW_NO_DATA;
 	}
@@ -127,21 +258,42 @@ static lzw_result lzw__block_advance(struct lzw_read_ctx *ctx)
 		return LZW_NO_DATA;
 	}
 
-	ctx->sb_bit = 0;
-	ctx->sb_bit_count = block_size * 8;
-
 	if (block_size == 0) {
 		ctx->data_sb_next += 1;
 		return LZW_OK_EOD;
 	}
 
 	ctx->sb_data = data_next + 1;
+	ctx->sb_end = ctx->sb_data + block_size;
 	ctx->data_sb_next += block_size + 1;
 
 	return LZW_OK;
 }
 
 
+/**
+ * Top up the bit reservoir from the current sub-block.
+ *
+ * \param[in] ctx  LZW reading context, updated.
+ */
+static inline void lzw__fill(struct lzw_read_ctx *ctx)
+{
+	const uint8_t *data = ctx->sb_data;
+	const uint8_t *end = ctx->sb_end;
+	uint32_t bits = ctx->bits;
+	uint32_t count = ctx->bit_count;
+
+	while (count <= 24 && data < end) {
+		bits |= (uint32_t)*data++ << count;
+		count += 8;
+	}
+
+	ctx->sb_data = data;
+	ctx->bits = bits;
+	ctx->bit_count = count;
+}
+
+
 /**
  * Get the next LZW code of given size from the raw input data.
  *
@@ -154,62 +306,25 @@ static lzw_result lzw__block_advance(struct lzw_read_ctx *ctx)
  */
 static inline lzw_result lzw__next_code(
 		struct lzw_read_ctx *ctx,
-		uint8_t code_size,
+		uint32_t code_size,
 		uint32_t *code_out)
 {
-	uint32_t code = 0;
-	uint8_t current_bit = ctx->sb_bit & 0x7;
-	uint8_t byte_advance = (current_bit + code_size) >> 3;
-
-	assert(byte_advance <= 2);
-
-	if (ctx->sb_bit + code_size < ctx->sb_bit_count) {
-		/* Fast path: code fully inside this sub-block */
-		const uint8_t *data = ctx->sb_data + (ctx->sb_bit >> 3);
-		switch (byte_advance) {
-			case 2: code |= data[2] << 16;
-			case 1: code |= data[1] <<  8;
-			case 0: code |= data[0] <<  0;
-		}
-		ctx->sb_bit += code_size;
-	} else {
-		/* Slow path: code spans sub-blocks */
-		uint8_t byte = 0;
-		uint8_t bits_remaining_0 = (code_size < (8 - current_bit)) ?
-				code_size : (8 - current_bit);
-		uint8_t bits_remaining_1 = code_size - bits_remaining_0;
-		uint8_t bits_used[3] = {
-			[0] = bits_remaining_0,
-			[1] = bits_remaining_1 < 8 ? bits_remaining_1 : 8,
-			[2] = bits_remaining_1 - 8,
-		};
-
-		while (true) {
-			const uint8_t *data = ctx->sb_data;
-			lzw_result res;
-
-			/* Get any data from end of this sub-block */
-			while (byte <= byte_advance &&
-					ctx->sb_bit < ctx->sb_bit_count) {
-				code |= data[ctx->sb_bit >> 3] << (byte << 3);
-				ctx->sb_bit += bits_used[byte];
-				byte++;
-			}
-
-			/* Check if we have all we need */
-			if (byte > byte_advance) {
-				break;
-			}
+	if (ctx->bit_count < code_size) {
+		lzw__fill(ctx);
 
-			/* Move to next sub-block */
-			res = lzw__block_advance(ctx);
+		/* Slow path: code spans sub-blocks */
+		while (ctx->bit_count < code_size) {
+			lzw_result res = lzw__block_advance(ctx);
 			if (res != LZW_OK) {
 				return res;
 			}
+			lzw__fill(ctx);
 		}
 	}
 
-	*code_out = (code >> current_bit) & ((1 << code_size) - 1);
+	*code_out = ctx->bits & ((1 << code_size) - 1);
+	ctx->bits >>= code_size;
+	ctx->bit_count -= code_size;
 	return LZW_OK;
 }
 
@@ -217,46 +332,57 @@ static inline lzw_result lzw__next_code(
 /**
  * Clear LZW code dictionary.
  *
- * \param[in]  ctx            LZW reading context, updated.
- * \param[out] stack_pos_out  Returns current stack position.
- * \return LZW_OK or error code.
+ * The next code read is handled as the first one of the data.
+ *
+ * \param[in]  ctx  LZW reading context, updated.
  */
-static lzw_result lzw__clear_codes(
-		struct lzw_ctx *ctx,
-		const uint8_t ** const stack_pos_out)
+static void lzw__clear_codes(struct lzw_ctx *ctx)
 {
-	uint32_t code = 0;	// Initialize to keep compiler happy
-	uint8_t *stack_pos;
-
 	/* Reset dictionary building context */
 	ctx->current_code_size = ctx->initial_code_size + 1;
-	ctx->current_code_size_max = (1 << ctx->current_code_size) - 1;;
+	ctx->current_code_size_max = (1 << ctx->current_code_size) - 1;
 	ctx->current_entry = (1 << ctx->initial_code_size) + 2;
 
-	/* There might be a sequence of clear codes, so process them all */
-	do {
-		lzw_result res = lzw__next_code(&ctx->input,
-				ctx->current_code_size, &code);
-		if (res != LZW_OK) {
-			return res;
-		}
-	} while (code == ctx->clear_code);
+	/* No previous code */
+	ctx->previous_code = ctx->clear_code;
+}
+
+
+/**
+ * Initialise the dictionary.
+ *
+ * \param[in]  ctx             The LZW decompression context to initialise.
+ * \param[in]  code_size       The initial LZW code size to use.
+ */
+static void lzw__decode_init(
+		struct lzw_ctx *ctx,
+		uint8_t code_size)
+{
+	struct lzw_dictionary_entry *table = ctx->table;
+
+	/* Initialise the dictionary building context */
+	ctx->initial_code_size = code_size;
 
-	/* The initial code must be from the initial dictionary. */
-	if (code > ctx->clear_code) {
-		return LZW_BAD_ICODE;
+	ctx->clear_code = (1 << code_size) + 0;
+	ctx->eoi_code   = (1 << code_size) + 1;
+
+	/* Initialise the standard dictionary entries */
+	for (uint32_t i = 0; i < ctx->clear_code; ++i) {
+		table[i].last_value  = i;
+#ifndef PREF_LZW_COMPACT
+		table[i].first_value = i;
+		table[i].count       = 1;
+#endif
 	}
 
-	/* Record this initial code as "previous" code, needed during decode. */
-	ctx->previous_code = code;
-	ctx->previous_code_first = code;
+	ctx->input.bits = 0;
+	ctx->input.bit_count = 0;
+	ctx->input.sb_data = NULL;
+	ctx->input.sb_end = NULL;
 
-	/* Reset the stack, and add first non-clear code added as first item. */
-	stack_pos = ctx->stack_base;
-	*stack_pos++ = code;
+	ctx->output_left = 0;
 
-	*stack_pos_out = stack_pos;
-	return LZW_OK;
+	lzw__clear_codes(ctx);
 }
 
 
@@ -270,82 +396,117 @@ lzw_result lzw_decode_init(
 		const uint8_t ** const stack_base_out,
 		const uint8_t ** const stack_pos_out)
 {
-	struct lzw_dictionary_entry *table = ctx->table;
-
 	/* Initialise the input reading context */
 	ctx->input.data = compressed_data;
 	ctx->input.data_len = compressed_data_len;
 	ctx->input.data_sb_next = compressed_data_pos;
 
-	ctx->input.sb_bit = 0;
-	ctx->input.sb_bit_count = 0;
+	ctx->input.read = NULL;
+	ctx->input.read_pw = NULL;
 
-	/* Initialise the dictionary building context */
-	ctx->initial_code_size = code_size;
-
-	ctx->clear_code = (1 << code_size) + 0;
-	ctx->eoi_code   = (1 << code_size) + 1;
-
-	/* Initialise the standard dictionary entries */
-	for (uint32_t i = 0; i < ctx->clear_code; ++i) {
-		table[i].first_value = i;
-		table[i].last_value  = i;
-	}
+	lzw__decode_init(ctx, code_size);
 
 	*stack_base_out = ctx->stack_base;
-	return lzw__clear_codes(ctx, stack_pos_out);
+	*stack_pos_out = ctx->stack_base;
+	return LZW_OK;
 }
 
 
 /* Exported function, documented in lzw.h */
-lzw_result lzw_decode(struct lzw_ctx *ctx,
-		const uint8_t ** const stack_pos_out)
+lzw_result lzw_decode_init_stream(
+		struct lzw_ctx *ctx,
+		lzw_read_fn read,
+		void *pw,
+		uint8_t code_size)
+{
+	/* Initialise the input reading context */
+	ctx->input.data = NULL;
+	ctx->input.data_len = 0;
+	ctx->input.data_sb_next = 0;
+
+	ctx->input.read = read;
+	ctx->input.read_pw = pw;
+
+	lzw__decode_init(ctx, code_size);
+	return LZW_OK;
+}
+
+
+/**
+ * Read the next code, and update the dictionary.
+ *
+ * Clear codes are dealt with here.  The dictionary entry for a code that
+ * is not in the table yet is added before returning, so the returned
+ * code can always be looked up.
+ *
+ * \param[in]  ctx       LZW decompression context, updated.
+ * \param[out] code_out  Returns dictionary entry to output.
+ * \return LZW_OK on success, or appropriate error code otherwise.
+ */
+static inline lzw_result lzw__decode_code(
+		struct lzw_ctx *ctx,
+		uint32_t *code_out)
 {
 	lzw_result res;
-	uint32_t code_new = 0;	// Initialize to keep compiler happy
-	uint32_t code_out;
-	uint8_t last_value;
-	uint8_t *stack_pos = ctx->stack_base;
+	uint32_t code_new;
+	uint8_t first_value;
 	uint32_t clear_code = ctx->clear_code;
 	uint32_t current_entry = ctx->current_entry;
 	struct lzw_dictionary_entry * const table = ctx->table;
 
-	/* Get a new code from the input */
-	res = lzw__next_code(&ctx->input, ctx->current_code_size, &code_new);
-	if (res != LZW_OK) {
-		return res;
+	/* Get a new code from the input, skipping clear codes */
+	while (true) {
+		res = lzw__next_code(&ctx->input, ctx->current_code_size,
+				&code_new);
+		if (res != LZW_OK) {
+			return res;
+		}
+		if (code_new != clear_code) {
+			break;
+		}
+		lzw__clear_codes(ctx);
+		current_entry = ctx->current_entry;
 	}
 
-	/* Handle the new code */
-	if (code_new == clear_code) {
-		/* Got Clear code */
-		return lzw__clear_codes(ctx, stack_pos_out);
-
-	} else if (code_new == ctx->eoi_code) {
+	if (code_new == ctx->eoi_code) {
 		/* Got End of Information code */
 		return LZW_EOI_CODE;
+	}
+
+	if (ctx->previous_code == clear_code) {
+		/* The initial code must be from the initial dictionary. */
+		if (code_new > clear_code) {
+			return LZW_BAD_ICODE;
+		}
+		ctx->previous_code = code_new;
+		ctx->previous_code_first = code_new;
+		*code_out = code_new;
+		return LZW_OK;
+	}
 
-	} else if (code_new > current_entry) {
+	if (code_new > current_entry) {
 		/* Code is invalid */
 		return LZW_BAD_CODE;
-
-	} else if (code_new < current_entry) {
-		/* Code is in table */
-		code_out = code_new;
-		last_value = table[code_new].first_value;
-	} else {
-		/* Code not in table */
-		*stack_pos++ = ctx->previous_code_first;
-		code_out = ctx->previous_code;
-		last_value = ctx->previous_code_first;
 	}
 
-	/* Add to the dictionary, only if there's space */
+	/* First value of the code's record.  If the code is not in the table
+	 * yet, it's the previous record plus its own first value. */
+	first_value = (code_new < current_entry) ?
+			lzw__first(ctx, code_new) : ctx->previous_code_first;
+
+	/* Add to the dictionary, only if there's space.  If the code is not
+	 * in the table yet, this is the entry it refers to. */
 	if (current_entry < (1 << LZW_CODE_MAX)) {
 		struct lzw_dictionary_entry *entry = table + current_entry;
-		entry->last_value     = last_value;
+		entry->last_value     = first_value;
+#ifdef PREF_LZW_COMPACT
+		entry->previous_lo    = ctx->previous_code & 0xff;
+		entry->previous_hi    = ctx->previous_code >> 8;
+#else
 		entry->first_value    = ctx->previous_code_first;
 		entry->previous_entry = ctx->previous_code;
+		entry->count          = table[ctx->previous_code].count + 1;
+#endif
 		ctx->current_entry++;
 	}
 
@@ -359,19 +520,133 @@ lzw_result lzw_decode(struct lzw_ctx *ctx,
 	}
 
 	/* Store details of this code as "previous code" to the context. */
-	ctx->previous_code_first = table[code_new].first_value;
+	ctx->previous_code_first = first_value;
 	ctx->previous_code = code_new;
 
-	/* Put rest of data for this code on output stack.
-	 * Note, in the case of "code not in table", the last entry of the
-	 * current code has already been placed on the stack above. */
+	*code_out = code_new;
+	return LZW_OK;
+}
+
+
+/* Exported function, documented in lzw.h */
+lzw_result lzw_decode(struct lzw_ctx *ctx,
+		const uint8_t ** const stack_pos_out)
+{
+	lzw_result res;
+	uint32_t code_out;
+	uint8_t *stack_pos = ctx->stack_base;
+	uint32_t clear_code = ctx->clear_code;
+	struct lzw_dictionary_entry * const table = ctx->table;
+
+	res = lzw__decode_code(ctx, &code_out);
+	if (res != LZW_OK) {
+		return res;
+	}
+
+	/* Put data for this code on output stack, last value first. */
 	while (code_out > clear_code) {
 		struct lzw_dictionary_entry *entry = table + code_out;
 		*stack_pos++ = entry->last_value;
-		code_out = entry->previous_entry;
+		code_out = lzw__previous(entry);
 	}
 	*stack_pos++ = table[code_out].last_value;
 
 	*stack_pos_out = stack_pos;
 	return LZW_OK;
 }
+
+
+/**
+ * Write (part of) the record for a code into the output, in order.
+ *
+ * The record is written back to front, following the dictionary entries.
+ * If it doesn't fit, the start of the record is written, and the rest is
+ * remembered in the context.
+ *
+ * \param[in]  ctx     LZW decompression context, updated.
+ * \param[in]  out     Where to write.
+ * \param[in]  room    Number of bytes that fit at `out`.
+ * \param[in]  code    Dictionary entry the record ends at.
+ * \param[in]  left    Number of bytes at the end of the record to write.
+ * \return number of bytes written.
+ */
+static inline uint32_t lzw__write_record(
+		struct lzw_ctx *ctx,
+		uint8_t *out,
+		uint32_t room,
+		uint32_t code,
+		uint32_t left)
+{
+	const struct lzw_dictionary_entry * const table = ctx->table;
+	uint32_t n = (left < room) ? left : room;
+	uint32_t skip = left - n;
+
+	/* Remember the end of the record, if we can't write it now */
+	ctx->output_code = code;
+	ctx->output_left = skip;
+
+	while (skip-- > 0) {
+		code = lzw__previous(table + code);
+	}
+
+	out += n;
+	for (uint32_t i = n; i > 0; i--) {
+		const struct lzw_dictionary_entry *entry = table + code;
+		*--out = entry->last_value;
+		code = lzw__previous(entry);
+	}
+
+	return n;
+}
+
+
+/* Exported function, documented in lzw.h */
+lzw_result lzw_decode_buffer(struct lzw_ctx *ctx,
+		uint8_t *out,
+		uint32_t length,
+		uint32_t *written_out)
+{
+	lzw_result res = LZW_OK;
+	uint8_t *pos = out;
+	uint8_t *end = out + length;
+	uint32_t clear_code = ctx->clear_code;
+	const struct lzw_dictionary_entry * const table = ctx->table;
+
+	/* Finish the record that didn't fit last time */
+	if (ctx->output_left > 0) {
+		pos += lzw__write_record(ctx, pos, length,
+				ctx->output_code, ctx->output_left);
+	}
+
+	while (pos < end) {
+		uint32_t code;
+		uint32_t count;
+
+		res = lzw__decode_code(ctx, &code);
+		if (res != LZW_OK) {
+			break;
+		}
+
+		if (code < clear_code) {
+			*pos++ = table[code].last_value;
+			continue;
+		}
+
+		count = lzw__count(ctx, code);
+		if (count <= (uint32_t)(end - pos)) {
+			/* Whole record fits, write it straight in */
+			uint8_t *p = pos + count;
+			while (p > pos) {
+				*--p = table[code].last_value;
+				code = lzw__previous(table + code);
+			}
+			pos += count;
+		} else {
+			pos += lzw__write_record(ctx, pos, end - pos,
+					code, count);
+		}
+	}
+
+	*written_out = pos - out;
+	return res;
+}
@@ -17,6 +17,10 @@
  */
 
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /** Maximum LZW code size in bits */
 #define LZW_CODE_MAX 12
 
@@ -37,6 +41,20 @@ typedef enum lzw_result {
 } lzw_result;
 
 
+/**
+ * Source of LZW sub-blocks for streamed input.
+ *
+ * Copies the data of the next sub-block into `buf`, if all of it is
+ * available.
+ *
+ * \param[in]  pw   Client data, as passed to lzw_decode_init_stream().
+ * \param[out] buf  Buffer to fill, room for 255 bytes.
+ * \return size of the sub-block (0 for the terminator), or -1 if there
+ *         is no complete sub-block yet.
+ */
+typedef int (*lzw_read_fn)(void *pw, uint8_t *buf);
+
+
 /**
  * Create an LZW decompression context.
  *
@@ -58,7 +76,8 @@ void lzw_context_destroy(
 /**
  * Initialise an LZW decompression context for decoding.
  *
- * Caller owns neither `stack_base_out` or `stack_pos_out`.
+ * Caller owns neither `stack_base_out` or `stack_pos_out`.  The stack is
+ * empty after this, nothing is decoded until lzw_decode() is called.
  *
  * \param[in]  ctx                  The LZW decompression context to initialise.
  * \param[in]  compressed_data      The compressed data.
@@ -81,6 +100,30 @@ lzw_result lzw_decode_init(
 		const uint8_t ** const stack_base_out,
 		const uint8_t ** const stack_pos_out);
 
+/**
+ * Initialise an LZW decompression context for decoding streamed input.
+ *
+ * Rather than reading from a buffer with the complete GIF, sub-blocks are
+ * obtained one at a time from the `read` function.  Only the current
+ * sub-block is kept in the context.
+ *
+ * When `read` has nothing, decoding returns LZW_NO_DATA, and can be
+ * resumed when more data has come in.
+ *
+ * Use lzw_decode_buffer() to decode.
+ *
+ * \param[in]  ctx             The LZW decompression context to initialise.
+ * \param[in]  read            Function to get sub-block data.
+ * \param[in]  pw              Client data passed to `read`.
+ * \param[in]  code_size       The initial LZW code size to use.
+ * \return LZW_OK on success, or appropriate error code otherwise.
+ */
+lzw_result lzw_decode_init_stream(
+		struct lzw_ctx *ctx,
+		lzw_read_fn read,
+		void *pw,
+		uint8_t code_size);
+
 /**
  * Fill the LZW stack with decompressed data
  *
@@ -101,5 +144,29 @@ lzw_result lzw_decode(
 		struct lzw_ctx *ctx,
 		const uint8_t ** const stack_pos_out);
 
+/**
+ * Decode into an output buffer, in order.
+ *
+ * Decodes until `length` bytes have been written, or the data ends.
+ * A record that doesn't fit is continued on the next call.
+ * Don't mix this with lzw_decode() on the same context.
+ *
+ * \param[in]  ctx          LZW decompression context, updated.
+ * \param[out] out          Buffer to write to.
+ * \param[in]  length       Number of bytes wanted.
+ * \param[out] written_out  Returns number of bytes written.
+ * \return LZW_OK if the buffer was filled, or appropriate code otherwise.
+ *         LZW_NO_DATA for streamed input means try again later.
+ */
+lzw_result lzw_decode_buffer(
+		struct lzw_ctx *ctx,
+		uint8_t *out,
+		uint32_t length,
+		uint32_t *written_out);
+
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
@@ -34,4 +34,58 @@
 
 // Number of buffers for the Clock module
 #define	PREF_CLOCK_NB	3
+// Pre-render the clock digits, so a minute tick is a couple of block transfers (about 20 KB of RAM)
+#if defined(ESP32)
+#define	PREF_CLOCK_SPRITES
+#endif
 #define	PREF_WEATHER_NB	3
+
+// Read the touch panel this often (ms) while touched, or all the time if T_IRQ isn't connected
+#define	PREF_TOUCH_INTERVAL	10
+// Dimming the backlight takes this long (ms), see BackLight.h for the curves
+#define	PREF_BACKLIGHT_FADE	3000
+#define	PREF_BACKLIGHT_CURVE	FADE_LINEAR
+// ESP8266 : fade the backlight with a timer tick of this many ms
+#define	PREF_BACKLIGHT_STEP	20
+
+// Pick up codes from the radio receiver this often (ms), it only remembers the last one
+#define	PREF_RADIO_POLL	5
+// Codes from the same sensor less than this apart (ms) are one trigger
+#define	PREF_SENSOR_HOLDOFF	3000
+// Report a sensor that we haven't heard from in this long (s), 0 to not check. Checked every
+// PREF_SENSOR_SWEEP seconds.
+#define	PREF_SENSOR_SUPERVISION	(7 * 24 * 3600)
+#define	PREF_SENSOR_SWEEP	60
+
+// Time (s) to leave after arming, and to disarm after coming in
+#define	PREF_ALARM_EXIT_DELAY	30
+#define	PREF_ALARM_ENTRY_DELAY	20
+// ESP8266 : flash offset of two sectors kept for the armed state. Keypad/eagle.flash.4m.alarm.ld
+// takes them off SPIFFS, without it the EEPROM sector is used alone. ESP32 looks for the "alarm"
+// partition, see Keypad/partitions.csv.
+#define	PREF_ALARM_STORE_ADDR	0x3FA000
+
+// Event log on SPIFFS : file name and number of 32 byte records it keeps
+#define	PREF_JOURNAL_FN		"/journal"
+#define	PREF_JOURNAL_RECORDS	512
+// Records kept in RAM until they're written, and how long they may wait (s)
+#define	PREF_JOURNAL_BUFFER	16
+#define	PREF_JOURNAL_FLUSH	30
+
+// Card table on SPIFFS, sorted by UID (see tools/cards.c). Cards from secrets.h work as well.
+#define	PREF_RFID_CARDS_FN	"/cards"
+
+// Decoded weather icons kept in RAM (bytes), see IconCache.cpp
+#define	PREF_ICON_CACHE_SIZE	16384
+// Also keep them on SPIFFS, so we can do without network after a reboot
+#undef	PREF_ICON_CACHE_SPIFFS
+// Decode the weather icon while it downloads, rather than buffering the file for libnsgif
+#define	PREF_GIF_STREAMING
+// Time (us) LoadGif::loop() may spend on an icon download per call
+#define	PREF_GIF_SLICE_US	3000
+// Play animated weather icons. Keeps GIF files up to this size (bytes) and a decoded frame in RAM.
+#define	PREF_GIF_ANIMATION	8192
+// Smaller LZW decoder state (3 byte dictionary entries, one static context), to spare the ESP8266 heap
+#if defined(ESP8266)
+#define	PREF_LZW_COMPACT
+#endif
@@ -0,0 +1,205 @@
+/*
+ * Run the alarm state machine (see Keypad/AlarmMachine.h) on a PC
+ *
+ *	c++ -O2 -Wall -I../Keypad -o alarmtest alarmtest.cpp
+ *	./alarmtest [-n events] [-s seed]
+ *
+ * Feeds random events, 10 million by default, to AlarmStep() and checks every step
+ * against what the alarm must do, written down here without the table. Now and then
+ * it starts over, as Alarm::Restore() does after a reboot. Timeouts come both when
+ * the delay is over and at random, like a late loop() would deliver them.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <AlarmMachine.h>
+
+static const char *states[] = { "disarmed", "exit delay", "armed", "night", "entry delay", "sounding" };
+static const char *events[] = { "arm", "arm night", "disarm", "secure", "perimeter", "always",
+  "peer alarm", "reset", "timeout" };
+static const char *actions[] = { "none", "exit", "entry", "sound", "sound peer" };
+static const char *status[] = { "off", "on", "night" };
+
+static uint64_t rng;
+
+static uint32_t Random(uint32_t n) {
+  rng ^= rng << 13;
+  rng ^= rng >> 7;
+  rng ^= rng << 17;
+  return (rng >> 32) % n;
+}
+
+/* The state for how we're armed, without delays : see Alarm::Restore() */
+static AlarmState Rest(AlarmStatus a) {
+  return (a == ALARM_ON) ? STATE_ARMED : (a == ALARM_NIGHT) ? STATE_NIGHT : STATE_DISARMED;
+}
+
+static const char *failure;
+static long failures;
+
+static void Check(bool ok, const char *what) {
+  if (! ok && failure == 0)
+    failure = what;
+}
+
+/*
+ * One step, from s/a with ev to ns/na doing act
+ */
+static void Invariants(AlarmState s, AlarmStatus a, AlarmEvent ev, AlarmState ns, AlarmStatus na, int act) {
+  bool sensor = ev == EVENT_SENSOR_SECURE || ev == EVENT_SENSOR_PERIMETER;
+
+  Check(ns < STATE_NB, "not a state");
+
+  // The armed status matches the state, and an alarm doesn't change it
+  switch (ns) {
+  case STATE_DISARMED:
+    Check(na == ALARM_OFF, "disarmed but armed");
+    break;
+  case STATE_EXIT_DELAY:
+  case STATE_ARMED:
+  case STATE_ENTRY_DELAY:
+    Check(na == ALARM_ON, "armed but not on");
+    break;
+  case STATE_NIGHT:
+    Check(na == ALARM_NIGHT, "night but not night");
+    break;
+  case STATE_SOUNDING:
+    Check(na == a, "an alarm changed the armed status");
+    break;
+  default:
+    break;
+  }
+
+  // Disarming always works, and does nothing else
+  if (ev == EVENT_DISARM)
+    Check(ns == STATE_DISARMED && act == ACT_NONE, "disarm didn't");
+
+  // Fire goes off in any state, peers' alarms too but aren't sent back
+  if (ev == EVENT_SENSOR_ALWAYS || ev == EVENT_PEER_ALARM)
+    Check(ns == STATE_SOUNDING, "alarm ignored");
+  if (ev == EVENT_PEER_ALARM)
+    Check(act != ACT_SOUND, "peer alarm forwarded");
+
+  // Sounding starts once, with the alarm, and only a reset or disarm stops it
+  Check((act == ACT_SOUND || act == ACT_SOUND_PEER) == (ns == STATE_SOUNDING && s != STATE_SOUNDING),
+    "sounding without the alarm, or the other way around");
+  if (s == STATE_SOUNDING && ev != EVENT_DISARM && ev != EVENT_RESET)
+    Check(ns == STATE_SOUNDING, "alarm stopped");
+  if (s == STATE_SOUNDING && ev == EVENT_RESET)
+    Check(ns == Rest(a), "reset didn't resume");
+
+  // Each delay starts its timer when it begins, and only then
+  Check((act == ACT_EXIT) == (ns == STATE_EXIT_DELAY && s != STATE_EXIT_DELAY), "exit delay without timer");
+  Check((act == ACT_ENTRY) == (ns == STATE_ENTRY_DELAY && s != STATE_ENTRY_DELAY), "entry delay without timer");
+
+  // Sensors : nothing when disarmed or leaving, no delay at night, secure zone not at night
+  if (sensor && (s == STATE_DISARMED || s == STATE_EXIT_DELAY))
+    Check(ns == s, "sensor counted while disarmed or leaving");
+  if (sensor && s == STATE_NIGHT)
+    Check(ns == (ev == EVENT_SENSOR_SECURE ? STATE_NIGHT : STATE_SOUNDING), "night zones");
+  if (ns == STATE_ENTRY_DELAY && s != STATE_ENTRY_DELAY)
+    Check(s == STATE_ARMED && sensor, "entry delay but not armed");
+
+  // A timeout only ends a delay
+  if (ev == EVENT_TIMEOUT)
+    Check(ns == (s == STATE_EXIT_DELAY ? STATE_ARMED : s == STATE_ENTRY_DELAY ? STATE_SOUNDING : s),
+      "timeout outside a delay");
+
+  if (failure) {
+    if (failures++ < 10)
+      printf("%s : %s, %s, %s -> %s, %s, %s\n", failure, states[s], status[a], events[ev],
+        states[ns], status[na], actions[act]);
+    failure = 0;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  long n = 10000000, restarts = 0, timeouts = 0, sounded = 0;
+  long seen[STATE_NB][EVENT_NB];
+  int opt;
+
+  rng = 0x9E3779B97F4A7C15ULL;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1)
+    switch (opt) {
+    case 'n':
+      n = atol(optarg);
+      break;
+    case 's':
+      rng ^= strtoull(optarg, 0, 0) * 0xBF58476D1CE4E5B9ULL;
+      break;
+    default:
+      fprintf(stderr, "Usage : %s [-n events] [-s seed]\n", argv[0]);
+      exit(1);
+    }
+  if (rng == 0)
+    rng = 1;
+
+  memset(seen, 0, sizeof(seen));
+
+  AlarmStatus armed = ALARM_OFF;
+  AlarmState state = STATE_DISARMED;
+  int timer = 0;			// Events until the delay is over
+
+  for (long i = 0; i < n; i++) {
+    AlarmEvent ev;
+
+    if (Random(1000) == 0) {		// Reboot
+      armed = (AlarmStatus)Random(3);
+      state = Rest(armed);
+      timer = 0;
+      restarts++;
+    }
+
+    if ((state == STATE_EXIT_DELAY || state == STATE_ENTRY_DELAY) && --timer <= 0) {
+      ev = EVENT_TIMEOUT;
+      timeouts++;
+    } else
+      ev = (AlarmEvent)Random(EVENT_NB);
+
+    AlarmState s = state;
+    AlarmStatus a = armed;
+    int act = AlarmStep(&state, &armed, ev);
+
+    seen[s][ev]++;
+    Invariants(s, a, ev, state, armed, act);
+
+    if (act == ACT_EXIT || act == ACT_ENTRY)
+      timer = 1 + Random(20);
+    if (act == ACT_SOUND || act == ACT_SOUND_PEER)
+      sounded++;
+  }
+
+  // Every transition in the table must have been tried
+  int missed = 0;
+  for (int s = 0; s < STATE_NB; s++)
+    for (int e = 0; e < EVENT_NB; e++)
+      if (seen[s][e] == 0) {
+        printf("Never tried : %s, %s\n", states[s], events[e]);
+        missed++;
+      }
+
+  printf("%ld events, %ld restarts, %ld timeouts, %ld alarms : %ld failed, %d transitions missed\n",
+    n, restarts, timeouts, sounded, failures, missed);
+  return failures != 0 || missed != 0;
+}
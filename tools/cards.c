@@ -0,0 +1,169 @@
+/*
+ * Build the RFID card table (see Keypad/Rfid.cpp) on a PC
+ *
+ *	cc -o cards cards.c
+ *	./cards cards.txt data/cards
+ *
+ * One card per line, # starts a comment :
+ *
+ *	uid		user	[actions [from [until]]]
+ *	04:A3:2B:11	danny	ad	2018-01-01	2018-12-31
+ *
+ * Actions : a to arm, d to disarm (default ad). Dates are YYYY-MM-DD, or - for no limit.
+ * The output goes on SPIFFS as /cards, then {"cards" : "reload"} to the peer REST port.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Same as in Keypad/Rfid.h, little endian */
+struct RfidCard {
+  uint8_t	size;
+  uint8_t	uid[10];
+  uint8_t	actions;
+  uint32_t	from, until;
+  char		user[12];
+};
+
+#define	RFID_ARM	0x01
+#define	RFID_DISARM	0x02
+
+#define	KEYLEN	11		/* size and uid : the sort key */
+
+static int byUid(const void *a, const void *b) {
+  return memcmp(a, b, KEYLEN);
+}
+
+static int date(const char *s, uint32_t *t) {
+  struct tm tm;
+
+  if (s == NULL || strcmp(s, "-") == 0) {
+    *t = 0;
+    return 1;
+  }
+  memset(&tm, 0, sizeof(tm));
+  if (sscanf(s, "%d-%d-%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday) != 3)
+    return 0;
+  tm.tm_year -= 1900;
+  tm.tm_mon -= 1;
+  tm.tm_isdst = -1;
+  *t = mktime(&tm);
+  return 1;
+}
+
+int main(int argc, char *argv[]) {
+  FILE *in, *out;
+  struct RfidCard *c = 0;
+  int n = 0, max = 0, line = 0, errors = 0;
+  char buf[256];
+
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s cards.txt output\n", argv[0]);
+    exit(1);
+  }
+  if ((in = fopen(argv[1], "r")) == NULL) {
+    perror(argv[1]);
+    exit(1);
+  }
+
+  while (fgets(buf, sizeof(buf), in)) {
+    char *uid, *user, *actions, *from, *until, *p;
+    struct RfidCard *r;
+
+    line++;
+    if ((p = strchr(buf, '#')) != NULL)
+      *p = 0;
+    if ((uid = strtok(buf, " \t\r\n")) == NULL)
+      continue;
+    user = strtok(NULL, " \t\r\n");
+    actions = strtok(NULL, " \t\r\n");
+    from = strtok(NULL, " \t\r\n");
+    until = strtok(NULL, " \t\r\n");
+
+    if (n == max) {
+      max = max ? 2 * max : 256;
+      c = realloc(c, max * sizeof(struct RfidCard));
+    }
+    r = &c[n];
+    memset(r, 0, sizeof(*r));
+
+    for (p = uid; *p && r->size < sizeof(r->uid); ) {
+      unsigned int x;
+      int len;
+
+      if (sscanf(p, "%2x%n", &x, &len) != 1)
+        break;
+      r->uid[r->size++] = x;
+      p += len;
+      if (*p == ':')
+        p++;
+    }
+    if (*p || r->size == 0 || user == NULL) {
+      fprintf(stderr, "%s:%d: bad card\n", argv[1], line);
+      errors++;
+      continue;
+    }
+    /* Not terminated if it fills the field, r is zeroed */
+    if (strlen(user) > sizeof(r->user))
+      fprintf(stderr, "%s:%d: user %s shortened\n", argv[1], line, user);
+    memcpy(r->user, user, strlen(user) < sizeof(r->user) ? strlen(user) : sizeof(r->user));
+
+    for (p = actions ? actions : "ad"; *p; p++)
+      if (*p == 'a')
+        r->actions |= RFID_ARM;
+      else if (*p == 'd')
+        r->actions |= RFID_DISARM;
+      else if (*p != '-') {
+        fprintf(stderr, "%s:%d: bad action %c\n", argv[1], line, *p);
+        errors++;
+      }
+
+    if (! date(from, &r->from) || ! date(until, &r->until)) {
+      fprintf(stderr, "%s:%d: bad date\n", argv[1], line);
+      errors++;
+      continue;
+    }
+    n++;
+  }
+  fclose(in);
+
+  qsort(c, n, sizeof(struct RfidCard), byUid);
+  for (int i = 1; i < n; i++)
+    if (byUid(&c[i-1], &c[i]) == 0) {
+      fprintf(stderr, "Card for %.12s and %.12s is the same\n", c[i-1].user, c[i].user);
+      errors++;
+    }
+  if (errors)
+    exit(1);
+
+  if ((out = fopen(argv[2], "wb")) == NULL) {
+    perror(argv[2]);
+    exit(1);
+  }
+  fwrite(c, sizeof(struct RfidCard), n, out);
+  fclose(out);
+  printf("%d cards\n", n);
+  free(c);
+  return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Fuzz the keypad's GIF decoder
+ *
+ *	make fuzz			(needs clang with libFuzzer)
+ *	./fuzz -max_len=65536 corpus/ icons/ bad/
+ *
+ * Without clang, "make replay" builds the same entry point with a main() that runs
+ * it once per file, under the sanitizers : for the corpus, or a crash file from elsewhere.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t len);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t len) {
+  struct GifHostResult r;
+
+  host_decode(data, len, &r);
+  free(r.image);
+  return 0;
+}
+
+#ifdef REPLAY
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; i++) {
+    uint8_t *data;
+    size_t len;
+
+    if ((data = host_read(argv[i], &len)) == NULL)
+      exit(1);
+    LLVMFuzzerTestOneInput(data, len);
+    free(data);
+  }
+  printf("%d files\n", argc - 1);
+  return 0;
+}
+#endif
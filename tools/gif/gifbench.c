@@ -0,0 +1,78 @@
+/*
+ * How fast the keypad's GIF decoder runs on a PC, and how much heap it takes
+ *
+ *	make bench
+ *	./gifbench [-t seconds] file.gif ..
+ *
+ * Each file is decoded over and over for the given time (default 0.5 s).
+ * Only a comparison between builds : the ESP is a lot slower.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+int main(int argc, char *argv[]) {
+  double limit = 0.5, total = 0;
+  size_t peak = 0;
+
+  if (argc > 2 && strcmp(argv[1], "-t") == 0) {
+    limit = atof(argv[2]);
+    argc -= 2, argv += 2;
+  }
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s [-t seconds] file.gif ..\n", argv[0]);
+    exit(1);
+  }
+
+  printf("%-30s %10s %10s %10s %8s\n", "file", "decodes/s", "us", "peak", "allocs");
+  for (int i = 1; i < argc; i++) {
+    struct GifHostResult r;
+    uint8_t *data;
+    size_t len;
+    unsigned long n = 0;
+    double start, t;
+
+    if ((data = host_read(argv[i], &len)) == NULL)
+      exit(1);
+
+    host_mem_reset();
+    size_t before = host_mem.current;
+    start = host_now();
+    do {
+      host_decode(data, len, &r);
+      free(r.image);
+      n++;
+    } while ((t = host_now() - start) < limit);
+
+    const char *name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+    printf("%-30s %10.0f %10.1f %10zu %8lu\n", name, n / t, t * 1e6 / n,
+      host_mem.peak - before, host_mem.allocs / n);
+    total += t / n;
+    if (host_mem.peak - before > peak)
+      peak = host_mem.peak - before;
+    free(data);
+  }
+  printf("%-30s %10.0f %10.1f %10zu\n", "(all files once)", 1 / total, total * 1e6, peak);
+  return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Decode GIF files the way the keypad does, report what came out and the heap it took
+ *
+ *	make check
+ *	./gifcheck [-k] file.gif ..
+ *
+ * With -k, every file must decode (the icons). Without it, broken files are
+ * expected, it just mustn't crash or leak : run the sanitizer build.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libnsgif.h"
+#include "host.h"
+
+static const char *results[] = {
+  "ok", "insufficient frame data", "frame data error", "insufficient data",
+  "data error", "insufficient memory", "frame no display", "end of frame"
+};
+
+#define	RESULT(c)	((c) <= 0 && -(c) < (int)(sizeof(results) / sizeof(results[0])) ? results[-(c)] : "?")
+
+int main(int argc, char *argv[]) {
+  int keep = 0, errors = 0;
+
+  if (argc > 1 && strcmp(argv[1], "-k") == 0) {
+    keep = 1;
+    argc--, argv++;
+  }
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s [-k] file.gif ..\n", argv[0]);
+    exit(1);
+  }
+
+  for (int i = 1; i < argc; i++) {
+    struct GifHostResult r;
+    uint8_t *data;
+    size_t len, base = host_mem.current;
+
+    if ((data = host_read(argv[i], &len)) == NULL) {
+      errors++;
+      continue;
+    }
+
+    host_mem_reset();
+    size_t before = host_mem.current;
+    host_decode(data, len, &r);
+    int ok = r.init == GIF_OK && r.image != NULL && r.frame_errors == 0;
+
+    printf("%-40s %-24s %3ux%-3u %4u frame%s%s %6zu bytes peak, %lu allocs\n", argv[i],
+      r.init == GIF_OK && r.image == NULL ? "no image" : RESULT(r.init),
+      r.width, r.height, r.frames, r.frames == 1 ? " " : "s",
+      r.looping ? " looping" : "        ", host_mem.peak - before, host_mem.allocs);
+    if (r.frame_errors)
+      printf("%-40s %d frame(s) failed to decode\n", "", r.frame_errors);
+
+    free(r.image);
+    free(data);
+    if (host_mem.current != base) {
+      printf("%s: %zu bytes not freed\n", argv[i], host_mem.current - base);
+      errors++;
+    }
+    if (keep && ! ok)
+      errors++;
+  }
+  return errors ? 1 : 0;
+}
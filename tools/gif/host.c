@@ -0,0 +1,184 @@
+/*
+ * Run the GIF decoder of the keypad (Keypad/libnsgif.c, lzw.c) on a PC
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libnsgif.h"
+#include "host.h"
+
+/* Same as in Keypad/LoadGif.cpp */
+static void *bitmap_create(int width, int height) {
+  if (width > 75 || height > 75)
+    return NULL;
+  return malloc(width * height * 2);
+}
+
+static void bitmap_destroy(void *bitmap) {
+  free(bitmap);
+}
+
+static unsigned char *bitmap_get_buffer(void *bitmap) {
+  return (unsigned char *)bitmap;
+}
+
+static gif_bitmap_callback_vt callbacks = {
+  bitmap_create,
+  bitmap_destroy,
+  bitmap_get_buffer,
+  NULL, NULL, NULL
+};
+
+void host_decode(const uint8_t *data, size_t len, struct GifHostResult *r) {
+  gif_animation gif;
+  gif_result code;
+  unsigned char *buf;
+
+  memset(r, 0, sizeof(*r));
+
+  /* The keypad decodes from its download buffer, this makes overreads visible too */
+  if ((buf = malloc(len ? len : 1)) == NULL) {
+    r->init = GIF_INSUFFICIENT_MEMORY;
+    return;
+  }
+  memcpy(buf, data, len);
+
+  gif_create(&gif, &callbacks);
+  gif.format = GIF_FORMAT_RGB565;
+  do {
+    code = gif_initialise(&gif, len, buf);
+  } while (code == GIF_WORKING);
+  r->init = code;
+
+  if (code == GIF_OK) {
+    r->width = gif.width;
+    r->height = gif.height;
+    r->frames = gif.frame_count;
+    r->looping = gif.looping;
+    for (unsigned i = 0; i != gif.frame_count; i++)
+      if (gif_decode_frame(&gif, i) != GIF_OK)
+        r->frame_errors++;
+    r->image = (uint16_t *)gif.frame_image;
+    gif.frame_image = NULL;
+  }
+
+  gif_finalise(&gif);
+  free(buf);
+}
+
+/*
+ * Heap accounting. Linked with -Wl,--wrap=malloc (etc), so only calls from
+ * the decoder and the harness get here, not those inside libc.
+ */
+struct GifHostMem host_mem;
+
+#define	HDR	16		/* keeps the alignment malloc gives */
+
+void *__real_malloc(size_t);
+void *__real_realloc(void *, size_t);
+void __real_free(void *);
+
+static void *account(char *p, size_t n) {
+  if (p == NULL)
+    return NULL;
+  *(size_t *)p = n;
+  host_mem.current += n;
+  host_mem.allocs++;
+  if (host_mem.current > host_mem.peak)
+    host_mem.peak = host_mem.current;
+  return p + HDR;
+}
+
+void *__wrap_malloc(size_t n) {
+  if (n > (size_t)-1 - HDR)
+    return NULL;
+  return account(__real_malloc(n + HDR), n);
+}
+
+void *__wrap_calloc(size_t m, size_t n) {
+  void *p;
+
+  if (n && m > ((size_t)-1 - HDR) / n)
+    return NULL;
+  if ((p = __wrap_malloc(m * n)) != NULL)
+    memset(p, 0, m * n);
+  return p;
+}
+
+void __wrap_free(void *p) {
+  if (p == NULL)
+    return;
+  p = (char *)p - HDR;
+  host_mem.current -= *(size_t *)p;
+  __real_free(p);
+}
+
+void *__wrap_realloc(void *p, size_t n) {
+  char *q;
+  size_t old;
+
+  if (p == NULL)
+    return __wrap_malloc(n);
+  if (n > (size_t)-1 - HDR)
+    return NULL;
+  q = (char *)p - HDR;
+  old = *(size_t *)q;
+  if ((q = __real_realloc(q, n + HDR)) == NULL)
+    return NULL;
+  host_mem.current -= old;
+  return account(q, n);
+}
+
+void host_mem_reset(void) {
+  host_mem.peak = host_mem.current;
+  host_mem.allocs = 0;
+}
+
+uint8_t *host_read(const char *fn, size_t *len) {
+  FILE *f;
+  uint8_t *data = NULL;
+  long n;
+
+  if ((f = fopen(fn, "rb")) == NULL) {
+    perror(fn);
+    return NULL;
+  }
+  if (fseek(f, 0, SEEK_END) == 0 && (n = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0
+      && (data = malloc(n ? n : 1)) != NULL && fread(data, 1, n, f) == (size_t)n) {
+    *len = n;
+  } else {
+    fprintf(stderr, "%s: cannot read\n", fn);
+    free(data);
+    data = NULL;
+  }
+  fclose(f);
+  return data;
+}
+
+double host_now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,54 @@
+/*
+ * Run the GIF decoder of the keypad (Keypad/libnsgif.c, lzw.c) on a PC
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef _GIF_HOST_H_
+#define _GIF_HOST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct GifHostResult {
+  int		init;		/* gif_initialise() outcome, GIF_OK or an error */
+  int		frame_errors;	/* frames that gif_decode_frame() didn't like */
+  unsigned	width, height, frames;
+  int		looping;
+  uint16_t	*image;		/* RGB565, width x height, caller frees, or 0 */
+};
+
+/* Heap use since the last host_mem_reset(), counted by the malloc wrappers (see Makefile) */
+struct GifHostMem {
+  size_t	current, peak;
+  unsigned long	allocs;
+};
+
+/*
+ * The same steps as LoadGif::BufferedGif() and LoadGif::Decode2() : initialise, decode
+ * all frames, take the frame image. The bitmap allocator refuses more than 75x75 as well.
+ */
+void host_decode(const uint8_t *data, size_t len, struct GifHostResult *r);
+
+void host_mem_reset(void);
+extern struct GifHostMem host_mem;
+
+uint8_t *host_read(const char *fn, size_t *len);
+double host_now(void);
+
+#endif
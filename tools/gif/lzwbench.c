@@ -0,0 +1,194 @@
+/*
+ * How fast Keypad/lzw.c decompresses the image data of GIF files
+ *
+ *	make lzw
+ *	./lzwbench [-t seconds] file.gif ..
+ *
+ * Every image in the files is decoded, the way libnsgif does it (lzw_decode, a stack
+ * at a time) and the way GifStream does (lzw_decode_buffer, a row at a time).
+ * MB/s is counted on the decoded pixels, the compressed size is there too.
+ * "make lzw" runs it built with and without PREF_LZW_COMPACT.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lzw.h"
+#include "host.h"
+
+struct Image {
+  const uint8_t	*data;		/* the whole file */
+  uint32_t	len;
+  uint32_t	pos;		/* first sub-block of the image data */
+  uint8_t	code_size;
+  uint32_t	width;		/* a row, for lzw_decode_buffer() */
+  uint32_t	compressed;
+};
+
+static struct Image *images;
+static int nimages;
+
+/* The sub-blocks starting at p, returns what follows or 0 if they're cut off */
+static uint32_t skip(const uint8_t *d, uint32_t len, uint32_t p, uint32_t *bytes) {
+  while (p < len && d[p] != 0) {
+    if (bytes)
+      *bytes += d[p];
+    p += d[p] + 1;
+  }
+  return p < len ? p + 1 : 0;
+}
+
+/* Find the images in a GIF file */
+static void scan(const char *fn, const uint8_t *d, uint32_t len) {
+  uint32_t p = 13;
+
+  if (len < 13 || memcmp(d, "GIF8", 4) != 0) {
+    fprintf(stderr, "%s: not a GIF file\n", fn);
+    exit(1);
+  }
+  if (d[10] & 0x80)
+    p += 3 << ((d[10] & 7) + 1);
+
+  while (p != 0 && p < len && d[p] != ';') {
+    if (d[p] == '!') {
+      p = skip(d, len, p + 2, NULL);
+    } else if (d[p] == ',' && p + 11 <= len) {
+      struct Image *im;
+      uint32_t width = d[p + 5] | (d[p + 6] << 8);
+
+      if (d[p + 9] & 0x80)
+        p += 3 << ((d[p + 9] & 7) + 1);
+      if (p + 11 > len)
+        break;
+      images = realloc(images, (nimages + 1) * sizeof(struct Image));
+      im = &images[nimages++];
+      im->data = d;
+      im->len = len;
+      im->width = width;
+      im->code_size = d[p + 10];
+      im->pos = p + 11;
+      im->compressed = 0;
+      p = skip(d, len, im->pos, &im->compressed);
+    } else {
+      break;
+    }
+  }
+}
+
+/* Decode all images once, returns the number of pixels */
+static unsigned long decode_stack(struct lzw_ctx *ctx) {
+  unsigned long n = 0;
+
+  for (int i = 0; i < nimages; i++) {
+    const uint8_t *base, *pos;
+    lzw_result res;
+
+    res = lzw_decode_init(ctx, images[i].data, images[i].len, images[i].pos,
+      images[i].code_size, &base, &pos);
+    while (res == LZW_OK) {
+      if ((res = lzw_decode(ctx, &pos)) == LZW_OK)
+        n += pos - base;
+    }
+  }
+  return n;
+}
+
+static unsigned long decode_buffer(struct lzw_ctx *ctx) {
+  unsigned long n = 0;
+  uint8_t row[65536];
+
+  for (int i = 0; i < nimages; i++) {
+    const uint8_t *base, *pos;
+    uint32_t written;
+    lzw_result res;
+
+    res = lzw_decode_init(ctx, images[i].data, images[i].len, images[i].pos,
+      images[i].code_size, &base, &pos);
+    while (res == LZW_OK) {
+      res = lzw_decode_buffer(ctx, row, images[i].width ? images[i].width : 1, &written);
+      n += written;
+    }
+  }
+  return n;
+}
+
+int main(int argc, char *argv[]) {
+  static const struct {
+    const char *name;
+    unsigned long (*decode)(struct lzw_ctx *);
+  } ways[] = {
+    { "lzw_decode", decode_stack },
+    { "lzw_decode_buffer", decode_buffer },
+  };
+  double limit = 0.5;
+  unsigned long compressed = 0;
+  struct lzw_ctx *ctx;
+
+  if (argc > 2 && strcmp(argv[1], "-t") == 0) {
+    limit = atof(argv[2]);
+    argc -= 2, argv += 2;
+  }
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s [-t seconds] file.gif ..\n", argv[0]);
+    exit(1);
+  }
+  for (int i = 1; i < argc; i++) {
+    uint8_t *data;
+    size_t len;
+
+    if ((data = host_read(argv[i], &len)) == NULL)
+      exit(1);
+    scan(argv[i], data, len);		/* data is kept until the end */
+  }
+  for (int i = 0; i < nimages; i++)
+    compressed += images[i].compressed;
+
+  host_mem_reset();
+  size_t before = host_mem.current;
+  if (lzw_context_create(&ctx) != LZW_OK) {
+    fprintf(stderr, "lzw_context_create failed\n");
+    exit(1);
+  }
+
+#ifdef PREF_LZW_COMPACT
+  printf("PREF_LZW_COMPACT, ");
+#endif
+  /* The compact build has a static context, for a start */
+  printf("%d images, %lu bytes compressed, context %zu bytes of heap\n", nimages, compressed,
+    host_mem.peak - before);
+  for (unsigned w = 0; w < sizeof(ways) / sizeof(ways[0]); w++) {
+    unsigned long n = 0, pixels = 0;
+    double start = host_now(), t;
+
+    do {
+      pixels += ways[w].decode(ctx);
+      n++;
+    } while ((t = host_now() - start) < limit);
+
+    printf("%-20s %8.1f MB/s out %8.1f MB/s in %10.1f us per pass, %lu pixels\n", ways[w].name,
+      pixels / t / 1e6, n * compressed / t / 1e6, t * 1e6 / n, pixels / n);
+  }
+
+  lzw_context_destroy(ctx);
+  return 0;
+}
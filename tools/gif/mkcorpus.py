@@ -0,0 +1,295 @@
+#!/usr/bin/env python3
+#
+# Generate the GIF test corpus for the host harness (see Makefile)
+#
+#	python3 mkcorpus.py
+#
+# icons/ : weather icon look-alikes (50x50, small palette, some animated) made with Pillow,
+#	as wunderground's own icons can't be redistributed.
+# bad/ : broken and unusual files, crafted byte by byte, that the decoder must survive.
+#
+# Output is deterministic, the generated files are kept in git so the benchmarks compare.
+#
+# Copyright (c) 2018 Danny Backx
+#
+# License (GNU Lesser General Public License) :
+#
+#   This program is free software; you can redistribute it and/or
+#   modify it under the terms of the GNU Lesser General Public
+#   License as published by the Free Software Foundation; either
+#   version 3 of the License, or (at your option) any later version.
+#
+#   This library is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#   Lesser General Public License for more details.
+#
+#   You should have received a copy of the GNU Lesser General Public
+#   License along with this library; if not, write to the Free Software
+#   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+
+import math
+import os
+import struct
+
+from PIL import Image, ImageDraw
+
+SIZE = 50
+SKY = (170, 205, 240)
+SUN = (255, 200, 40)
+CLOUD = (235, 235, 240)
+DARK = (120, 125, 140)
+RAIN = (40, 110, 220)
+SNOW = (255, 255, 255)
+BOLT = (255, 230, 0)
+MOON = (230, 230, 190)
+NIGHT = (20, 30, 70)
+
+here = os.path.dirname(os.path.abspath(__file__))
+
+
+# ---- icons -------------------------------------------------------------------------------
+
+def canvas(bg=SKY):
+    im = Image.new("RGB", (SIZE, SIZE), bg)
+    return im, ImageDraw.Draw(im)
+
+
+def sun(d, cx=25, cy=25, r=10, phase=0.0):
+    for i in range(8):
+        a = phase + i * math.pi / 4
+        d.line([cx + (r + 3) * math.cos(a), cy + (r + 3) * math.sin(a),
+                cx + (r + 9) * math.cos(a), cy + (r + 9) * math.sin(a)], fill=SUN, width=2)
+    d.ellipse([cx - r, cy - r, cx + r, cy + r], fill=SUN, outline=(230, 150, 0))
+
+
+def cloud(d, x=8, y=18, color=CLOUD):
+    d.ellipse([x, y + 6, x + 18, y + 22], fill=color)
+    d.ellipse([x + 10, y, x + 30, y + 20], fill=color)
+    d.ellipse([x + 20, y + 6, x + 36, y + 22], fill=color)
+    d.rectangle([x + 8, y + 12, x + 28, y + 22], fill=color)
+
+
+def drops(d, t, color, snow=False):
+    for i in range(5):
+        x = 10 + i * 7
+        y = 38 + (t * 3 + i * 4) % 10
+        if snow:
+            d.text((x - 2, y - 6), "*", fill=color)
+        else:
+            d.line([x, y, x - 2, y + 4], fill=color, width=2)
+
+
+def quantize(im, colors):
+    # Adaptive palette without dithering, like the icons on the server
+    return im.quantize(colors=colors, method=Image.Quantize.MEDIANCUT, dither=Image.Dither.NONE)
+
+
+def still(name, draw, colors=32, transparent=False):
+    im, d = canvas((0, 0, 0) if transparent else SKY)
+    draw(d)
+    p = quantize(im, colors)
+    args = {}
+    if transparent:
+        args["transparency"] = p.getpixel((0, 0))
+    p.save(os.path.join(here, "icons", name + ".gif"), **args)
+
+
+def animated(name, draw, frames, colors=32, duration=150):
+    ims = []
+    for t in range(frames):
+        im, d = canvas()
+        draw(d, t)
+        ims.append(quantize(im, colors))
+    ims[0].save(os.path.join(here, "icons", name + ".gif"), save_all=True,
+                append_images=ims[1:], loop=0, duration=duration, optimize=False)
+
+
+def icons():
+    os.makedirs(os.path.join(here, "icons"), exist_ok=True)
+    still("clear", lambda d: sun(d))
+    still("sunny", lambda d: sun(d, r=12), colors=16)
+    still("cloudy", lambda d: (cloud(d, 4, 10, DARK), cloud(d, 10, 18)))
+    still("partlycloudy", lambda d: (sun(d, 18, 18, 8), cloud(d, 10, 20)))
+    still("mostlycloudy", lambda d: (sun(d, 14, 14, 6), cloud(d, 6, 14, DARK), cloud(d, 12, 20)))
+    still("fog", lambda d: [d.line([4, y, 46, y], fill=DARK, width=3) for y in range(10, 45, 7)],
+          colors=8)
+    still("hazy", lambda d: (sun(d), [d.line([0, y, 50, y], fill=CLOUD) for y in range(0, 50, 4)]))
+    still("rain", lambda d: (cloud(d, 6, 8, DARK), drops(d, 0, RAIN)))
+    still("snow", lambda d: (cloud(d, 6, 8), drops(d, 0, SNOW, True)), colors=16)
+    still("sleet", lambda d: (cloud(d, 6, 8, DARK), drops(d, 0, RAIN), drops(d, 2, SNOW, True)))
+    still("tstorms", lambda d: (cloud(d, 6, 8, DARK),
+                                d.polygon([(26, 28), (18, 40), (24, 40), (20, 49), (32, 35),
+                                           (26, 35), (30, 28)], fill=BOLT)))
+    still("nt_clear", lambda d: (d.rectangle([0, 0, 49, 49], fill=NIGHT),
+                                 d.ellipse([12, 12, 38, 38], fill=MOON),
+                                 d.ellipse([20, 8, 44, 32], fill=NIGHT)), colors=8)
+    still("nt_cloudy", lambda d: (d.rectangle([0, 0, 49, 49], fill=NIGHT),
+                                  d.ellipse([8, 6, 28, 26], fill=MOON), cloud(d, 10, 18, DARK)))
+    still("flurries", lambda d: (cloud(d, 6, 8), drops(d, 1, SNOW, True)), transparent=True)
+    still("gradient", lambda d: [d.line([0, y, 49, y], fill=(y * 5, 100, 255 - y * 5))
+                                 for y in range(50)], colors=64)
+    animated("anim_sun", lambda d, t: sun(d, phase=t * math.pi / 16), 4)
+    animated("anim_rain", lambda d, t: (cloud(d, 6, 8, DARK), drops(d, t, RAIN)), 6)
+    animated("anim_snow", lambda d, t: (cloud(d, 6, 8), drops(d, t, SNOW, True)), 6, colors=16)
+    animated("anim_storm", lambda d, t: (cloud(d, 6, 8, DARK), drops(d, t, RAIN),
+                                         t % 3 == 0 and d.polygon(
+                                             [(26, 28), (18, 40), (24, 40), (20, 49), (32, 35),
+                                              (26, 35), (30, 28)], fill=BOLT)), 6)
+
+
+# ---- broken files ------------------------------------------------------------------------
+
+def lzw(indices, min_size, clear_when_full=True, clear_first=True, eoi=True):
+    """GIF LZW encoder, with knobs to produce unusual streams"""
+    clear = 1 << min_size
+    end = clear + 1
+    out = []
+    acc = nbits = 0
+
+    def emit(code, size):
+        nonlocal acc, nbits
+        acc |= code << nbits
+        nbits += size
+        while nbits >= 8:
+            out.append(acc & 0xff)
+            acc >>= 8
+            nbits -= 8
+
+    size = min_size + 1
+    table = {(i,): i for i in range(clear)}
+    nxt = end + 1
+    if clear_first:
+        emit(clear, size)
+    w = ()
+    for k in indices:
+        wk = w + (k,)
+        if wk in table:
+            w = wk
+            continue
+        emit(table[w], size)
+        if nxt < 4096:
+            table[wk] = nxt
+            nxt += 1
+            if nxt > (1 << size) and size < 12:
+                size += 1
+        elif clear_when_full:
+            emit(clear, size)
+            table = {(i,): i for i in range(clear)}
+            nxt = end + 1
+            size = min_size + 1
+        w = (k,)
+    if w:
+        emit(table[w], size)
+    if eoi:
+        emit(end, size)
+    if nbits:
+        out.append(acc & 0xff)
+    return bytes(out)
+
+
+def blocks(data):
+    r = b""
+    for i in range(0, len(data), 255):
+        r += bytes([len(data[i:i + 255])]) + data[i:i + 255]
+    return r + b"\0"
+
+
+def header(w, h, ncolors=4):
+    bits = max(1, (ncolors - 1).bit_length()) - 1
+    pal = b"".join(bytes([(i * 85) & 0xff, (i * 40) & 0xff, (255 - i * 60) & 0xff])
+                   for i in range(2 << bits))
+    return b"GIF89a" + struct.pack("<HHBBB", w, h, 0x80 | 0x70 | bits, 0, 0) + pal
+
+
+def image(x, y, w, h, data, flags=0):
+    return b"," + struct.pack("<HHHHB", x, y, w, h, flags) + data
+
+
+def netscape(loops=0):
+    return b"!\xff\x0bNETSCAPE2.0\x03\x01" + struct.pack("<H", loops) + b"\0"
+
+
+def gce(delay=10, transparent=None):
+    flags = 0x01 if transparent is not None else 0
+    return b"!\xf9\x04" + struct.pack("<BHB", flags, delay, transparent or 0) + b"\0"
+
+
+def frame(x, y, w, h, min_size=2, pattern=lambda i: i % 4, **kw):
+    idx = [pattern(i) for i in range(w * h)]
+    return image(x, y, w, h, bytes([min_size]) + blocks(lzw(idx, min_size, **kw)))
+
+
+def bad():
+    files = {}
+    ok = header(20, 20) + frame(0, 0, 20, 20) + b";"
+
+    files["empty"] = b""
+    files["signature_only"] = b"GIF89a"
+    files["header_only"] = header(20, 20)
+    files["not_a_gif"] = b"\x89PNG\r\n\x1a\n" + b"\0" * 64
+    for n in (20, 40, len(ok) // 2, len(ok) - 3):
+        files["truncated_%d" % n] = ok[:n]
+    files["no_trailer"] = ok[:-1]
+    files["garbage_after"] = ok + bytes(range(256)) * 4
+    files["huge_canvas"] = header(65535, 65535) + frame(0, 0, 8, 8) + b";"
+    files["big_frame"] = header(20, 20) + frame(0, 0, 200, 200) + b";"
+    files["frame_outside"] = header(20, 20) + frame(60000, 60000, 10, 10) + b";"
+    files["frame_overlaps"] = header(20, 20) + frame(15, 15, 10, 10) + b";"
+    files["zero_size_frame"] = header(20, 20) + image(0, 0, 0, 0, b"\x02" + blocks(b"\x44\x01")) + b";"
+    files["zero_canvas"] = header(0, 0) + frame(0, 0, 10, 10) + b";"
+    files["many_frames"] = header(4, 4) + netscape() + b"".join(
+        gce(0) + frame(0, 0, 1, 1) for _ in range(3000)) + b";"
+    files["many_frames_no_loop"] = header(4, 4) + b"".join(
+        frame(i % 4, 0, 1, 1) for i in range(3000)) + b";"
+    files["code_size_1"] = header(20, 20) + image(0, 0, 20, 20, b"\x01" + blocks(
+        lzw([i % 2 for i in range(400)], 1))) + b";"
+    files["code_size_0"] = header(20, 20) + image(0, 0, 20, 20, b"\x00" + blocks(b"\xff" * 40)) + b";"
+    files["code_size_8"] = header(20, 20, 256) + frame(0, 0, 20, 20, 8, lambda i: i % 256) + b";"
+    files["code_size_11"] = header(20, 20) + image(0, 0, 20, 20, b"\x0b" + blocks(b"\x00" * 100)) + b";"
+    files["code_size_12"] = header(20, 20) + image(0, 0, 20, 20, b"\x0c" + blocks(b"\xff" * 100)) + b";"
+    files["code_size_13"] = header(20, 20) + image(0, 0, 20, 20, b"\x0d" + blocks(b"\x55" * 100)) + b";"
+    files["bad_code"] = header(20, 20) + image(0, 0, 20, 20, b"\x02" + blocks(
+        bytes([0x04 | (7 << 3), 0xff, 0xff, 0xff]))) + b";"
+    files["first_code_not_literal"] = header(20, 20) + image(0, 0, 20, 20, b"\x02" + blocks(
+        bytes([0x34, 0x00]))) + b";"
+    files["no_clear_code"] = header(20, 20) + frame(0, 0, 20, 20, clear_first=False) + b";"
+    files["no_eoi"] = header(20, 20) + frame(0, 0, 20, 20, eoi=False) + b";"
+    files["short_data"] = header(20, 20) + image(0, 0, 20, 20, b"\x02" + blocks(
+        lzw([i % 4 for i in range(40)], 2))) + b";"
+    # More sub-blocks after the end of the image data
+    files["long_data"] = header(8, 8) + frame(0, 0, 8, 8, pattern=lambda i: i % 3)[:-1] + blocks(
+        b"\xaa" * 1000) + b";"
+    # Noise fills the 4096 entry table, then keeps going without a clear code
+    noise = [(i * 7919 + (i >> 3) * 104729) % 4 for i in range(70 * 70)]
+    files["table_full"] = header(70, 70) + image(0, 0, 70, 70, b"\x02" + blocks(
+        lzw(noise, 2, clear_when_full=False))) + b";"
+    files["interlaced"] = header(20, 20) + image(
+        0, 0, 20, 20, b"\x02" + blocks(lzw([i % 4 for i in range(400)], 2)), 0x40) + b";"
+    files["interlaced_1row"] = header(20, 1) + image(
+        0, 0, 20, 1, b"\x02" + blocks(lzw([i % 4 for i in range(20)], 2)), 0x40) + b";"
+    files["local_palette"] = header(20, 20) + image(
+        0, 0, 20, 20, b"\x07" + blocks(lzw([i % 128 for i in range(400)], 7)), 0x86) + b";"
+    files["local_palette_cut"] = header(20, 20) + b"," + struct.pack("<HHHHB", 0, 0, 20, 20, 0x87) + b"\x10" * 30
+    files["no_palette"] = b"GIF89a" + struct.pack("<HHBBB", 20, 20, 0, 0, 0) + frame(0, 0, 20, 20) + b";"
+    files["extension_unterminated"] = header(20, 20) + b"!\xfe" + b"\x10" + b"x" * 16 + b"\x40" + b"y" * 10
+    files["extension_chain"] = header(20, 20) + b"".join(
+        b"!\xfe\x01x\0" for _ in range(2000)) + frame(0, 0, 20, 20) + b";"
+    files["unknown_block"] = header(20, 20) + b"\x77" + frame(0, 0, 20, 20) + b";"
+    files["netscape_short"] = header(20, 20) + b"!\xff\x0bNETSCAPE2.0\x01\x01\0" + frame(0, 0, 20, 20) + b";"
+    files["gce_short"] = header(20, 20) + b"!\xf9\x01\x00\0" + frame(0, 0, 20, 20) + b";"
+    files["transparent_out_of_range"] = header(20, 20) + gce(10, 200) + frame(0, 0, 20, 20) + b";"
+    files["index_out_of_palette"] = header(20, 20, 2) + image(0, 0, 20, 20, b"\x03" + blocks(
+        lzw([i % 8 for i in range(400)], 3))) + b";"
+    files["restore_previous"] = header(20, 20) + netscape() + b"".join(
+        b"!\xf9\x04\x0c\x0a\x00\x00\0" + frame(i, i, 10, 10) for i in range(8)) + b";"
+
+    os.makedirs(os.path.join(here, "bad"), exist_ok=True)
+    for name, data in files.items():
+        with open(os.path.join(here, "bad", name + ".gif"), "wb") as f:
+            f.write(data)
+
+
+if __name__ == "__main__":
+    icons()
+    bad()
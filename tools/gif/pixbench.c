@@ -0,0 +1,227 @@
+/*
+ * Compare the pixel kernels of Keypad/Pixels.c : a pixel at a time, a word at a time
+ * (what the ESPs run) and SSE2, on the rows of weather icons
+ *
+ *	make pixels
+ *	./pixbench [-t seconds] icon.gif ..
+ *
+ * The icons are decoded first, their colours give the palette, the indices and the
+ * RGBA input for the kernels. Each kernel is called once per row, as GifStream and
+ * LoadGif do, with the destination pixel aligned and not. All variants must produce
+ * the same pixels as the scalar one. Output is laid out like Google Benchmark's.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+/* Pixels.c built three times, see Makefile */
+#define	KERNELS(v) \
+  void v##_rgba_to_565(uint16_t *, const uint32_t *, unsigned int); \
+  void v##_565_swap(uint16_t *, const uint16_t *, unsigned int); \
+  void v##_palette_to_565(uint16_t *, const uint8_t *, unsigned int, const uint16_t *); \
+  void v##_palette4_to_565(uint16_t *, const uint8_t *, unsigned int, const uint16_t *);
+
+KERNELS(scalar)
+KERNELS(swar)
+KERNELS(sse2)
+
+struct Icon {
+  const char	*name;
+  unsigned	w, h;
+  uint32_t	*rgba;		/* one row after the other */
+  uint16_t	*rgb565;
+  uint8_t	*index;		/* palette indices */
+  uint8_t	*index4;	/* the same, two per byte, each row starts on a byte */
+  uint16_t	palette[256];
+};
+
+static struct Icon *icons;
+static int nicons;
+
+/* A kernel on one row : dst, row number, icon */
+typedef void (*row_fn)(void *kernel, uint16_t *dst, struct Icon *ic, unsigned y);
+
+static void row_rgba(void *k, uint16_t *dst, struct Icon *ic, unsigned y) {
+  ((void (*)(uint16_t *, const uint32_t *, unsigned))k)(dst, ic->rgba + y * ic->w, ic->w);
+}
+
+static void row_swap(void *k, uint16_t *dst, struct Icon *ic, unsigned y) {
+  ((void (*)(uint16_t *, const uint16_t *, unsigned))k)(dst, ic->rgb565 + y * ic->w, ic->w);
+}
+
+static void row_palette(void *k, uint16_t *dst, struct Icon *ic, unsigned y) {
+  ((void (*)(uint16_t *, const uint8_t *, unsigned, const uint16_t *))k)
+    (dst, ic->index + y * ic->w, ic->w, ic->palette);
+}
+
+static void row_palette4(void *k, uint16_t *dst, struct Icon *ic, unsigned y) {
+  ((void (*)(uint16_t *, const uint8_t *, unsigned, const uint16_t *))k)
+    (dst, ic->index4 + y * ((ic->w + 1) / 2), ic->w, ic->palette);
+}
+
+static struct {
+  const char	*name;
+  row_fn	row;
+  void		*variant[3];
+} kernels[] = {
+  { "rgba_to_565", row_rgba,
+    { (void *)scalar_rgba_to_565, (void *)swar_rgba_to_565, (void *)sse2_rgba_to_565 } },
+  { "565_swap", row_swap,
+    { (void *)scalar_565_swap, (void *)swar_565_swap, (void *)sse2_565_swap } },
+  { "palette_to_565", row_palette,
+    { (void *)scalar_palette_to_565, (void *)swar_palette_to_565, (void *)sse2_palette_to_565 } },
+  { "palette4_to_565", row_palette4,
+    { (void *)scalar_palette4_to_565, (void *)swar_palette4_to_565, (void *)sse2_palette4_to_565 } },
+};
+
+static const char *variants[] = { "scalar", "swar", "sse2" };
+
+#define	NUMBER(a)	(sizeof(a) / sizeof(a[0]))
+
+/*
+ * Turn a decoded icon into kernel input. Colours past the 256th (there shouldn't
+ * be any in a GIF) share the last palette entry.
+ */
+static void load(const char *fn) {
+  struct GifHostResult r;
+  struct Icon *ic;
+  uint8_t *data;
+  size_t len;
+  int ncolours = 0;
+
+  if ((data = host_read(fn, &len)) == NULL)
+    exit(1);
+  host_decode(data, len, &r);
+  free(data);
+  if (r.image == NULL) {
+    fprintf(stderr, "%s: cannot decode\n", fn);
+    exit(1);
+  }
+
+  icons = realloc(icons, (nicons + 1) * sizeof(struct Icon));
+  ic = &icons[nicons++];
+  memset(ic, 0, sizeof(*ic));
+  ic->name = strrchr(fn, '/') ? strrchr(fn, '/') + 1 : fn;
+  ic->w = r.width;
+  ic->h = r.height;
+  ic->rgb565 = r.image;
+  ic->rgba = malloc(ic->w * ic->h * 4);
+  ic->index = malloc(ic->w * ic->h);
+  ic->index4 = calloc(ic->h, (ic->w + 1) / 2);
+
+  for (unsigned i = 0; i < ic->w * ic->h; i++) {
+    uint16_t p = ic->rgb565[i];
+    int c;
+
+    /* Back to r, g, b, a bytes, so that rgba_to_565 gives p again */
+    ic->rgba[i] = ((p >> 8) & 0xF8) | ((uint32_t)((p >> 3) & 0xFC) << 8)
+      | ((uint32_t)((p << 3) & 0xF8) << 16) | 0xFF000000;
+
+    for (c = 0; c < ncolours && ic->palette[c] != p; c++)
+      ;
+    if (c == ncolours && ncolours < 256)
+      ic->palette[ncolours++] = p;
+    ic->index[i] = c < 256 ? c : 255;
+
+    unsigned x = i % ic->w, y = i / ic->w;
+    ic->index4[y * ((ic->w + 1) / 2) + x / 2] |= (ic->index[i] & 0x0F) << (x & 1 ? 0 : 4);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  double limit = 0.2;
+  unsigned maxpix = 0, pixels = 0;
+  int errors = 0;
+
+  if (argc > 2 && strcmp(argv[1], "-t") == 0) {
+    limit = atof(argv[2]);
+    argc -= 2, argv += 2;
+  }
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s [-t seconds] icon.gif ..\n", argv[0]);
+    exit(1);
+  }
+  for (int i = 1; i < argc; i++) {
+    load(argv[i]);
+    pixels += icons[nicons - 1].w * icons[nicons - 1].h;
+    if (icons[nicons - 1].w * icons[nicons - 1].h > maxpix)
+      maxpix = icons[nicons - 1].w * icons[nicons - 1].h;
+  }
+
+  /* Room for the biggest icon, with one extra pixel for the unaligned runs */
+  uint16_t *dst = malloc((maxpix + 1) * 2), *ref = malloc((maxpix + 1) * 2);
+
+  /* Same pixels as the scalar version, aligned and not ? */
+  for (unsigned k = 0; k < NUMBER(kernels); k++)
+    for (int i = 0; i < nicons; i++)
+      for (int offset = 0; offset < 2; offset++)
+        for (unsigned v = 1; v < NUMBER(variants); v++)
+          for (unsigned y = 0; y < icons[i].h; y++) {
+            unsigned w = icons[i].w;
+
+            kernels[k].row(kernels[k].variant[0], ref + offset, &icons[i], y);
+            kernels[k].row(kernels[k].variant[v], dst + offset, &icons[i], y);
+            if (memcmp(ref + offset, dst + offset, w * 2) != 0) {
+              fprintf(stderr, "%s/%s differs on %s row %u, offset %d\n", kernels[k].name,
+                variants[v], icons[i].name, y, offset);
+              errors++;
+            }
+          }
+  if (errors)
+    exit(1);
+
+  /* Timed runs, the pixels of all icons are one iteration */
+  printf("%d icons, %u pixels, called per row\n", nicons, pixels);
+  printf("%-40s %12s %12s %14s\n", "Benchmark", "Time", "Iterations", "Pixels/s");
+  printf("------------------------------------------------------------------------------------\n");
+  for (unsigned k = 0; k < NUMBER(kernels); k++)
+    for (int offset = 0; offset < 2; offset++)
+      for (unsigned v = 0; v < NUMBER(variants); v++) {
+        unsigned long n = 0;
+        double start = host_now(), t;
+        char name[64];
+
+        do {
+          for (int i = 0; i < nicons; i++)
+            for (unsigned y = 0; y < icons[i].h; y++)
+              kernels[k].row(kernels[k].variant[v], dst + offset + y * icons[i].w, &icons[i], y);
+          n++;
+        } while ((t = host_now() - start) < limit);
+
+        snprintf(name, sizeof(name), "BM_%s/%s/%s", kernels[k].name, variants[v],
+          offset ? "unaligned" : "aligned");
+        printf("%-40s %9.0f ns %12lu %13.1fM\n", name, t * 1e9 / n, n, n * (double)pixels / t / 1e6);
+      }
+
+  for (int i = 0; i < nicons; i++) {
+    free(icons[i].rgba);
+    free(icons[i].rgb565);
+    free(icons[i].index);
+    free(icons[i].index4);
+  }
+  free(icons);
+  free(dst);
+  free(ref);
+  return 0;
+}
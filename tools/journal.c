@@ -0,0 +1,101 @@
+/*
+ * Decode the alarm event log (see Keypad/Journal.cpp) on a PC
+ *
+ *	cc -o journal journal.c
+ *	echo '{"journal" : true}' | nc keypad 23456 > journal.bin
+ *	./journal journal.bin
+ *
+ * Also works on a copy of the SPIFFS file itself : records are sorted, empty ones skipped.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Same as in Keypad/Journal.h, little endian */
+struct JournalRecord {
+  uint32_t	seq;
+  uint32_t	ts;
+  uint8_t	type;
+  uint8_t	zone;
+  uint8_t	arg;
+  char		source[21];
+};
+
+static const char *types[] = { "none", "alarm", "arm", "reset" };
+static const char *zones[] = { "none", "secure", "perimeter", "always", "peer", "hid" };
+static const char *states[] = { "off", "on", "night" };
+
+#define	NAME(a, i)	((i) < sizeof(a) / sizeof(a[0]) ? a[i] : "?")
+
+static int bySeq(const void *a, const void *b) {
+  uint32_t x = ((const struct JournalRecord *)a)->seq, y = ((const struct JournalRecord *)b)->seq;
+  return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[]) {
+  FILE *f;
+  struct JournalRecord *r = 0;
+  int n = 0, max = 0;
+
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s file\n", argv[0]);
+    exit(1);
+  }
+  if ((f = fopen(argv[1], "rb")) == NULL) {
+    perror(argv[1]);
+    exit(1);
+  }
+
+  for (;;) {
+    if (n == max) {
+      max = max ? 2 * max : 512;
+      r = realloc(r, max * sizeof(struct JournalRecord));
+    }
+    if (fread(&r[n], sizeof(struct JournalRecord), 1, f) != 1)
+      break;
+    if (r[n].seq != 0)
+      n++;
+  }
+  fclose(f);
+
+  qsort(r, n, sizeof(struct JournalRecord), bySeq);
+
+  for (int i = 0; i < n; i++) {
+    char t[32] = "-";
+    time_t ts = r[i].ts;
+
+    if (ts)
+      strftime(t, sizeof(t), "%Y-%m-%d %H:%M:%S", localtime(&ts));
+    r[i].source[sizeof(r[i].source) - 1] = 0;
+
+    printf("%6u %s %-5s %-9s", r[i].seq, t, NAME(types, r[i].type), NAME(zones, r[i].zone));
+    if (r[i].type == 2)
+      printf(" %-5s", NAME(states, r[i].arg));
+    else
+      printf("      ");
+    printf(" %s\n", r[i].source);
+  }
+  free(r);
+  return 0;
+}
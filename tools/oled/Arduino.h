@@ -0,0 +1,96 @@
+/*
+ * Just enough of the Arduino core to build the display code on a PC
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef	_ARDUINO_H_
+#define	_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define	PROGMEM
+#define	ICACHE_RAM_ATTR
+#define	IRAM_ATTR
+#define	pgm_read_byte(a)	(*(const uint8_t *)(a))
+#define	pgm_read_word(a)	(*(const uint16_t *)(a))
+#define	pgm_read_dword(a)	(*(const uint32_t *)(a))
+#define	pgm_read_ptr(a)		(*(void * const *)(a))
+
+#define	constrain(amt, low, high)	((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+class String {
+  public:
+    String(const char *s = "") : s(s) {}
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.length(); }
+
+  private:
+    std::string s;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t n) {
+      size_t r = 0;
+      while (n--)
+        r += write(*buf++);
+      return r;
+    }
+    int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t println(const char *s = "") { return print(s) + print("\n"); }
+};
+
+/* Goes to stdout, quiet if Serial.quiet is set */
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *buf, size_t n);
+    boolean quiet = false;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+  public:
+    uint32_t getFreeHeap() { return 40000; }
+};
+
+extern EspClass ESP;
+
+/* Time stands still unless the test moves it, see host_millis */
+extern unsigned long host_millis;
+static inline unsigned long millis() { return host_millis; }
+static inline unsigned long micros() { return host_millis * 1000; }
+static inline void delay(unsigned long ms) { host_millis += ms; }
+static inline void yield() {}
+
+#endif	/* _ARDUINO_H_ */
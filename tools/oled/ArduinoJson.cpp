@@ -0,0 +1,173 @@
+/*
+ * See ArduinoJson.h. Arrays are parsed and dropped, strings keep their escapes.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <ArduinoJson.h>
+
+static JsonObject invalid(false);
+
+JsonVariant::operator JsonObject &() const {
+  return (type == OBJECT) ? *object : invalid;
+}
+
+JsonVariant &JsonVariant::operator =(const char *s) {
+  type = s ? STRING : NONE;
+  string = s ? s : "";
+  return *this;
+}
+
+JsonVariant &JsonVariant::operator =(double d) {
+  type = NUMBER;
+  number = d;
+  return *this;
+}
+
+void JsonObject::Print(std::string &out) const {
+  char num[32];
+
+  out += '{';
+  for (auto m = members.begin(); m != members.end(); m++) {
+    if (m != members.begin())
+      out += ',';
+    out += '"' + m->first + "\":";
+    switch (m->second.type) {
+    case JsonVariant::NONE:
+      out += "null";
+      break;
+    case JsonVariant::NUMBER:
+      snprintf(num, sizeof(num), "%.6g", m->second.number);
+      out += num;
+      break;
+    case JsonVariant::STRING:
+      out += '"' + m->second.string + '"';
+      break;
+    case JsonVariant::OBJECT:
+      m->second.object->Print(out);
+      break;
+    }
+  }
+  out += '}';
+}
+
+size_t JsonObject::printTo(char *buffer, size_t size) const {
+  std::string out;
+
+  Print(out);
+  if (size == 0)
+    return 0;
+  strncpy(buffer, out.c_str(), size - 1);
+  buffer[size - 1] = 0;
+  return strlen(buffer);
+}
+
+JsonObject &DynamicJsonBuffer::createObject() {
+  objects.push_back(JsonObject());
+  return objects.back();
+}
+
+static void Space(const char *&p) {
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+    p++;
+}
+
+static bool Quoted(const char *&p, std::string *s) {
+  if (*p++ != '"')
+    return false;
+  for (; *p && *p != '"'; p++) {
+    if (*p == '\\' && p[1])
+      *s += *p++;
+    *s += *p;
+  }
+  return *p++ == '"';
+}
+
+bool DynamicJsonBuffer::Value(const char *&p, JsonVariant *v) {
+  Space(p);
+  if (*p == '"') {
+    v->type = JsonVariant::STRING;
+    return Quoted(p, &v->string);
+  }
+  if (*p == '{') {
+    v->type = JsonVariant::OBJECT;
+    v->object = &createObject();
+    return Object(p, v->object);
+  }
+  if (*p == '[') {
+    JsonVariant dropped;
+    p++;
+    Space(p);
+    if (*p == ']')
+      return *p++;
+    do {
+      if (! Value(p, &dropped))
+        return false;
+      Space(p);
+    } while (*p == ',' && p++);
+    return *p++ == ']';
+  }
+  if (strncmp(p, "true", 4) == 0 || strncmp(p, "null", 4) == 0) {
+    v->type = (*p == 't') ? JsonVariant::NUMBER : JsonVariant::NONE;
+    v->number = (*p == 't');
+    p += 4;
+    return true;
+  }
+  if (strncmp(p, "false", 5) == 0) {
+    v->type = JsonVariant::NUMBER;
+    p += 5;
+    return true;
+  }
+
+  char *end;
+  v->number = strtod(p, &end);
+  v->type = JsonVariant::NUMBER;
+  if (end == p)
+    return false;
+  p = end;
+  return true;
+}
+
+bool DynamicJsonBuffer::Object(const char *&p, JsonObject *o) {
+  Space(p);
+  if (*p++ != '{')
+    return false;
+  Space(p);
+  if (*p == '}')
+    return *p++;
+  do {
+    std::string key;
+    Space(p);
+    if (! Quoted(p, &key))
+      return false;
+    Space(p);
+    if (*p++ != ':' || ! Value(p, &o->members[key]))
+      return false;
+    Space(p);
+  } while (*p == ',' && p++);
+  return *p++ == '}';
+}
+
+JsonObject &DynamicJsonBuffer::parseObject(const char *json) {
+  JsonObject &o = createObject();
+
+  if (json == 0 || ! Object(json, &o))
+    o.valid = false;
+  return o;
+}
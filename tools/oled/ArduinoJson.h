@@ -0,0 +1,81 @@
+/*
+ * The parts of ArduinoJson (version 5) that Weather.cpp uses : objects, numbers and strings
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef	_ARDUINOJSON_H_
+#define	_ARDUINOJSON_H_
+
+#include <Arduino.h>
+#include <list>
+#include <map>
+
+class JsonObject;
+
+class JsonVariant {
+  public:
+    JsonVariant() : type(NONE), number(0), object(0) {}
+
+    operator float() const { return number; }
+    operator int() const { return number; }
+    operator const char *() const { return type == STRING ? string.c_str() : 0; }
+    operator JsonObject &() const;
+
+    JsonVariant &operator =(const char *s);
+    JsonVariant &operator =(double d);
+    JsonVariant &operator =(int i) { return *this = (double)i; }
+
+  private:
+    friend class JsonObject;
+    friend class DynamicJsonBuffer;
+    enum { NONE, NUMBER, STRING, OBJECT } type;
+    double	number;
+    std::string	string;
+    JsonObject	*object;	// Owned by the buffer
+};
+
+class JsonObject {
+  public:
+    JsonObject(bool valid = true) : valid(valid) {}
+    bool success() const { return valid; }
+    JsonVariant &operator [](const char *key) { return members[key]; }
+    size_t printTo(char *buffer, size_t size) const;
+
+  private:
+    friend class JsonVariant;
+    friend class DynamicJsonBuffer;
+    bool	valid;
+    std::map<std::string, JsonVariant>	members;
+
+    void Print(std::string &out) const;
+};
+
+class DynamicJsonBuffer {
+  public:
+    JsonObject &createObject();
+    JsonObject &parseObject(const char *json);
+
+  private:
+    std::list<JsonObject>	objects;
+
+    bool Value(const char *&p, JsonVariant *v);
+    bool Object(const char *&p, JsonObject *o);
+};
+
+#endif	/* _ARDUINOJSON_H_ */
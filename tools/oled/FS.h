@@ -0,0 +1,10 @@
+/*
+ * See Journal.h, which isn't used on the host
+ */
+#ifndef	_FS_H_
+#define	_FS_H_
+
+class File {
+};
+
+#endif	/* _FS_H_ */
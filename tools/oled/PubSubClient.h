@@ -0,0 +1,3 @@
+/*
+ * Nothing from MQTT is used by the display code
+ */
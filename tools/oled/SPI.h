@@ -0,0 +1,3 @@
+/*
+ * Nothing here, TFT_eSPI.h has the bus. Oled.h includes this.
+ */
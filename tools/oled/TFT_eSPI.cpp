@@ -0,0 +1,537 @@
+/*
+ * A headless stand-in for Bodmer's TFT_eSPI, see TFT_eSPI.h
+ *
+ * The drawing primitives work the way TFT_eSPI's do on an ILI9341 : set an address window
+ * (column, page, memory write : 11 bytes) and send the pixels in it, two bytes each.
+ * Outlines and circles are made of pixels and lines, so they cost a window each, as on
+ * the real thing. Everything is clipped to the screen. Pixels fill the window left to
+ * right, top to bottom, and wrap around to its top.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <TFT_eSPI.h>
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+  _width = w;
+  _height = h;
+  depth = 0;
+  open = false;
+  fb = (uint16_t *)calloc(w * h, sizeof(uint16_t));
+  writes = (uint8_t *)calloc(w * h, 1);
+  win_x0 = win_y0 = win_x1 = win_y1 = win_x = win_y = 0;
+  memset(&record, 0, sizeof(record));
+  touch_x = touch_y = touch_z = 0;
+
+  gfxFont = NULL;
+  cursor_x = cursor_y = 0;
+  textcolor = textbgcolor = TFT_WHITE;
+  textsize = 1;
+  textdatum = TL_DATUM;
+}
+
+TFT_eSPI::~TFT_eSPI() {
+  free(fb);
+  free(writes);
+}
+
+void TFT_eSPI::init() {
+}
+
+void TFT_eSPI::begin() {
+  init();
+}
+
+void TFT_eSPI::setRotation(uint8_t) {
+}
+
+int16_t TFT_eSPI::width() {
+  return _width;
+}
+
+int16_t TFT_eSPI::height() {
+  return _height;
+}
+
+/*
+ * The bus is taken by the first thing that needs it, and let go after each drawing call
+ * unless that's between startWrite() and endWrite().
+ */
+void TFT_eSPI::Begin() {
+  if (! open) {
+    open = true;
+    record.transactions++;
+  }
+}
+
+void TFT_eSPI::End() {
+  if (depth == 0)
+    open = false;
+}
+
+void TFT_eSPI::startWrite() {
+  Begin();
+  depth++;
+}
+
+void TFT_eSPI::endWrite() {
+  if (depth > 0)
+    depth--;
+  End();
+}
+
+void TFT_eSPI::Window(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  win_x0 = win_x = x0;
+  win_y0 = win_y = y0;
+  win_x1 = x1;
+  win_y1 = y1;
+  record.windows++;
+  record.bytes += 11;
+}
+
+void TFT_eSPI::Put(uint16_t colour) {
+  if (win_x >= 0 && win_x < _width && win_y >= 0 && win_y < _height) {
+    fb[win_y * _width + win_x] = colour;
+    if (writes[win_y * _width + win_x] < 255)
+      writes[win_y * _width + win_x]++;
+  }
+  if (++win_x > win_x1) {
+    win_x = win_x0;
+    if (++win_y > win_y1)
+      win_y = win_y0;
+  }
+}
+
+void TFT_eSPI::Fill(uint16_t colour, uint32_t n) {
+  record.pixels += n;
+  record.bytes += 2 * n;
+  while (n--)
+    Put(colour);
+}
+
+void TFT_eSPI::Data(const uint16_t *data, uint32_t n, bool swap) {
+  record.pixels += n;
+  record.bytes += 2 * n;
+  for (uint32_t i = 0; i < n; i++)
+    Put(swap ? data[i] : (data[i] >> 8) | (data[i] << 8));
+}
+
+/*
+ * A filled rectangle, clipped, without taking the bus
+ */
+void TFT_eSPI::Span(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w <= 0 || h <= 0)
+    return;
+
+  Window(x, y, x + w - 1, y + h - 1);
+  Fill(color, w * h);
+}
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+  Begin();
+  Window(x0, y0, x1, y1);
+  End();
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+void TFT_eSPI::pushColor(uint16_t color) {
+  pushColor(color, 1);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len) {
+  Begin();
+  Fill(color, len);
+  End();
+}
+
+/*
+ * With swap, data is in the CPU's byte order and gets swapped on the way out.
+ * Without, it's already in the display's.
+ */
+void TFT_eSPI::pushColors(uint16_t *data, uint32_t len, bool swap) {
+  Begin();
+  Data(data, len, swap);
+  End();
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  Begin();
+  Span(x, y, 1, 1, color);
+  End();
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  Begin();
+  Span(x, y, w, 1, color);
+  End();
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  Begin();
+  Span(x, y, 1, h, color);
+  End();
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  Begin();
+  Span(x, y, w, h, color);
+  End();
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  startWrite();
+  Span(x, y, w, 1, color);
+  Span(x, y + h - 1, w, 1, color);
+  Span(x, y + 1, 1, h - 2, color);
+  Span(x + w - 1, y + 1, 1, h - 2, color);
+  endWrite();
+}
+
+/*
+ * Circles, as in Adafruit_GFX
+ */
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+  startWrite();
+  Span(x0, y0 + r, 1, 1, color);
+  Span(x0, y0 - r, 1, 1, color);
+  Span(x0 + r, y0, 1, 1, color);
+  Span(x0 - r, y0, 1, 1, color);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    Span(x0 + x, y0 + y, 1, 1, color);
+    Span(x0 - x, y0 + y, 1, 1, color);
+    Span(x0 + x, y0 - y, 1, 1, color);
+    Span(x0 - x, y0 - y, 1, 1, color);
+    Span(x0 + y, y0 + x, 1, 1, color);
+    Span(x0 - y, y0 + x, 1, 1, color);
+    Span(x0 + y, y0 - x, 1, 1, color);
+    Span(x0 - y, y0 - x, 1, 1, color);
+  }
+  endWrite();
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+  startWrite();
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (cornername & 0x4) {
+      Span(x0 + x, y0 + y, 1, 1, color);
+      Span(x0 + y, y0 + x, 1, 1, color);
+    }
+    if (cornername & 0x2) {
+      Span(x0 + x, y0 - y, 1, 1, color);
+      Span(x0 + y, y0 - x, 1, 1, color);
+    }
+    if (cornername & 0x8) {
+      Span(x0 - y, y0 + x, 1, 1, color);
+      Span(x0 - x, y0 + y, 1, 1, color);
+    }
+    if (cornername & 0x1) {
+      Span(x0 - y, y0 - x, 1, 1, color);
+      Span(x0 - x, y0 - y, 1, 1, color);
+    }
+  }
+  endWrite();
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  startWrite();
+  Span(x0, y0 - r, 1, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+  endWrite();
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+
+  startWrite();
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    if (cornername & 0x1) {
+      Span(x0 + x, y0 - y, 1, 2 * y + 1 + delta, color);
+      Span(x0 + y, y0 - x, 1, 2 * x + 1 + delta, color);
+    }
+    if (cornername & 0x2) {
+      Span(x0 - x, y0 - y, 1, 2 * y + 1 + delta, color);
+      Span(x0 - y, y0 - x, 1, 2 * x + 1 + delta, color);
+    }
+  }
+  endWrite();
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  startWrite();
+  Span(x + r, y, w - 2 * r, 1, color);
+  Span(x + r, y + h - 1, w - 2 * r, 1, color);
+  Span(x, y + r, 1, h - 2 * r, color);
+  Span(x + w - 1, y + r, 1, h - 2 * r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+  endWrite();
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  startWrite();
+  Span(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+  endWrite();
+}
+
+/*
+ * Like the display, this gives pixels in its byte order. Outside it, they're black.
+ */
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data) {
+  Begin();
+  Window(x, y, x + w - 1, y + h - 1);
+  record.bytes += 2 * w * h;
+  End();
+
+  for (int32_t r = y; r < y + h; r++)
+    for (int32_t c = x; c < x + w; c++) {
+      uint16_t p = (r >= 0 && r < _height && c >= 0 && c < _width) ? fb[r * _width + c] : 0;
+      *data++ = (p >> 8) | (p << 8);
+    }
+}
+
+/*
+ * Text. Only GFX fonts : without a free font, Glcd stands in for the built in one.
+ */
+void TFT_eSPI::setFreeFont(const GFXfont *f) {
+  gfxFont = f;
+}
+
+const GFXfont *TFT_eSPI::Font() {
+  return gfxFont ? gfxFont : &Glcd;
+}
+
+void TFT_eSPI::setTextColor(uint16_t c) {
+  textcolor = textbgcolor = c;
+}
+
+void TFT_eSPI::setTextColor(uint16_t c, uint16_t b) {
+  textcolor = c;
+  textbgcolor = b;
+}
+
+void TFT_eSPI::setTextSize(uint8_t s) {
+  textsize = s ? s : 1;
+}
+
+void TFT_eSPI::setTextDatum(uint8_t d) {
+  textdatum = d;
+}
+
+uint8_t TFT_eSPI::getTextDatum() {
+  return textdatum;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string) {
+  const GFXfont *f = Font();
+  int16_t w = 0;
+
+  for (; *string; string++) {
+    uint8_t c = *string;
+    if (c >= f->first && c <= f->last)
+      w += f->glyph[c - f->first].xAdvance * textsize;
+  }
+  return w;
+}
+
+int16_t TFT_eSPI::fontHeight() {
+  return Font()->yAdvance * textsize;
+}
+
+/*
+ * One glyph, its baseline at y. The ink goes out a run of pixels at a time, the
+ * background is left alone.
+ */
+int16_t TFT_eSPI::DrawChar(const GFXfont *f, uint8_t c, int32_t x, int32_t y) {
+  if (c < f->first || c > f->last)
+    return 0;
+
+  const GFXglyph *g = &f->glyph[c - f->first];
+  const uint8_t *bitmap = f->bitmap + g->bitmapOffset;
+  uint32_t bit = 0;
+
+  for (int32_t r = 0; r < g->height; r++) {
+    int32_t run = 0;
+    for (int32_t col = 0; col <= g->width; col++, bit++) {
+      if (col < g->width && (bitmap[bit >> 3] & (0x80 >> (bit & 7)))) {
+        run++;
+        continue;
+      }
+      if (run)
+        Span(x + (g->xOffset + col - run) * textsize, y + (g->yOffset + r) * textsize,
+          run * textsize, textsize, textcolor);
+      run = 0;
+    }
+    bit--;			// The column past the end isn't in the bitmap
+  }
+  return g->xAdvance * textsize;
+}
+
+/*
+ * The datum says which point of the text x,y is. For the top, the baseline is the
+ * largest ascent in the font below it.
+ */
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y) {
+  const GFXfont *f = Font();
+  int16_t w = textWidth(string), h = fontHeight();
+  int16_t ascent = 0;
+
+  for (int i = 0; i <= f->last - f->first; i++)
+    if (-f->glyph[i].yOffset > ascent)
+      ascent = -f->glyph[i].yOffset;
+  ascent *= textsize;
+
+  switch (textdatum) {
+  case TC_DATUM: case MC_DATUM: case BC_DATUM:
+    x -= w / 2;
+    break;
+  case TR_DATUM: case MR_DATUM: case BR_DATUM:
+    x -= w;
+    break;
+  }
+  switch (textdatum) {
+  case ML_DATUM: case MC_DATUM: case MR_DATUM:
+    y -= h / 2;
+    break;
+  case BL_DATUM: case BC_DATUM: case BR_DATUM:
+    y -= h;
+    break;
+  }
+
+  startWrite();
+  for (; *string; string++)
+    x += DrawChar(f, *string, x, y + ascent);
+  endWrite();
+  return w;
+}
+
+/*
+ * Print goes to the cursor, y is the baseline
+ */
+size_t TFT_eSPI::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += fontHeight();
+    return 1;
+  }
+  startWrite();
+  cursor_x += DrawChar(Font(), c, cursor_x, cursor_y);
+  endWrite();
+  return 1;
+}
+
+uint8_t TFT_eSPI::getTouchRaw(uint16_t *x, uint16_t *y) {
+  *x = touch_x;
+  *y = touch_y;
+  return 1;
+}
+
+uint16_t TFT_eSPI::getTouchRawZ(void) {
+  return touch_z;
+}
+
+uint8_t TFT_eSPI::getTouch(uint16_t *x, uint16_t *y, uint16_t threshold) {
+  if (touch_z < threshold)
+    return 0;
+  *x = touch_x;
+  *y = touch_y;
+  return 1;
+}
+
+/*
+ * Buttons, as in TFT_eSPI : x and y are the centre
+ */
+void TFT_eSPI_Button::initButton(TFT_eSPI *gfx, int16_t x, int16_t y, uint16_t w, uint16_t h,
+  uint16_t outline, uint16_t fill, uint16_t textcolor, char *label, uint8_t textsize) {
+  _x1 = x - w / 2;
+  _y1 = y - h / 2;
+  _w = w;
+  _h = h;
+  _outlinecolor = outline;
+  _fillcolor = fill;
+  _textcolor = textcolor;
+  _textsize = textsize;
+  _gfx = gfx;
+  strncpy(_label, label, sizeof(_label) - 1);
+  _label[sizeof(_label) - 1] = 0;
+}
+
+void TFT_eSPI_Button::drawButton(bool inverted) {
+  uint16_t fill = inverted ? _textcolor : _fillcolor,
+    text = inverted ? _fillcolor : _textcolor;
+  uint8_t r = ((_w < _h) ? _w : _h) / 4;
+
+  _gfx->fillRoundRect(_x1, _y1, _w, _h, r, fill);
+  _gfx->drawRoundRect(_x1, _y1, _w, _h, r, _outlinecolor);
+
+  _gfx->setTextColor(text);
+  _gfx->setTextSize(_textsize);
+  uint8_t datum = _gfx->getTextDatum();
+  _gfx->setTextDatum(MC_DATUM);
+  _gfx->drawString(_label, _x1 + _w / 2, _y1 + _h / 2);
+  _gfx->setTextDatum(datum);
+}
+
+bool TFT_eSPI_Button::contains(int16_t x, int16_t y) {
+  return x >= _x1 && x < _x1 + _w && y >= _y1 && y < _y1 + _h;
+}
@@ -0,0 +1,186 @@
+/*
+ * A headless stand-in for Bodmer's TFT_eSPI, to run Keypad/Oled.cpp on a PC
+ *
+ * Same names and arguments as the parts of TFT_eSPI the keypad uses. The display is
+ * fb, RGB565 in the CPU's byte order, and writes counts how often each pixel was sent
+ * (up to 255). The bus traffic is counted in record : an SPI transaction is what
+ * TFT_eSPI does between taking and releasing the bus, so one per drawing call, or one
+ * for everything between startWrite() and endWrite().
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef	_TFT_eSPI_H_
+#define	_TFT_eSPI_H_
+
+#include <Arduino.h>
+
+#define	TFT_WIDTH	240
+#define	TFT_HEIGHT	320
+
+#define	TFT_BLACK	0x0000
+#define	TFT_NAVY	0x000F
+#define	TFT_DARKGREEN	0x03E0
+#define	TFT_DARKCYAN	0x03EF
+#define	TFT_MAROON	0x7800
+#define	TFT_PURPLE	0x780F
+#define	TFT_OLIVE	0x7BE0
+#define	TFT_LIGHTGREY	0xC618
+#define	TFT_DARKGREY	0x7BEF
+#define	TFT_BLUE	0x001F
+#define	TFT_GREEN	0x07E0
+#define	TFT_CYAN	0x07FF
+#define	TFT_RED		0xF800
+#define	TFT_MAGENTA	0xF81F
+#define	TFT_YELLOW	0xFFE0
+#define	TFT_WHITE	0xFFFF
+#define	TFT_ORANGE	0xFDA0
+#define	TFT_GREENYELLOW	0xB7E0
+
+#define	TL_DATUM	0
+#define	TC_DATUM	1
+#define	TR_DATUM	2
+#define	ML_DATUM	3
+#define	MC_DATUM	4
+#define	MR_DATUM	5
+#define	BL_DATUM	6
+#define	BC_DATUM	7
+#define	BR_DATUM	8
+
+typedef struct {
+  uint16_t	bitmapOffset;
+  uint8_t	width, height;
+  uint8_t	xAdvance;
+  int8_t	xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t	*bitmap;
+  GFXglyph	*glyph;
+  uint16_t	first, last;
+  uint8_t	yAdvance;
+} GFXfont;
+
+/* See fonts.cpp. Glcd is the one used without a free font. */
+extern const GFXfont Glcd, FreeSans9pt7b, FreeSans12pt7b, FreeSans18pt7b, FreeSans24pt7b;
+
+/* What went over the bus */
+struct TFT_Record {
+  uint32_t	transactions;
+  uint32_t	windows;	// Address window commands
+  uint32_t	pixels;
+  uint32_t	bytes;		// Commands and pixels
+};
+
+class TFT_eSPI : public Print {
+  public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    ~TFT_eSPI();
+    void init();
+    void begin();
+    void setRotation(uint8_t r);
+    int16_t width();
+    int16_t height();
+
+    void startWrite();
+    void endWrite();
+    void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void pushColor(uint16_t color);
+    void pushColor(uint16_t color, uint32_t len);
+    void pushColors(uint16_t *data, uint32_t len, bool swap = true);
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillScreen(uint32_t color);
+    void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+    void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color);
+    void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+
+    void setFreeFont(const GFXfont *f = NULL);
+    void setTextColor(uint16_t c);
+    void setTextColor(uint16_t c, uint16_t b);
+    void setTextSize(uint8_t s);
+    void setTextDatum(uint8_t d);
+    uint8_t getTextDatum();
+    int16_t textWidth(const char *string);
+    int16_t fontHeight();
+    int16_t drawString(const char *string, int32_t x, int32_t y);
+    size_t write(uint8_t c);
+
+    uint8_t getTouchRaw(uint16_t *x, uint16_t *y);
+    uint16_t getTouchRawZ(void);
+    uint8_t getTouch(uint16_t *x, uint16_t *y, uint16_t threshold = 600);
+
+    // Host only : the display, what went over the bus, and the touch panel
+    uint16_t	*fb;
+    uint8_t	*writes;
+    TFT_Record	record;
+    uint16_t	touch_x, touch_y, touch_z;
+
+  protected:
+    const GFXfont	*gfxFont;
+    int32_t	cursor_x, cursor_y;
+    uint32_t	textcolor, textbgcolor;
+    uint8_t	textsize, textdatum;
+
+  private:
+    int32_t	_width, _height;
+    int		depth;			// startWrite() nesting
+    boolean	open;			// Between beginTransaction() and endTransaction()
+    int32_t	win_x0, win_y0, win_x1, win_y1;	// Address window
+    int32_t	win_x, win_y;			// Where the next pixel goes
+
+    TFT_eSPI(const TFT_eSPI &);
+    TFT_eSPI &operator =(const TFT_eSPI &);
+
+    void	Begin();
+    void	End();
+    void	Window(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void	Put(uint16_t colour);
+    void	Fill(uint16_t colour, uint32_t n);
+    void	Data(const uint16_t *data, uint32_t n, bool swap);
+    void	Span(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    int16_t	DrawChar(const GFXfont *f, uint8_t c, int32_t x, int32_t y);
+    const GFXfont *Font();
+};
+
+class TFT_eSPI_Button {
+  public:
+    void initButton(TFT_eSPI *gfx, int16_t x, int16_t y, uint16_t w, uint16_t h,
+      uint16_t outline, uint16_t fill, uint16_t textcolor, char *label, uint8_t textsize);
+    void drawButton(bool inverted = false);
+    bool contains(int16_t x, int16_t y);
+
+  protected:
+    TFT_eSPI	*_gfx;
+    int16_t	_x1, _y1;
+    uint16_t	_w, _h;
+    uint8_t	_textsize;
+    uint16_t	_outlinecolor, _fillcolor, _textcolor;
+    char	_label[10];
+};
+
+#endif	/* _TFT_eSPI_H_ */
@@ -0,0 +1,18 @@
+/*
+ * The parts of the Time library the keypad uses, in UTC
+ */
+#ifndef	_TIMELIB_H_
+#define	_TIMELIB_H_
+
+#include <time.h>
+
+static inline int hour(time_t t) { return gmtime(&t)->tm_hour; }
+static inline int minute(time_t t) { return gmtime(&t)->tm_min; }
+static inline int second(time_t t) { return gmtime(&t)->tm_sec; }
+static inline int day(time_t t) { return gmtime(&t)->tm_mday; }
+static inline int month(time_t t) { return gmtime(&t)->tm_mon + 1; }
+static inline int year(time_t t) { return gmtime(&t)->tm_year + 1900; }
+static inline int dayOfWeek(time_t t) { return gmtime(&t)->tm_wday + 1; }	// Sunday is 1
+static inline time_t now() { return time(0); }
+
+#endif	/* _TIMELIB_H_ */
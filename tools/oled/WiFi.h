@@ -0,0 +1,24 @@
+/*
+ * Types from the WiFi library that keypad headers use. Nothing connects.
+ */
+#ifndef	_WIFI_H_
+#define	_WIFI_H_
+
+#include <Arduino.h>
+
+class IPAddress {
+  public:
+    IPAddress(uint32_t a = 0) : addr(a) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+    operator uint32_t() const { return addr; }
+
+  private:
+    uint32_t	addr;
+};
+
+class WiFiServer {
+  public:
+    WiFiServer(uint16_t) {}
+};
+
+#endif	/* _WIFI_H_ */
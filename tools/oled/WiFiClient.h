@@ -0,0 +1,22 @@
+/*
+ * A client that never connects
+ */
+#ifndef	_WIFICLIENT_H_
+#define	_WIFICLIENT_H_
+
+#include <WiFi.h>
+
+class WiFiClient : public Print {
+  public:
+    int connect(const char *, uint16_t) { return 0; }
+    int connected() { return 0; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int read(uint8_t *, size_t) { return -1; }
+    String readStringUntil(char) { return String(); }
+    void flush() {}
+    void stop() {}
+    size_t write(uint8_t) { return 1; }
+};
+
+#endif	/* _WIFICLIENT_H_ */
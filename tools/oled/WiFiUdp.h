@@ -0,0 +1,12 @@
+/*
+ * See WiFi.h
+ */
+#ifndef	_WIFIUDP_H_
+#define	_WIFIUDP_H_
+
+#include <WiFi.h>
+
+class WiFiUDP {
+};
+
+#endif	/* _WIFIUDP_H_ */
@@ -0,0 +1,1613 @@
+// Generated by mkfonts.py, don't edit
+
+#include <TFT_eSPI.h>
+
+const uint8_t GlcdBitmaps[] PROGMEM = {
+  0xF9, 0xFC, 0x56, 0x6F, 0xAF, 0xAC, 0x23, 0xAB, 0x5E, 0x18, 0xB5, 0x71, 0x00, 0xE6, 0xAA, 0xBC,
+  0x1C, 0xA4, 0x93, 0x72, 0x08, 0x9F, 0x8A, 0x28, 0x9E, 0x6A, 0xA9, 0x40, 0x95, 0x56, 0x80, 0x25,
+  0x5C, 0xA0, 0x21, 0x3E, 0x42, 0x00, 0x60, 0xC0, 0x80, 0x25, 0x25, 0x24, 0x80, 0x76, 0xE3, 0x18,
+  0xC7, 0x6E, 0x74, 0x92, 0x49, 0x32, 0x42, 0x11, 0x11, 0x1F, 0x74, 0x42, 0x60, 0xC6, 0x2E, 0x08,
+  0x62, 0x8A, 0x4B, 0xF0, 0x82, 0x7C, 0x21, 0x6C, 0x86, 0x2E, 0x72, 0x63, 0xE8, 0xC6, 0x2E, 0xF8,
+  0x44, 0x22, 0x11, 0x08, 0x74, 0x62, 0xE8, 0xC6, 0x2E, 0x74, 0x63, 0x17, 0xC6, 0x4E, 0x84, 0x40,
+  0x18, 0x3C, 0x86, 0x10, 0xF0, 0xF0, 0xC3, 0x16, 0x80, 0x72, 0x02, 0x41, 0x1C, 0x62, 0x5D, 0xA5,
+  0xA5, 0xA9, 0xB6, 0x40, 0x3C, 0x10, 0xC2, 0x92, 0x79, 0x14, 0x61, 0xF4, 0x63, 0x2F, 0xC6, 0x3E,
+  0x39, 0x18, 0x60, 0x82, 0x14, 0x5E, 0xF2, 0x28, 0x61, 0x86, 0x18, 0xBC, 0xFC, 0x21, 0x0F, 0x42,
+  0x1F, 0xFC, 0x21, 0x0F, 0x42, 0x10, 0x39, 0x38, 0x60, 0x9E, 0x14, 0xDD, 0x86, 0x18, 0x61, 0xFE,
+  0x18, 0x61, 0xFF, 0x11, 0x11, 0x19, 0x96, 0x8C, 0xA9, 0x4E, 0x52, 0x51, 0x84, 0x21, 0x08, 0x42,
+  0x1F, 0xC7, 0x8F, 0x1D, 0x5A, 0xB5, 0x6C, 0xC9, 0xCE, 0x73, 0x5A, 0xD6, 0x73, 0x39, 0x18, 0x20,
+  0x82, 0x04, 0x4E, 0xF4, 0x63, 0x1F, 0x42, 0x10, 0x39, 0x18, 0x20, 0x82, 0x04, 0x4F, 0xF4, 0x63,
+  0x1F, 0x4E, 0x31, 0x74, 0x60, 0x83, 0x86, 0x2E, 0xF9, 0x08, 0x42, 0x10, 0x84, 0x8C, 0x63, 0x18,
+  0xC6, 0x2E, 0x85, 0x14, 0x52, 0x28, 0xA3, 0x04, 0x8C, 0xA6, 0x53, 0x2A, 0x95, 0x52, 0x98, 0xCC,
+  0x46, 0x8C, 0x94, 0xC6, 0x2A, 0x51, 0x8C, 0x54, 0xA2, 0x10, 0x84, 0xF8, 0x44, 0x42, 0x22, 0x1F,
+  0xEA, 0xAA, 0xB0, 0x92, 0x24, 0x91, 0x20, 0xD5, 0x55, 0x70, 0x6A, 0xA9, 0xF8, 0x80, 0x79, 0x3D,
+  0x9F, 0x84, 0x3D, 0x18, 0xC6, 0x3E, 0x78, 0x88, 0x87, 0x08, 0x5F, 0x18, 0xC6, 0x2F, 0x74, 0x7F,
+  0x08, 0xB8, 0x29, 0x74, 0x92, 0x40, 0x7C, 0x63, 0x18, 0xBE, 0x2E, 0x84, 0x3D, 0x98, 0xC6, 0x31,
+  0xBF, 0x45, 0x55, 0x70, 0x88, 0x9A, 0xCA, 0xA9, 0xAA, 0xAB, 0xEF, 0x26, 0x4C, 0x99, 0x32, 0x40,
+  0xF6, 0x63, 0x18, 0xC4, 0x78, 0x88, 0x87, 0xF4, 0x63, 0x18, 0xFA, 0x10, 0x7C, 0x63, 0x18, 0xBC,
+  0x21, 0xF2, 0x49, 0x00, 0xF3, 0x19, 0xC0, 0x4B, 0xA4, 0x93, 0x8C, 0x63, 0x19, 0xBC, 0x8C, 0x54,
+  0xA5, 0x10, 0x99, 0x9A, 0x5A, 0x6A, 0x66, 0x24, 0x95, 0x26, 0x59, 0x8C, 0x54, 0xA5, 0x10, 0x88,
+  0xF1, 0x24, 0x8F, 0xEA, 0xAA, 0xB0, 0xFF, 0xE0, 0xD5, 0x55, 0x70, 0xDB,
+};
+
+const GFXglyph GlcdGlyphs[] PROGMEM = {
+  {     0,   0,   0,   2,    0,    0 },   // 0x20 ' '
+  {     0,   1,   8,   3,    1,   -8 },   // 0x21 '!'
+  {     1,   2,   3,   3,    1,   -8 },   // 0x22 '"'
+  {     2,   4,   8,   6,    1,   -8 },   // 0x23 '#'
+  {     6,   5,  10,   7,    1,   -9 },   // 0x24 '$'
+  {    13,   6,   8,   7,    1,   -8 },   // 0x25 '%'
+  {    19,   6,   8,   7,    1,   -8 },   // 0x26 '&'
+  {    25,   0,   0,   1,    0,    0 },   // 0x27 '''
+  {    25,   2,   9,   4,    1,   -8 },   // 0x28 '('
+  {    28,   2,   9,   3,   -1,   -8 },   // 0x29 ')'
+  {    31,   5,   4,   7,    1,   -5 },   // 0x2A '*'
+  {    34,   5,   5,   7,    1,   -6 },   // 0x2B '+'
+  {    38,   2,   2,   2,   -1,   -1 },   // 0x2C ','
+  {    39,   2,   1,   3,    0,   -4 },   // 0x2D '-'
+  {    40,   1,   1,   2,    1,   -1 },   // 0x2E '.'
+  {    41,   3,   9,   3,   -1,   -8 },   // 0x2F '/'
+  {    45,   5,   8,   6,    1,   -8 },   // 0x30 '0'
+  {    50,   3,   8,   6,    1,   -8 },   // 0x31 '1'
+  {    53,   5,   8,   6,    0,   -8 },   // 0x32 '2'
+  {    58,   5,   8,   6,    0,   -8 },   // 0x33 '3'
+  {    63,   6,   8,   6,    0,   -8 },   // 0x34 '4'
+  {    69,   5,   8,   6,    0,   -8 },   // 0x35 '5'
+  {    74,   5,   8,   6,    1,   -8 },   // 0x36 '6'
+  {    79,   5,   8,   6,    0,   -8 },   // 0x37 '7'
+  {    84,   5,   8,   6,    1,   -8 },   // 0x38 '8'
+  {    89,   5,   8,   6,    1,   -8 },   // 0x39 '9'
+  {    94,   1,   6,   2,    1,   -6 },   // 0x3A ':'
+  {    95,   2,   7,   2,    0,   -6 },   // 0x3B ';'
+  {    97,   4,   5,   6,    1,   -5 },   // 0x3C '<'
+  {   100,   4,   3,   6,    1,   -5 },   // 0x3D '='
+  {   102,   4,   5,   6,    1,   -5 },   // 0x3E '>'
+  {   105,   3,   8,   4,    1,   -8 },   // 0x3F '?'
+  {   108,   8,   9,  10,    1,   -8 },   // 0x40 '@'
+  {   117,   6,   8,   6,    0,   -8 },   // 0x41 'A'
+  {   123,   5,   8,   6,    1,   -8 },   // 0x42 'B'
+  {   128,   6,   8,   7,    1,   -8 },   // 0x43 'C'
+  {   134,   6,   8,   7,    1,   -8 },   // 0x44 'D'
+  {   140,   5,   8,   6,    1,   -8 },   // 0x45 'E'
+  {   145,   5,   8,   6,    1,   -8 },   // 0x46 'F'
+  {   150,   6,   8,   7,    1,   -8 },   // 0x47 'G'
+  {   156,   6,   8,   8,    1,   -8 },   // 0x48 'H'
+  {   162,   1,   8,   3,    1,   -8 },   // 0x49 'I'
+  {   163,   4,   8,   6,    1,   -8 },   // 0x4A 'J'
+  {   167,   5,   8,   6,    1,   -8 },   // 0x4B 'K'
+  {   172,   5,   8,   6,    1,   -8 },   // 0x4C 'L'
+  {   177,   7,   8,   9,    1,   -8 },   // 0x4D 'M'
+  {   184,   5,   8,   8,    1,   -8 },   // 0x4E 'N'
+  {   189,   6,   8,   7,    1,   -8 },   // 0x4F 'O'
+  {   195,   5,   8,   6,    1,   -8 },   // 0x50 'P'
+  {   200,   6,   8,   7,    1,   -8 },   // 0x51 'Q'
+  {   206,   5,   8,   6,    1,   -8 },   // 0x52 'R'
+  {   211,   5,   8,   6,    1,   -8 },   // 0x53 'S'
+  {   216,   5,   8,   6,    1,   -8 },   // 0x54 'T'
+  {   221,   5,   8,   7,    1,   -8 },   // 0x55 'U'
+  {   226,   6,   8,   6,    0,   -8 },   // 0x56 'V'
+  {   232,   9,   8,  10,    0,   -8 },   // 0x57 'W'
+  {   241,   5,   8,   6,    1,   -8 },   // 0x58 'X'
+  {   246,   5,   8,   6,    1,   -8 },   // 0x59 'Y'
+  {   251,   5,   8,   7,    1,   -8 },   // 0x5A 'Z'
+  {   256,   2,  10,   3,    1,   -9 },   // 0x5B '['
+  {   259,   3,   9,   3,   -1,   -8 },   // 0x5C 'backslash'
+  {   263,   2,  10,   3,   -1,   -9 },   // 0x5D ']'
+  {   266,   4,   4,   6,    1,   -6 },   // 0x5E '^'
+  {   268,   5,   1,   5,    0,    0 },   // 0x5F '_'
+  {   269,   1,   1,   3,    1,   -7 },   // 0x60 '`'
+  {   270,   4,   6,   5,    1,   -6 },   // 0x61 'a'
+  {   273,   5,   8,   6,    1,   -8 },   // 0x62 'b'
+  {   278,   4,   6,   5,    1,   -6 },   // 0x63 'c'
+  {   281,   5,   8,   6,    1,   -8 },   // 0x64 'd'
+  {   286,   5,   6,   6,    1,   -6 },   // 0x65 'e'
+  {   290,   3,   9,   3,    0,   -9 },   // 0x66 'f'
+  {   294,   5,   8,   6,    1,   -6 },   // 0x67 'g'
+  {   299,   5,   8,   7,    1,   -8 },   // 0x68 'h'
+  {   304,   1,   8,   3,    1,   -8 },   // 0x69 'i'
+  {   305,   2,  10,   3,    0,   -8 },   // 0x6A 'j'
+  {   308,   4,   8,   6,    1,   -8 },   // 0x6B 'k'
+  {   312,   2,   8,   3,    1,   -8 },   // 0x6C 'l'
+  {   314,   7,   6,   9,    1,   -6 },   // 0x6D 'm'
+  {   320,   5,   6,   7,    1,   -6 },   // 0x6E 'n'
+  {   324,   4,   6,   5,    1,   -6 },   // 0x6F 'o'
+  {   327,   5,   8,   6,    1,   -6 },   // 0x70 'p'
+  {   332,   5,   8,   6,    1,   -6 },   // 0x71 'q'
+  {   337,   3,   6,   4,    1,   -6 },   // 0x72 'r'
+  {   340,   3,   6,   4,    1,   -6 },   // 0x73 's'
+  {   343,   3,   8,   3,    0,   -8 },   // 0x74 't'
+  {   346,   5,   6,   7,    1,   -6 },   // 0x75 'u'
+  {   350,   5,   6,   5,    0,   -6 },   // 0x76 'v'
+  {   354,   8,   6,   8,    0,   -6 },   // 0x77 'w'
+  {   360,   4,   6,   5,   -1,   -6 },   // 0x78 'x'
+  {   363,   5,   8,   5,    0,   -6 },   // 0x79 'y'
+  {   368,   4,   6,   6,    1,   -6 },   // 0x7A 'z'
+  {   371,   2,  10,   3,    1,   -9 },   // 0x7B '{'
+  {   374,   1,  11,   3,    1,   -9 },   // 0x7C '|'
+  {   376,   2,  10,   3,    0,   -9 },   // 0x7D '}'
+  {   379,   4,   2,   6,    1,   -4 },   // 0x7E '~'
+};
+
+const GFXfont Glcd PROGMEM = {
+  (uint8_t *)GlcdBitmaps, (GFXglyph *)GlcdGlyphs, 0x20, 0x7E, 13 };
+
+const uint8_t FreeSans9pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xF0, 0xF0, 0xDE, 0xF7, 0xBD, 0x80, 0x09, 0x05, 0x82, 0x82, 0x41, 0x23, 0xFC, 0x58,
+  0x68, 0xFF, 0x12, 0x09, 0x05, 0x06, 0x82, 0x40, 0x08, 0x04, 0x1F, 0x9D, 0x6C, 0x9E, 0x4F, 0x20,
+  0xF0, 0x3E, 0x07, 0x82, 0xE1, 0x3C, 0x9E, 0x4F, 0xAC, 0x7C, 0x08, 0x04, 0x00, 0x78, 0x26, 0x63,
+  0x33, 0x31, 0x99, 0x0C, 0xD8, 0x3C, 0x80, 0x0C, 0x00, 0xC0, 0x04, 0xF0, 0x6C, 0xC2, 0x66, 0x33,
+  0x33, 0x19, 0x90, 0x78, 0x1E, 0x06, 0x01, 0x80, 0x30, 0x06, 0x18, 0x63, 0x07, 0xFB, 0x0C, 0xC1,
+  0x98, 0x33, 0x06, 0x60, 0xC6, 0x18, 0x7F, 0x00, 0xFF, 0xC0, 0x25, 0x25, 0x24, 0x92, 0x49, 0x92,
+  0x64, 0x91, 0x24, 0x49, 0x24, 0x92, 0xD2, 0xD0, 0x10, 0x20, 0x47, 0xF1, 0x05, 0x11, 0x22, 0x08,
+  0x08, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x6B, 0x40, 0xF0, 0xF0, 0x04, 0x30, 0x82, 0x18,
+  0x41, 0x0C, 0x20, 0x86, 0x10, 0x43, 0x08, 0x00, 0x1E, 0x1C, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x73, 0x87, 0x80, 0x1D, 0xFE, 0xE3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x1E, 0x31, 0x90, 0x78, 0x30, 0x18, 0x0C, 0x0C, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x06, 0x06, 0x07, 0xFC, 0x1F, 0x0C, 0x66, 0x0D, 0x83, 0x00, 0xC0, 0x60, 0xF0, 0x06, 0x00,
+  0xC0, 0x3C, 0x0D, 0x03, 0x61, 0x8F, 0x80, 0x01, 0x80, 0xE0, 0x78, 0x36, 0x0D, 0x86, 0x63, 0x19,
+  0x86, 0x61, 0xBF, 0xF0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x7F, 0x98, 0x06, 0x01, 0x80, 0x40, 0x17,
+  0xC6, 0x19, 0x83, 0x00, 0xC0, 0x3C, 0x0D, 0x03, 0x61, 0x8F, 0x80, 0x1F, 0x08, 0x66, 0x0D, 0x00,
+  0xDF, 0x38, 0x6E, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x87, 0x80, 0xFF, 0xC0, 0x30,
+  0x18, 0x04, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x00, 0x1F,
+  0x0C, 0x66, 0x0D, 0x83, 0x60, 0xCC, 0x61, 0xF1, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x8F,
+  0xC0, 0x1E, 0x18, 0x6C, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x87, 0x3E, 0xC0, 0x3C, 0x0B, 0x86,
+  0x63, 0x0F, 0x80, 0xF0, 0x00, 0x3C, 0x6C, 0x00, 0x00, 0x0D, 0x68, 0x01, 0x07, 0x1C, 0x60, 0x80,
+  0xE0, 0x38, 0x0E, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x07, 0x1C,
+  0x70, 0xC0, 0x3E, 0x31, 0xB0, 0x78, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x04, 0x06, 0x00, 0x01,
+  0x80, 0xC0, 0x03, 0xE0, 0x18, 0x30, 0xC0, 0x33, 0x1F, 0xA4, 0xC7, 0x31, 0x0C, 0x66, 0x18, 0xCC,
+  0x31, 0x98, 0xE3, 0x31, 0xCA, 0x3D, 0xE2, 0x00, 0x06, 0x00, 0x86, 0x06, 0x03, 0xF0, 0x00, 0x0E,
+  0x01, 0xC0, 0x2C, 0x0D, 0x81, 0x90, 0x23, 0x0C, 0x61, 0x8C, 0x3F, 0xCC, 0x19, 0x81, 0x60, 0x3C,
+  0x07, 0x80, 0x40, 0xFE, 0x30, 0xCC, 0x1B, 0x06, 0xC1, 0xB0, 0xCF, 0xE3, 0x06, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC1, 0xBF, 0xC0, 0x0F, 0x83, 0x86, 0x60, 0x36, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x03, 0x60, 0x36, 0x02, 0x38, 0x60, 0xF8, 0xFE, 0x18, 0x33, 0x03, 0x60, 0x6C,
+  0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0x60, 0x6C, 0x19, 0xFC, 0x00, 0xFF, 0xE0,
+  0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xFF, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0xFC, 0xFF, 0xE0,
+  0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xFE, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x00, 0x0F, 0x83,
+  0x0E, 0x60, 0x76, 0x03, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x1F, 0xC0, 0x3C, 0x03, 0x60, 0x36, 0x07,
+  0x30, 0xB1, 0xF3, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1F, 0xFF, 0xC0, 0x78,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x80, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x06, 0x03, 0x01, 0xE0, 0xF0, 0x78, 0x36, 0x31, 0xF0, 0xC0, 0xF0, 0x6C, 0x1B, 0x0C,
+  0xC6, 0x33, 0x0D, 0x83, 0xE0, 0xEC, 0x33, 0x8C, 0x73, 0x0C, 0xC1, 0xB0, 0x30, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0xFC, 0xE0, 0x1F, 0xC0,
+  0xFF, 0x03, 0xF4, 0x0B, 0xD8, 0x2F, 0x61, 0xBD, 0x84, 0xF2, 0x13, 0xCC, 0xCF, 0x33, 0x3C, 0x48,
+  0xF1, 0xE3, 0xC7, 0x8F, 0x0C, 0x30, 0xE0, 0x7E, 0x0F, 0xC1, 0xEC, 0x3D, 0x87, 0x98, 0xF3, 0x1E,
+  0x33, 0xC6, 0x78, 0x6F, 0x0D, 0xE0, 0xFC, 0x1F, 0x81, 0xC0, 0x0F, 0x81, 0x83, 0x18, 0x0C, 0xC0,
+  0x6C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0C, 0xC0, 0x63, 0x06, 0x07,
+  0xC0, 0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1B, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x00, 0x0F, 0x81, 0x83, 0x18, 0x0C, 0xC0, 0x6C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0xD8, 0x0C, 0xC0, 0x63, 0x06, 0x07, 0xFC, 0x00, 0x40, 0xFF, 0x30, 0x6C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x1B, 0xFC, 0xC1, 0xB0, 0x6C, 0x1B, 0x02, 0xC0, 0xF0, 0x30, 0x1F, 0x0C,
+  0x66, 0x0D, 0x83, 0x60, 0x1E, 0x03, 0xF0, 0x3E, 0x01, 0xC0, 0x3C, 0x0D, 0x83, 0x71, 0x87, 0xC0,
+  0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x8F, 0xC0, 0xC0, 0x3C, 0x06, 0xC0, 0x66, 0x04, 0x60, 0xC2, 0x0C,
+  0x30, 0x83, 0x18, 0x11, 0x81, 0x90, 0x1B, 0x00, 0xB0, 0x0E, 0x00, 0xE0, 0xC1, 0xC0, 0xF0, 0x70,
+  0x3C, 0x1E, 0x1B, 0x05, 0x86, 0x63, 0x61, 0x98, 0xC8, 0x46, 0x23, 0x31, 0x88, 0xCC, 0x26, 0x33,
+  0x0D, 0x84, 0x83, 0x41, 0xE0, 0x50, 0x78, 0x1C, 0x1C, 0x07, 0x03, 0x00, 0xC0, 0x6C, 0x19, 0x83,
+  0x18, 0xC1, 0xB0, 0x34, 0x03, 0x80, 0x70, 0x1B, 0x02, 0x60, 0xC6, 0x30, 0x64, 0x0D, 0x80, 0xC0,
+  0xC0, 0x36, 0x06, 0x30, 0x43, 0x0C, 0x19, 0x81, 0x98, 0x0F, 0x00, 0xF0, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0xFF, 0xC0, 0x30, 0x18, 0x0C, 0x03, 0x01, 0x80, 0xC0, 0x20, 0x18,
+  0x0C, 0x02, 0x01, 0x80, 0xC0, 0x3F, 0xF0, 0xF2, 0x49, 0x24, 0x92, 0x49, 0x24, 0xE0, 0x83, 0x04,
+  0x10, 0x60, 0x82, 0x0C, 0x10, 0x41, 0x82, 0x08, 0x30, 0x40, 0xE4, 0x92, 0x49, 0x24, 0x92, 0x49,
+  0xE0, 0x18, 0x38, 0x2C, 0x24, 0x44, 0x42, 0xC2, 0x83, 0xFF, 0xD0, 0x3E, 0x63, 0x43, 0x03, 0x1F,
+  0x7F, 0xE3, 0xC3, 0xC3, 0xC7, 0x7B, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xDF, 0x38, 0x6E, 0x1B, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xB8, 0xED, 0xE0, 0x1E, 0x18, 0x66, 0x1B, 0x03, 0xC0, 0x30,
+  0x0C, 0x03, 0x00, 0x61, 0x98, 0xE3, 0xE0, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x1E, 0xD8, 0x76, 0x1F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0xD8, 0x73, 0xEC, 0x1E, 0x31, 0x98, 0x78, 0x1C, 0x0F,
+  0xFF, 0x01, 0x81, 0x41, 0xB1, 0x8F, 0x80, 0x3B, 0x18, 0xCF, 0xB1, 0x8C, 0x63, 0x18, 0xC6, 0x31,
+  0x80, 0x1E, 0xD8, 0x76, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0xD8, 0x73, 0xEF, 0x03,
+  0x40, 0xD8, 0x63, 0xF0, 0xC0, 0x60, 0x30, 0x18, 0x0D, 0xE7, 0x1B, 0x87, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xF3, 0xFF, 0xFF, 0xF0, 0x33, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x7E, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3E, 0x1B, 0x19, 0x98, 0xD8, 0x78, 0x3E, 0x19, 0x8C,
+  0x66, 0x1B, 0x0E, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB8, 0xDE, 0x7B, 0x9E, 0x7C, 0x30, 0xF0, 0xC3,
+  0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xC0, 0xDE, 0x71, 0xB8,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x60, 0x1F, 0x0E, 0x39, 0x83, 0x60, 0x3C,
+  0x07, 0x80, 0xF0, 0x1E, 0x03, 0x60, 0xCE, 0x38, 0x7C, 0x00, 0xDF, 0x38, 0x6E, 0x1B, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xB8, 0xED, 0xE3, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x1E, 0xD8, 0x76,
+  0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0xD8, 0x73, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0xDF, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x30, 0x3C, 0xC6, 0xC3, 0xC0, 0xF0, 0x7E, 0x0F, 0x03, 0xC3,
+  0xC3, 0x7C, 0x63, 0x19, 0xF6, 0x31, 0x8C, 0x63, 0x18, 0xC7, 0x1C, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC3, 0xB1, 0xCF, 0x60, 0xC0, 0xD0, 0x36, 0x09, 0x86, 0x21, 0x8C, 0x43,
+  0x30, 0x48, 0x1A, 0x07, 0x80, 0xC0, 0xC1, 0x83, 0x87, 0x0D, 0x8F, 0x1B, 0x16, 0x36, 0x2C, 0x44,
+  0xC9, 0x8D, 0x9B, 0x1A, 0x34, 0x14, 0x38, 0x38, 0x70, 0x70, 0xC0, 0xC1, 0xB1, 0x8C, 0xC6, 0xC1,
+  0xC0, 0x60, 0x70, 0x6C, 0x23, 0x31, 0xB0, 0x60, 0xC0, 0xF0, 0x26, 0x19, 0x86, 0x61, 0x0C, 0xC3,
+  0x30, 0x48, 0x1E, 0x07, 0x00, 0xC0, 0x30, 0x08, 0x06, 0x07, 0x00, 0xFF, 0x03, 0x06, 0x0C, 0x0C,
+  0x18, 0x30, 0x20, 0x60, 0xC0, 0xFF, 0x34, 0x44, 0x22, 0x26, 0x86, 0x22, 0x24, 0x44, 0x30, 0xFF,
+  0xFF, 0xF0, 0xC2, 0x22, 0x44, 0x46, 0x16, 0x44, 0x42, 0x22, 0xC0, 0x61, 0x99, 0x8E,
+};
+
+const GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   4,    0,    0 },   // 0x20 ' '
+  {     0,   2,  14,   5,    1,  -14 },   // 0x21 '!'
+  {     4,   5,   5,   7,    2,  -15 },   // 0x22 '"'
+  {     8,   9,  14,  11,    1,  -14 },   // 0x23 '#'
+  {    24,   9,  18,  12,    2,  -16 },   // 0x24 '$'
+  {    45,  13,  14,  15,    1,  -14 },   // 0x25 '%'
+  {    68,  11,  14,  13,    1,  -14 },   // 0x26 '&'
+  {    88,   2,   5,   4,    1,  -15 },   // 0x27 '''
+  {    90,   3,  18,   6,    2,  -16 },   // 0x28 '('
+  {    97,   3,  18,   6,    1,  -16 },   // 0x29 ')'
+  {   104,   7,   8,  11,    2,  -10 },   // 0x2A '*'
+  {   111,   8,   9,  12,    2,  -11 },   // 0x2B '+'
+  {   120,   3,   4,   4,   -1,   -2 },   // 0x2C ','
+  {   122,   4,   1,   6,    1,   -6 },   // 0x2D '-'
+  {   123,   2,   2,   5,    1,   -2 },   // 0x2E '.'
+  {   124,   6,  15,   6,   -1,  -15 },   // 0x2F '/'
+  {   136,  10,  14,  12,    1,  -14 },   // 0x30 '0'
+  {   154,   6,  14,  12,    3,  -14 },   // 0x31 '1'
+  {   165,   9,  14,  12,    1,  -14 },   // 0x32 '2'
+  {   181,  10,  14,  12,    1,  -14 },   // 0x33 '3'
+  {   199,  10,  14,  12,    1,  -14 },   // 0x34 '4'
+  {   217,  10,  14,  12,    1,  -14 },   // 0x35 '5'
+  {   235,  10,  14,  12,    1,  -14 },   // 0x36 '6'
+  {   253,  10,  14,  12,    1,  -14 },   // 0x37 '7'
+  {   271,  10,  14,  12,    1,  -14 },   // 0x38 '8'
+  {   289,  10,  14,  12,    1,  -14 },   // 0x39 '9'
+  {   307,   2,  11,   5,    1,  -11 },   // 0x3A ':'
+  {   310,   3,  13,   5,   -1,  -11 },   // 0x3B ';'
+  {   315,   8,   9,  12,    2,  -11 },   // 0x3C '<'
+  {   324,   8,   5,  12,    2,   -9 },   // 0x3D '='
+  {   329,   8,   9,  11,    1,  -11 },   // 0x3E '>'
+  {   338,   9,  14,  11,    1,  -14 },   // 0x3F '?'
+  {   354,  15,  15,  17,    1,  -13 },   // 0x40 '@'
+  {   383,  11,  14,  13,    1,  -14 },   // 0x41 'A'
+  {   403,  10,  14,  13,    2,  -14 },   // 0x42 'B'
+  {   421,  12,  14,  14,    1,  -14 },   // 0x43 'C'
+  {   442,  11,  14,  14,    2,  -14 },   // 0x44 'D'
+  {   462,   9,  14,  12,    2,  -14 },   // 0x45 'E'
+  {   478,   9,  14,  12,    2,  -14 },   // 0x46 'F'
+  {   494,  12,  14,  14,    1,  -14 },   // 0x47 'G'
+  {   515,  11,  14,  15,    2,  -14 },   // 0x48 'H'
+  {   535,   2,  14,   5,    2,  -14 },   // 0x49 'I'
+  {   539,   9,  14,  11,    1,  -14 },   // 0x4A 'J'
+  {   555,  10,  14,  12,    2,  -14 },   // 0x4B 'K'
+  {   573,   9,  14,  12,    2,  -14 },   // 0x4C 'L'
+  {   589,  14,  14,  17,    2,  -14 },   // 0x4D 'M'
+  {   614,  11,  14,  14,    2,  -14 },   // 0x4E 'N'
+  {   634,  13,  14,  15,    1,  -14 },   // 0x4F 'O'
+  {   657,  10,  14,  12,    2,  -14 },   // 0x50 'P'
+  {   675,  13,  15,  15,    1,  -14 },   // 0x51 'Q'
+  {   700,  10,  14,  12,    2,  -14 },   // 0x52 'R'
+  {   718,  10,  14,  12,    1,  -14 },   // 0x53 'S'
+  {   736,  12,  14,  13,    1,  -14 },   // 0x54 'T'
+  {   757,  10,  14,  13,    2,  -14 },   // 0x55 'U'
+  {   775,  12,  14,  12,    1,  -14 },   // 0x56 'V'
+  {   796,  18,  14,  19,    1,  -14 },   // 0x57 'W'
+  {   828,  11,  14,  13,    1,  -14 },   // 0x58 'X'
+  {   848,  12,  14,  12,    0,  -14 },   // 0x59 'Y'
+  {   869,  10,  14,  12,    1,  -14 },   // 0x5A 'Z'
+  {   887,   3,  17,   6,    2,  -15 },   // 0x5B '['
+  {   894,   6,  15,   6,   -1,  -15 },   // 0x5C 'backslash'
+  {   906,   3,  17,   6,    1,  -15 },   // 0x5D ']'
+  {   913,   8,   8,  12,    2,  -12 },   // 0x5E '^'
+  {   921,   8,   1,  10,    1,    1 },   // 0x5F '_'
+  {   922,   2,   2,   6,    1,  -14 },   // 0x60 '`'
+  {   923,   8,  11,  11,    1,  -11 },   // 0x61 'a'
+  {   934,  10,  15,  12,    1,  -15 },   // 0x62 'b'
+  {   953,  10,  11,  11,    1,  -11 },   // 0x63 'c'
+  {   967,  10,  15,  13,    1,  -15 },   // 0x64 'd'
+  {   986,   9,  11,  11,    1,  -11 },   // 0x65 'e'
+  {   999,   5,  15,   7,    1,  -15 },   // 0x66 'f'
+  {  1009,  10,  15,  13,    1,  -11 },   // 0x67 'g'
+  {  1028,   9,  15,  11,    1,  -15 },   // 0x68 'h'
+  {  1045,   2,  14,   4,    1,  -14 },   // 0x69 'i'
+  {  1049,   4,  18,   4,   -1,  -14 },   // 0x6A 'j'
+  {  1058,   9,  15,  10,    1,  -15 },   // 0x6B 'k'
+  {  1075,   3,  15,   5,    1,  -15 },   // 0x6C 'l'
+  {  1081,  14,  11,  17,    1,  -11 },   // 0x6D 'm'
+  {  1101,   9,  11,  11,    1,  -11 },   // 0x6E 'n'
+  {  1114,  11,  11,  12,    1,  -11 },   // 0x6F 'o'
+  {  1130,  10,  15,  12,    1,  -11 },   // 0x70 'p'
+  {  1149,  10,  15,  13,    1,  -11 },   // 0x71 'q'
+  {  1168,   5,  11,   6,    1,  -11 },   // 0x72 'r'
+  {  1175,   8,  11,   9,    1,  -11 },   // 0x73 's'
+  {  1186,   5,  14,   7,    1,  -14 },   // 0x74 't'
+  {  1195,   9,  11,  12,    1,  -11 },   // 0x75 'u'
+  {  1208,  10,  11,  10,    0,  -11 },   // 0x76 'v'
+  {  1222,  15,  11,  16,    0,  -11 },   // 0x77 'w'
+  {  1243,   9,  11,  10,   -1,  -11 },   // 0x78 'x'
+  {  1256,  10,  15,  10,   -1,  -11 },   // 0x79 'y'
+  {  1275,   8,  11,  10,    1,  -11 },   // 0x7A 'z'
+  {  1286,   4,  17,   6,    1,  -15 },   // 0x7B '{'
+  {  1295,   1,  20,   5,    2,  -16 },   // 0x7C '|'
+  {  1298,   4,  17,   6,    1,  -15 },   // 0x7D '}'
+  {  1307,   8,   3,  12,    2,   -8 },   // 0x7E '~'
+};
+
+const GFXfont FreeSans9pt7b PROGMEM = {
+  (uint8_t *)FreeSans9pt7bBitmaps, (GFXglyph *)FreeSans9pt7bGlyphs, 0x20, 0x7E, 25 };
+
+const uint8_t FreeSans12pt7bBitmaps[] PROGMEM = {
+  0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0x07, 0xFC, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x06, 0x60, 0x44, 0x04,
+  0x40, 0xCC, 0x0C, 0xC0, 0xCC, 0x7F, 0xF0, 0x98, 0x19, 0x81, 0x98, 0x19, 0x0F, 0xFE, 0x33, 0x03,
+  0x30, 0x33, 0x02, 0x20, 0x22, 0x06, 0x60, 0x03, 0x00, 0x30, 0x03, 0x01, 0xFC, 0x3B, 0x67, 0x36,
+  0x63, 0x36, 0x33, 0x63, 0x07, 0x30, 0x3F, 0x01, 0xFC, 0x07, 0xE0, 0x37, 0x03, 0x30, 0x33, 0xE3,
+  0x36, 0x33, 0x73, 0x63, 0xFE, 0x1F, 0xC0, 0x30, 0x03, 0x00, 0x3C, 0x06, 0x33, 0x07, 0x30, 0xC3,
+  0x18, 0x63, 0x0C, 0x33, 0x86, 0x19, 0x81, 0x99, 0x80, 0x79, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+  0xE3, 0x80, 0x63, 0x60, 0x73, 0x18, 0x71, 0x8C, 0x30, 0xC6, 0x38, 0x63, 0x38, 0x1B, 0x18, 0x07,
+  0x00, 0x0F, 0xC0, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x06, 0x18, 0x0C, 0x18, 0x18,
+  0x0F, 0xFE, 0x60, 0x61, 0x80, 0xC6, 0x01, 0x8C, 0x03, 0x18, 0x06, 0x30, 0x0C, 0x70, 0x18, 0x70,
+  0x30, 0x3F, 0xE0, 0xFF, 0xF0, 0x18, 0x8C, 0x46, 0x31, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x08, 0x63,
+  0x18, 0x63, 0x0C, 0xC2, 0x18, 0x43, 0x18, 0x43, 0x18, 0xC6, 0x31, 0x8C, 0x62, 0x31, 0x8C, 0xC6,
+  0x60, 0x0C, 0x03, 0x00, 0xC2, 0x31, 0xFF, 0xC7, 0x81, 0xE0, 0xCC, 0x61, 0x98, 0x60, 0x0C, 0x01,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x3F, 0xF8, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0x76,
+  0x6C, 0xC0, 0xF8, 0xFF, 0x80, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x0C, 0x0C, 0x08, 0x18, 0x18,
+  0x10, 0x30, 0x30, 0x20, 0x60, 0x60, 0x40, 0xC0, 0x80, 0x0F, 0x81, 0xC7, 0x18, 0x0C, 0xC0, 0x66,
+  0x03, 0x60, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xB0, 0x19,
+  0x80, 0xCC, 0x06, 0x38, 0xE0, 0x7C, 0x00, 0x0E, 0x7D, 0xFF, 0x38, 0x60, 0xC1, 0x83, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x0F, 0x83, 0x8E, 0x70, 0x66, 0x03, 0x60, 0x3E, 0x03,
+  0x00, 0x30, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0F, 0xFF, 0x0F, 0x81, 0xC3, 0x1C, 0x0C, 0xC0, 0x66, 0x03, 0x00, 0x18, 0x01, 0x80, 0x1C, 0x07,
+  0x80, 0x03, 0x00, 0x0C, 0x00, 0x3C, 0x01, 0xE0, 0x0F, 0x80, 0x6C, 0x06, 0x38, 0x60, 0xFC, 0x00,
+  0x00, 0x60, 0x07, 0x00, 0x78, 0x07, 0xC0, 0x36, 0x03, 0x30, 0x39, 0x81, 0x8C, 0x18, 0x61, 0xC3,
+  0x1C, 0x18, 0xC0, 0xCF, 0xFF, 0x80, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x7F, 0xF6,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x6F, 0x87, 0x0E, 0xE0, 0x6E, 0x03, 0x00, 0x30, 0x03,
+  0x00, 0x3C, 0x03, 0xE0, 0x36, 0x06, 0x70, 0xC1, 0xF0, 0x0F, 0x81, 0x0C, 0x20, 0x66, 0x03, 0x40,
+  0x3C, 0x00, 0xCF, 0x8F, 0x0C, 0xE0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x40, 0x26,
+  0x06, 0x30, 0xC1, 0xF0, 0xFF, 0xF8, 0x01, 0xC0, 0x1C, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x07, 0x00,
+  0x30, 0x03, 0x80, 0x18, 0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x70, 0x03, 0x00, 0x38, 0x01,
+  0x80, 0x00, 0x0F, 0x81, 0xC7, 0x1C, 0x1C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0xC1, 0xC6, 0x1C, 0x1F,
+  0x83, 0x83, 0x18, 0x0D, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x6C, 0x06, 0x30, 0x60, 0xFE, 0x00,
+  0x1F, 0x83, 0x0C, 0x60, 0x6C, 0x02, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0x73, 0x0F, 0x1F,
+  0x30, 0x03, 0xC0, 0x3C, 0x06, 0xE0, 0x66, 0x04, 0x30, 0x81, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+  0xC0, 0x39, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x39, 0x8C, 0xE0, 0x00, 0x20, 0x1C, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0x30, 0x03, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80, 0x30, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x80, 0x1C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x38,
+  0x1E, 0x0F, 0x07, 0x83, 0xC0, 0x60, 0x00, 0x1F, 0x0E, 0x19, 0x81, 0xE0, 0x3C, 0x06, 0x00, 0xC0,
+  0x38, 0x06, 0x01, 0x80, 0x70, 0x1C, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x01, 0xC0,
+  0x07, 0x07, 0x01, 0x80, 0x30, 0x60, 0x03, 0x18, 0x00, 0x66, 0x0F, 0x66, 0xC3, 0x18, 0xF8, 0xC3,
+  0x1E, 0x30, 0x63, 0xC6, 0x0C, 0x78, 0xC1, 0x8F, 0x18, 0x61, 0xE3, 0x0C, 0x6C, 0x73, 0x99, 0xC7,
+  0x9E, 0x18, 0x00, 0x03, 0x80, 0x00, 0x38, 0x03, 0x01, 0x81, 0xC0, 0x1F, 0xC0, 0x00, 0x03, 0x80,
+  0x07, 0x80, 0x1B, 0x00, 0x36, 0x00, 0x66, 0x01, 0x8C, 0x03, 0x18, 0x0E, 0x38, 0x18, 0x30, 0x30,
+  0x60, 0xFF, 0xE1, 0x80, 0xC3, 0x01, 0xCE, 0x01, 0x98, 0x03, 0x30, 0x07, 0xE0, 0x07, 0x80, 0x0C,
+  0xFF, 0x8C, 0x0E, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x0E, 0xFF, 0x8C, 0x0E, 0xC0,
+  0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x06, 0xC0, 0xEF, 0xF8, 0x07, 0xE0, 0x38, 0x70, 0xC0,
+  0x31, 0x00, 0x76, 0x00, 0x68, 0x00, 0xF0, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06,
+  0x00, 0x0C, 0x00, 0x6C, 0x00, 0xD8, 0x03, 0x98, 0x0E, 0x1C, 0x38, 0x0F, 0xC0, 0xFF, 0xC1, 0x80,
+  0xE3, 0x00, 0x66, 0x00, 0x6C, 0x00, 0xD8, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
+  0x00, 0x1E, 0x00, 0x3C, 0x00, 0xD8, 0x01, 0xB0, 0x06, 0x60, 0x1C, 0xC0, 0x61, 0xFF, 0x00, 0xFF,
+  0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFE, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x0C, 0x00,
+  0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x03, 0xF0, 0x0C, 0x1C, 0x30, 0x0E, 0x30, 0x07, 0x60, 0x03, 0x60,
+  0x03, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x7F, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0x60,
+  0x07, 0x70, 0x07, 0x30, 0x0F, 0x1C, 0x3B, 0x07, 0xE3, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
+  0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3C, 0x07,
+  0x80, 0xF0, 0x1E, 0x06, 0x60, 0xC3, 0xE0, 0xC0, 0x3E, 0x03, 0xB0, 0x19, 0x81, 0x8C, 0x18, 0x61,
+  0x83, 0x18, 0x19, 0xC0, 0xDC, 0x07, 0xE0, 0x3F, 0x81, 0xCE, 0x0C, 0x70, 0x61, 0xC3, 0x07, 0x18,
+  0x1C, 0xC0, 0x76, 0x03, 0xC0, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF,
+  0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xD8, 0x06, 0xF6, 0x01, 0xBD, 0xC0, 0xEF,
+  0x30, 0x33, 0xCC, 0x0C, 0xF1, 0x86, 0x3C, 0x61, 0x8F, 0x18, 0x63, 0xC3, 0x30, 0xF0, 0xCC, 0x3C,
+  0x3B, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x30, 0xF0, 0x0F, 0xC0, 0x3F, 0x80, 0xF6, 0x03,
+  0xDC, 0x0F, 0x30, 0x3C, 0xE0, 0xF1, 0x83, 0xC7, 0x0F, 0x0E, 0x3C, 0x18, 0xF0, 0x73, 0xC0, 0xCF,
+  0x03, 0xBC, 0x06, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0xF0, 0x07, 0xF0, 0x0E, 0x0E, 0x0C, 0x01, 0x8C,
+  0x00, 0xE6, 0x00, 0x37, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x13, 0x00, 0x19, 0x80, 0x0C, 0x60, 0x0C, 0x1C, 0x1C, 0x03, 0xF8, 0x00,
+  0xFF, 0x8C, 0x0E, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x06, 0xC0, 0xEF, 0xF8, 0xC0,
+  0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x07, 0xF0, 0x0E, 0x0E, 0x0C,
+  0x01, 0x8C, 0x00, 0xE6, 0x00, 0x37, 0x00, 0x1B, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x13, 0x00, 0x19, 0x80, 0x08, 0x60, 0x0C, 0x1C, 0x1E, 0x03,
+  0xFF, 0xC0, 0x00, 0x40, 0xFF, 0x8C, 0x0E, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x06,
+  0xC0, 0xEF, 0xF8, 0xC0, 0xCC, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0x0F,
+  0xC0, 0x83, 0x08, 0x0C, 0xC0, 0x36, 0x01, 0xB0, 0x01, 0xE0, 0x07, 0xE0, 0x1F, 0xE0, 0x7F, 0x80,
+  0x3C, 0x00, 0x70, 0x01, 0xE0, 0x0F, 0x80, 0x6C, 0x02, 0x38, 0x60, 0x7E, 0x00, 0xFF, 0xFE, 0x03,
+  0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00,
+  0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0xC0,
+  0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0,
+  0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x6C, 0x06, 0x30, 0x60, 0xFC, 0x00, 0xC0, 0x07, 0xC0,
+  0x0D, 0x80, 0x3B, 0x00, 0x67, 0x00, 0xC6, 0x03, 0x8C, 0x06, 0x1C, 0x0C, 0x18, 0x30, 0x30, 0x60,
+  0x70, 0xC0, 0x63, 0x00, 0xC6, 0x01, 0xCC, 0x01, 0xB0, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0xC0,
+  0x38, 0x07, 0xC0, 0x78, 0x0F, 0x81, 0xF0, 0x1B, 0x03, 0x60, 0x76, 0x06, 0xC0, 0xCE, 0x0D, 0xC1,
+  0x9C, 0x31, 0x83, 0x18, 0x63, 0x0E, 0x30, 0xC6, 0x18, 0x61, 0x8E, 0x30, 0xE6, 0x0C, 0x60, 0xCC,
+  0x19, 0x81, 0x98, 0x33, 0x03, 0x30, 0x76, 0x07, 0xC0, 0x6C, 0x07, 0x80, 0xF0, 0x0F, 0x01, 0xE0,
+  0x1E, 0x01, 0xC0, 0xE0, 0x0E, 0xE0, 0x38, 0xC0, 0x61, 0xC1, 0x81, 0xC7, 0x01, 0x8C, 0x03, 0xB0,
+  0x03, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x1F, 0x00, 0x77, 0x00, 0xC6, 0x03, 0x0E, 0x0E, 0x0E, 0x38,
+  0x0C, 0x60, 0x0D, 0xC0, 0x1C, 0xE0, 0x0D, 0x80, 0x67, 0x03, 0x8C, 0x0C, 0x38, 0x70, 0x61, 0x81,
+  0xCE, 0x03, 0x30, 0x07, 0x80, 0x1E, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+  0xC0, 0x03, 0x00, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x70, 0x03, 0x80,
+  0x1C, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x60, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x03, 0x80, 0x1C,
+  0x00, 0xE0, 0x03, 0xFF, 0xF0, 0xFE, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0x8C, 0x7C, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x20, 0x30, 0x30, 0x10, 0x18, 0x18, 0x08, 0x0C,
+  0x0C, 0x04, 0x06, 0x06, 0x02, 0x03, 0x03, 0xF8, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C,
+  0x63, 0x18, 0xC6, 0x31, 0xFC, 0x04, 0x01, 0xC0, 0x28, 0x0D, 0x81, 0x90, 0x63, 0x0C, 0x61, 0x04,
+  0x60, 0xCC, 0x0B, 0x01, 0x80, 0xFF, 0xC0, 0xCC, 0x80, 0x1F, 0x86, 0x19, 0x81, 0xB0, 0x30, 0x06,
+  0x03, 0xCF, 0xFB, 0xC3, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x76, 0x1E, 0x7E, 0xC0, 0xC0, 0x06, 0x00,
+  0x30, 0x01, 0x80, 0x0C, 0x00, 0x67, 0xC3, 0xC1, 0x9C, 0x06, 0xE0, 0x36, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7C, 0x06, 0xE0, 0x37, 0xC7, 0x37, 0xE0, 0x0F, 0x83, 0x0C, 0x60,
+  0x66, 0x07, 0xC0, 0x7C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x66, 0x06, 0x30, 0xC1,
+  0xF8, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x87, 0xEC, 0xC3, 0xEC, 0x07, 0x60, 0x3E,
+  0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x6C, 0x07, 0x60, 0x39, 0x83, 0xC3, 0xE6,
+  0x0F, 0x83, 0x0E, 0x60, 0x76, 0x03, 0xC0, 0x3C, 0x03, 0xFF, 0xFC, 0x00, 0xC0, 0x0C, 0x03, 0x60,
+  0x36, 0x06, 0x30, 0xE0, 0xF8, 0x04, 0x3C, 0xE1, 0x83, 0x06, 0x3F, 0x98, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x80, 0x0F, 0xD9, 0x87, 0xD8, 0x0E, 0xC0, 0x7C, 0x01, 0xE0,
+  0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0E, 0xC0, 0x73, 0x07, 0x87, 0xCF, 0x00, 0x78,
+  0x03, 0x60, 0x31, 0x83, 0x07, 0xE0, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0xF8, 0xF0,
+  0x6E, 0x07, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x30, 0xFF, 0x8D, 0xB6, 0xDB, 0x6D, 0xB6, 0xD8, 0x39, 0xCE, 0x03, 0x18, 0xC6, 0x31,
+  0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x7B, 0x80, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01,
+  0x81, 0xF0, 0x76, 0x1C, 0xC7, 0x19, 0xC3, 0x70, 0x7C, 0x0F, 0xC1, 0xDC, 0x33, 0x86, 0x38, 0xC3,
+  0x98, 0x3B, 0x03, 0x80, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x70, 0xDF, 0x1F,
+  0x3C, 0x6C, 0x6E, 0x0E, 0x0F, 0x03, 0x03, 0xC0, 0xC0, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0x03, 0x03,
+  0xC0, 0xC0, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0x03, 0x03, 0xC0, 0xC0, 0xF0, 0x30, 0x30, 0xCF, 0x8F,
+  0x06, 0xE0, 0x7E, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0x0F, 0x81, 0xC7, 0x18, 0x0C, 0xC0, 0x6C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0xD8, 0x0C, 0xC0, 0x63, 0x06, 0x07, 0xC0, 0xCF, 0x87, 0x83, 0x38, 0x0D, 0xC0,
+  0x6C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x0D, 0xC0, 0x6F, 0x8E, 0x6F,
+  0xC3, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x00, 0x0F, 0xD9, 0x87, 0xD8, 0x0E, 0xC0, 0x7C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xD8, 0x0E, 0xC0, 0x73, 0x07, 0x87, 0xCC,
+  0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0xDF, 0xE3, 0x86, 0x0C, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x06, 0x0C, 0x18, 0x00, 0x3E, 0x18, 0xEC, 0x1F, 0x03, 0xE0, 0x3E, 0x07, 0xF0, 0xFE, 0x07,
+  0xC0, 0x7C, 0x0F, 0x03, 0x61, 0x8F, 0xC0, 0x30, 0x60, 0xC7, 0xF3, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x06, 0x0C, 0x1F, 0x1E, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7E, 0x07, 0x70, 0xF1, 0xF3, 0xE0, 0x1B, 0x01, 0xD8, 0x0C,
+  0xE0, 0x63, 0x07, 0x18, 0x30, 0xE1, 0x83, 0x18, 0x18, 0xC0, 0x66, 0x03, 0x60, 0x1B, 0x00, 0x78,
+  0x03, 0x80, 0xE0, 0x70, 0x3E, 0x0F, 0x07, 0x60, 0xF0, 0x67, 0x0F, 0x86, 0x70, 0xD8, 0x63, 0x19,
+  0x8E, 0x31, 0x98, 0xC3, 0x98, 0xCC, 0x19, 0x8C, 0xC1, 0xB0, 0xD8, 0x1B, 0x0D, 0x80, 0xF0, 0x78,
+  0x0E, 0x07, 0x00, 0xE0, 0x70, 0xE0, 0x77, 0x06, 0x30, 0xC3, 0x9C, 0x1D, 0x80, 0xF0, 0x0F, 0x00,
+  0xF0, 0x0F, 0x01, 0x98, 0x39, 0xC3, 0x0E, 0x60, 0x6E, 0x07, 0xC0, 0x3E, 0x03, 0xE0, 0x76, 0x06,
+  0x60, 0x63, 0x0E, 0x30, 0xC3, 0x0C, 0x19, 0x81, 0x98, 0x19, 0x80, 0xF0, 0x0F, 0x00, 0xE0, 0x06,
+  0x00, 0x60, 0x0C, 0x01, 0x80, 0x70, 0x00, 0x7F, 0xE0, 0x1C, 0x07, 0x00, 0xC0, 0x38, 0x0E, 0x03,
+  0x80, 0x70, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x0E, 0x01, 0xFF, 0xC0, 0x1C, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xCE, 0x38, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xE0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xC7, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x0C, 0x33, 0x80, 0x70, 0x79, 0x8F, 0x0F, 0x00,
+};
+
+const GFXglyph FreeSans12pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    0 },   // 0x20 ' '
+  {     0,   3,  18,   5,    1,  -18 },   // 0x21 '!'
+  {     7,   6,   6,   9,    2,  -19 },   // 0x22 '"'
+  {    12,  12,  18,  16,    2,  -18 },   // 0x23 '#'
+  {    39,  12,  23,  15,    1,  -21 },   // 0x24 '$'
+  {    74,  17,  18,  20,    1,  -18 },   // 0x25 '%'
+  {   113,  15,  18,  17,    2,  -18 },   // 0x26 '&'
+  {   147,   2,   6,   5,    1,  -19 },   // 0x27 '''
+  {   149,   5,  22,   9,    3,  -20 },   // 0x28 '('
+  {   163,   5,  22,   9,    1,  -20 },   // 0x29 ')'
+  {   177,  10,  10,  15,    3,  -12 },   // 0x2A '*'
+  {   190,  11,  12,  15,    2,  -14 },   // 0x2B '+'
+  {   207,   4,   5,   6,   -1,   -2 },   // 0x2C ','
+  {   210,   5,   1,   7,    1,   -8 },   // 0x2D '-'
+  {   211,   3,   3,   5,    1,   -3 },   // 0x2E '.'
+  {   213,   8,  20,   8,   -1,  -19 },   // 0x2F '/'
+  {   233,  13,  18,  15,    1,  -18 },   // 0x30 '0'
+  {   263,   7,  18,  15,    3,  -18 },   // 0x31 '1'
+  {   279,  12,  18,  15,    2,  -18 },   // 0x32 '2'
+  {   306,  13,  18,  15,    1,  -18 },   // 0x33 '3'
+  {   336,  13,  18,  15,    1,  -18 },   // 0x34 '4'
+  {   366,  12,  18,  15,    1,  -18 },   // 0x35 '5'
+  {   393,  12,  18,  15,    1,  -18 },   // 0x36 '6'
+  {   420,  13,  18,  15,    1,  -18 },   // 0x37 '7'
+  {   450,  13,  18,  15,    1,  -18 },   // 0x38 '8'
+  {   480,  12,  18,  15,    1,  -18 },   // 0x39 '9'
+  {   507,   3,  14,   5,    1,  -14 },   // 0x3A ':'
+  {   513,   5,  17,   5,   -1,  -14 },   // 0x3B ';'
+  {   524,  11,  12,  15,    3,  -13 },   // 0x3C '<'
+  {   541,  11,   6,  15,    2,  -11 },   // 0x3D '='
+  {   550,  11,  12,  15,    2,  -13 },   // 0x3E '>'
+  {   567,  11,  18,  13,    1,  -18 },   // 0x3F '?'
+  {   592,  19,  19,  22,    1,  -17 },   // 0x40 '@'
+  {   638,  15,  18,  17,    1,  -18 },   // 0x41 'A'
+  {   672,  12,  18,  16,    3,  -18 },   // 0x42 'B'
+  {   699,  15,  18,  18,    1,  -18 },   // 0x43 'C'
+  {   733,  15,  18,  19,    3,  -18 },   // 0x44 'D'
+  {   767,  12,  18,  16,    3,  -18 },   // 0x45 'E'
+  {   794,  12,  18,  15,    3,  -18 },   // 0x46 'F'
+  {   821,  16,  18,  19,    1,  -18 },   // 0x47 'G'
+  {   857,  14,  18,  19,    3,  -18 },   // 0x48 'H'
+  {   889,   2,  18,   7,    3,  -18 },   // 0x49 'I'
+  {   894,  11,  18,  14,    1,  -18 },   // 0x4A 'J'
+  {   919,  13,  18,  16,    3,  -18 },   // 0x4B 'K'
+  {   949,  12,  18,  16,    3,  -18 },   // 0x4C 'L'
+  {   976,  18,  18,  23,    3,  -18 },   // 0x4D 'M'
+  {  1017,  14,  18,  19,    3,  -18 },   // 0x4E 'N'
+  {  1049,  17,  18,  19,    1,  -18 },   // 0x4F 'O'
+  {  1088,  12,  18,  16,    3,  -18 },   // 0x50 'P'
+  {  1115,  17,  19,  19,    1,  -18 },   // 0x51 'Q'
+  {  1156,  12,  18,  16,    3,  -18 },   // 0x52 'R'
+  {  1183,  13,  18,  15,    1,  -18 },   // 0x53 'S'
+  {  1213,  15,  18,  16,    1,  -18 },   // 0x54 'T'
+  {  1247,  13,  18,  17,    2,  -18 },   // 0x55 'U'
+  {  1277,  15,  18,  16,    1,  -18 },   // 0x56 'V'
+  {  1311,  23,  18,  25,    1,  -18 },   // 0x57 'W'
+  {  1363,  15,  18,  16,    1,  -18 },   // 0x58 'X'
+  {  1397,  14,  18,  15,    1,  -18 },   // 0x59 'Y'
+  {  1429,  14,  18,  16,    1,  -18 },   // 0x5A 'Z'
+  {  1461,   5,  22,   9,    3,  -20 },   // 0x5B '['
+  {  1475,   8,  20,   8,   -1,  -19 },   // 0x5C 'backslash'
+  {  1495,   5,  22,   8,    1,  -20 },   // 0x5D ']'
+  {  1509,  11,  11,  15,    2,  -17 },   // 0x5E '^'
+  {  1525,  10,   1,  12,    1,    1 },   // 0x5F '_'
+  {  1527,   3,   3,   8,    1,  -18 },   // 0x60 '`'
+  {  1529,  11,  14,  14,    1,  -14 },   // 0x61 'a'
+  {  1549,  13,  19,  16,    2,  -19 },   // 0x62 'b'
+  {  1580,  12,  14,  14,    1,  -14 },   // 0x63 'c'
+  {  1601,  13,  19,  16,    1,  -19 },   // 0x64 'd'
+  {  1632,  12,  14,  15,    1,  -14 },   // 0x65 'e'
+  {  1653,   7,  20,   9,    1,  -20 },   // 0x66 'f'
+  {  1671,  13,  19,  16,    1,  -14 },   // 0x67 'g'
+  {  1702,  12,  19,  16,    2,  -19 },   // 0x68 'h'
+  {  1731,   3,  18,   6,    2,  -18 },   // 0x69 'i'
+  {  1738,   5,  23,   6,    0,  -18 },   // 0x6A 'j'
+  {  1753,  11,  19,  14,    2,  -19 },   // 0x6B 'k'
+  {  1780,   4,  19,   7,    2,  -19 },   // 0x6C 'l'
+  {  1790,  18,  14,  22,    2,  -14 },   // 0x6D 'm'
+  {  1822,  12,  14,  16,    2,  -14 },   // 0x6E 'n'
+  {  1843,  13,  14,  15,    1,  -14 },   // 0x6F 'o'
+  {  1866,  13,  19,  16,    2,  -14 },   // 0x70 'p'
+  {  1897,  13,  19,  16,    1,  -14 },   // 0x71 'q'
+  {  1928,   7,  14,   9,    2,  -14 },   // 0x72 'r'
+  {  1941,  10,  14,  12,    1,  -14 },   // 0x73 's'
+  {  1959,   7,  17,   9,    1,  -17 },   // 0x74 't'
+  {  1974,  12,  14,  16,    2,  -14 },   // 0x75 'u'
+  {  1995,  13,  14,  13,    0,  -14 },   // 0x76 'v'
+  {  2018,  20,  14,  20,    0,  -14 },   // 0x77 'w'
+  {  2053,  12,  14,  13,   -1,  -14 },   // 0x78 'x'
+  {  2074,  12,  19,  13,    1,  -14 },   // 0x79 'y'
+  {  2103,  11,  14,  13,    1,  -14 },   // 0x7A 'z'
+  {  2123,   6,  22,   8,    1,  -20 },   // 0x7B '{'
+  {  2140,   2,  26,   6,    2,  -21 },   // 0x7C '|'
+  {  2147,   6,  22,   8,    1,  -20 },   // 0x7D '}'
+  {  2164,  11,   3,  15,    2,   -9 },   // 0x7E '~'
+};
+
+const GFXfont FreeSans12pt7b PROGMEM = {
+  (uint8_t *)FreeSans12pt7bBitmaps, (GFXglyph *)FreeSans12pt7bGlyphs, 0x20, 0x7E, 32 };
+
+const uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
+  0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0xF7, 0xBC, 0x00, 0x00, 0x1F, 0xFF,
+  0xFE, 0x40, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x01, 0xC6, 0x00, 0xC3, 0x00,
+  0x61, 0x80, 0x31, 0xC0, 0x38, 0xE0, 0x18, 0x60, 0x0C, 0x30, 0x06, 0x18, 0x03, 0x1C, 0x3F, 0xFF,
+  0xDF, 0xFF, 0xE0, 0xC3, 0x00, 0x61, 0x80, 0x71, 0xC0, 0x30, 0xC0, 0x18, 0x60, 0xFF, 0xFF, 0x7F,
+  0xFF, 0x87, 0x18, 0x03, 0x0C, 0x01, 0x86, 0x00, 0xC3, 0x00, 0xE3, 0x80, 0x71, 0x80, 0x30, 0xC0,
+  0x18, 0x60, 0x0C, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x0F, 0xE0, 0x0F, 0xFC,
+  0x07, 0xFF, 0xC3, 0xCC, 0xF1, 0xF3, 0x1E, 0x78, 0xC7, 0x9E, 0x30, 0xF7, 0x8C, 0x3D, 0xE3, 0x00,
+  0x78, 0xC0, 0x0F, 0x30, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0,
+  0x03, 0x3E, 0x00, 0xC7, 0xC0, 0x30, 0xF0, 0x0C, 0x3F, 0xC3, 0x0F, 0xF0, 0xC3, 0xFE, 0x30, 0xF7,
+  0x8C, 0x79, 0xFB, 0x3C, 0x3F, 0xFE, 0x03, 0xFF, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00,
+  0x30, 0x00, 0x3F, 0x80, 0x1E, 0x3F, 0xE0, 0x0E, 0x1C, 0x70, 0x0E, 0x1C, 0x1C, 0x0F, 0x0E, 0x0E,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x83, 0x87, 0x81, 0xC1, 0xC3, 0x80, 0xE0, 0xE3, 0x80, 0x38, 0xE3,
+  0xC0, 0x0F, 0xE1, 0xC0, 0x03, 0xE1, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x70, 0xF8, 0x00, 0x70, 0xFE, 0x00, 0x78, 0xE3, 0x80, 0x38, 0xE0, 0xE0, 0x38, 0x70,
+  0x70, 0x3C, 0x38, 0x38, 0x1C, 0x1C, 0x1C, 0x1C, 0x0E, 0x0E, 0x1E, 0x07, 0x07, 0x0E, 0x01, 0xC7,
+  0x0F, 0x00, 0xFF, 0x87, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xF0, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x78, 0x78,
+  0x03, 0xC3, 0xC0, 0x1E, 0x0F, 0x00, 0xF0, 0x3C, 0x07, 0x80, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x7C,
+  0x0F, 0x07, 0x80, 0x78, 0x78, 0x03, 0xC7, 0x80, 0x1E, 0x3C, 0x00, 0xF1, 0xE0, 0x07, 0x8F, 0x00,
+  0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x0F, 0x00, 0x78, 0x7C, 0x03, 0xC1, 0xFF, 0xFE, 0x03, 0xFF,
+  0xF0, 0x00, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0C, 0x71, 0x8E, 0x30, 0xC7, 0x18, 0x61, 0x8E,
+  0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x18, 0x61, 0x87, 0x0C, 0x30, 0xE1, 0x87,
+  0x0C, 0xC3, 0x86, 0x1C, 0x30, 0xC3, 0x86, 0x18, 0x61, 0x83, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x31, 0x86, 0x18, 0x63, 0x8C, 0x31, 0xC6, 0x38, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+  0xC0, 0x03, 0x03, 0x8C, 0x7F, 0xB7, 0xCF, 0xFC, 0x03, 0x00, 0x1E, 0x00, 0xCC, 0x07, 0x38, 0x38,
+  0x70, 0xC0, 0xC3, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x3C, 0xF3, 0x9E, 0x73, 0xCE, 0x38, 0xFF,
+  0xFF, 0x27, 0xFF, 0xFF, 0x90, 0x00, 0x70, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x0C, 0x01, 0xC0,
+  0x18, 0x01, 0x80, 0x38, 0x03, 0x00, 0x30, 0x07, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x0C, 0x00, 0xC0,
+  0x1C, 0x01, 0x80, 0x18, 0x03, 0x80, 0x30, 0x03, 0x00, 0x70, 0x06, 0x00, 0x60, 0x0E, 0x00, 0xC0,
+  0x00, 0x00, 0x40, 0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0x07, 0x83, 0xC0, 0x78, 0x70, 0x07, 0x1E,
+  0x00, 0xF3, 0xC0, 0x1E, 0x70, 0x03, 0xDE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F,
+  0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
+  0xF7, 0x00, 0x1C, 0xF0, 0x07, 0x9E, 0x00, 0xF3, 0xC0, 0x1C, 0x3C, 0x07, 0x83, 0xC1, 0xE0, 0x3F,
+  0xF8, 0x03, 0xFE, 0x00, 0x04, 0x00, 0x03, 0xE0, 0xFC, 0x7F, 0xBF, 0xFF, 0xDF, 0xE3, 0xF0, 0x7C,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0x07, 0xFC, 0x03, 0xFF,
+  0xC1, 0xC0, 0xF8, 0xE0, 0x1E, 0x78, 0x03, 0xDC, 0x00, 0xF7, 0x00, 0x3D, 0xC0, 0x0F, 0x00, 0x03,
+  0xC0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
+  0xF0, 0x00, 0x78, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0x78, 0x1F,
+  0x0E, 0x01, 0xE3, 0x80, 0x1E, 0x70, 0x03, 0xCE, 0x00, 0x7B, 0xC0, 0x0F, 0x00, 0x01, 0xE0, 0x00,
+  0x78, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x1E, 0x00,
+  0x03, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xF8, 0x00, 0xF7, 0x00, 0x1E, 0xE0, 0x03, 0xDE, 0x00, 0xF1,
+  0xC0, 0x1E, 0x3C, 0x07, 0x83, 0xFF, 0xE0, 0x1F, 0xF0, 0x00, 0x20, 0x00, 0x00, 0x07, 0x80, 0x00,
+  0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0xF7, 0x80, 0x0E, 0x78,
+  0x01, 0xE7, 0x80, 0x3C, 0x78, 0x03, 0x87, 0x80, 0x78, 0x78, 0x0F, 0x07, 0x80, 0xE0, 0x78, 0x1E,
+  0x07, 0x83, 0xC0, 0x78, 0x38, 0x07, 0x87, 0x00, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80,
+  0x1F, 0xFF, 0xC7, 0xFF, 0xF8, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x06, 0x00, 0x01, 0xC7, 0xF0, 0x3B, 0xFF, 0x87, 0xE0, 0xF8, 0xF8,
+  0x0F, 0x9E, 0x00, 0xF3, 0x80, 0x1F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xFF,
+  0x00, 0x1E, 0xE0, 0x03, 0xDC, 0x00, 0xF3, 0xC0, 0x1E, 0x3C, 0x07, 0x83, 0xFF, 0xE0, 0x3F, 0xF0,
+  0x00, 0x20, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xE0, 0x38, 0x1E, 0x0E, 0x01, 0xE3, 0x80, 0x3C, 0x70,
+  0x03, 0x9E, 0x00, 0x7B, 0x80, 0x00, 0x70, 0x00, 0x1E, 0x3F, 0x83, 0xDF, 0xFC, 0x7B, 0x07, 0xCF,
+  0xC0, 0x79, 0xF0, 0x07, 0xBE, 0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
+  0xF8, 0x00, 0xF7, 0x00, 0x1E, 0xF0, 0x03, 0x9E, 0x00, 0xF1, 0xE0, 0x3C, 0x3E, 0x0F, 0x83, 0xFF,
+  0xE0, 0x1F, 0xF0, 0x00, 0x20, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x00, 0x01, 0xE0,
+  0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x70,
+  0x00, 0x1E, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x00, 0x1E,
+  0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xFF, 0x80, 0x7F, 0xFC, 0x1F, 0x07,
+  0xC3, 0xC0, 0x78, 0xF0, 0x07, 0x9E, 0x00, 0xF3, 0xC0, 0x1E, 0x78, 0x03, 0xCF, 0x00, 0x78, 0xF0,
+  0x1E, 0x1E, 0x03, 0xC1, 0xE0, 0xF0, 0x0F, 0xF8, 0x03, 0xFF, 0x81, 0xF0, 0x7C, 0x78, 0x07, 0xCF,
+  0x00, 0x7B, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x1E,
+  0x78, 0x03, 0xC7, 0x80, 0xF0, 0x7F, 0xFC, 0x07, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0xFF,
+  0x80, 0x7F, 0xFC, 0x1E, 0x07, 0xC3, 0xC0, 0x78, 0xF0, 0x07, 0x9C, 0x00, 0xF7, 0x80, 0x0E, 0xF0,
+  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1E, 0xF0, 0x07, 0xDE, 0x00, 0xFB,
+  0xE0, 0x3F, 0x3E, 0x0D, 0xE3, 0xFF, 0xBC, 0x1F, 0xC7, 0x80, 0x00, 0xE0, 0x00, 0x1D, 0xE0, 0x07,
+  0x9C, 0x00, 0xE3, 0xC0, 0x1C, 0x78, 0x07, 0x07, 0x81, 0xC0, 0x7F, 0xF0, 0x07, 0xFC, 0x00, 0x08,
+  0x00, 0x27, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0x90, 0x08,
+  0x7C, 0xF9, 0xF3, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF1,
+  0xC7, 0x8E, 0x1C, 0x78, 0xE1, 0xC0, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
+  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0,
+  0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07,
+  0x00, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x7E, 0x00, 0xF8, 0x00, 0xE0, 0x00,
+  0x80, 0x00, 0x00, 0x80, 0x07, 0xFC, 0x07, 0xFF, 0x87, 0x81, 0xE7, 0x80, 0xF7, 0x80, 0x3F, 0xC0,
+  0x1F, 0xE0, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x01, 0xF0,
+  0x01, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x10, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x01, 0xF0, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x07, 0x00,
+  0x01, 0x80, 0xE0, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0xE3, 0x80, 0x00, 0x06, 0x30, 0x0F, 0x80, 0x67,
+  0x03, 0xFD, 0xC3, 0x60, 0x78, 0xFC, 0x36, 0x0F, 0x07, 0xC3, 0xC1, 0xE0, 0x78, 0x3C, 0x1E, 0x07,
+  0x83, 0xC3, 0xC0, 0x78, 0x3C, 0x3C, 0x07, 0x83, 0xC3, 0xC0, 0x70, 0x3C, 0x3C, 0x07, 0x06, 0xC3,
+  0xC0, 0xF0, 0x6C, 0x3C, 0x1F, 0x0C, 0xE1, 0xE3, 0xF1, 0xC6, 0x0F, 0xF7, 0xF8, 0x60, 0x7C, 0x3E,
+  0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x20, 0x0E, 0x00, 0x0F, 0x00, 0x78,
+  0x07, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01,
+  0xF8, 0x00, 0x07, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x71, 0xC0, 0x00, 0xE3, 0x80,
+  0x01, 0xC7, 0x80, 0x07, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x1C, 0x1E, 0x00, 0x70, 0x1C, 0x00, 0xE0,
+  0x38, 0x03, 0xC0, 0x78, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x3C, 0x01, 0xE0, 0x70, 0x01, 0xC0,
+  0xE0, 0x03, 0x83, 0xC0, 0x07, 0x87, 0x00, 0x07, 0x0E, 0x00, 0x0E, 0x3C, 0x00, 0x1E, 0x70, 0x00,
+  0x1C, 0xE0, 0x00, 0x3B, 0xC0, 0x00, 0x78, 0xFF, 0xF8, 0x1F, 0xFF, 0xC3, 0xC0, 0x3E, 0x78, 0x03,
+  0xCF, 0x00, 0x3D, 0xE0, 0x07, 0xBC, 0x00, 0xF7, 0x80, 0x1E, 0xF0, 0x03, 0xDE, 0x00, 0x73, 0xC0,
+  0x1E, 0x78, 0x07, 0x8F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3C, 0x03, 0xE7, 0x80, 0x1E, 0xF0, 0x03, 0xFE,
+  0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xF7, 0x80, 0x1E,
+  0xF0, 0x0F, 0x9F, 0xFF, 0xE3, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF,
+  0xC0, 0x7C, 0x03, 0xC1, 0xE0, 0x03, 0xC3, 0xC0, 0x03, 0x8F, 0x00, 0x07, 0xBC, 0x00, 0x07, 0x78,
+  0x00, 0x0E, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
+  0x00, 0x77, 0x80, 0x00, 0xEF, 0x00, 0x03, 0xCF, 0x00, 0x07, 0x1F, 0x00, 0x1E, 0x1E, 0x00, 0x38,
+  0x1F, 0x01, 0xE0, 0x1F, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x01, 0x80, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFC, 0x0F, 0x00, 0xF8, 0x3C, 0x00, 0xF8, 0xF0, 0x01, 0xE3, 0xC0, 0x03, 0xCF, 0x00, 0x07, 0xBC,
+  0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07,
+  0xBC, 0x00, 0x1E, 0xF0, 0x00, 0x73, 0xC0, 0x03, 0xCF, 0x00, 0x1E, 0x3C, 0x00, 0xF0, 0xF0, 0x0F,
+  0x83, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF3, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80,
+  0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07,
+  0xFF, 0xFB, 0xFF, 0xFD, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x7C, 0x07, 0xC1, 0xF0, 0x03, 0xC3, 0xC0, 0x07, 0x8F,
+  0x00, 0x07, 0xBC, 0x00, 0x0F, 0x78, 0x00, 0x0E, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x80, 0x00,
+  0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xE0,
+  0x00, 0x1F, 0xC0, 0x00, 0x3B, 0xC0, 0x00, 0xF7, 0x80, 0x01, 0xEF, 0x00, 0x03, 0xCF, 0x00, 0x0F,
+  0x9F, 0x00, 0x1F, 0x1E, 0x00, 0x7E, 0x1F, 0x01, 0xDC, 0x1F, 0xFF, 0x38, 0x0F, 0xFC, 0x70, 0x01,
+  0x80, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8,
+  0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xE0,
+  0x00, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
+  0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0,
+  0x07, 0xF0, 0x07, 0xF0, 0x07, 0x78, 0x0E, 0x7C, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x01, 0x80, 0xF0,
+  0x00, 0x7F, 0x00, 0x0E, 0xF0, 0x01, 0xEF, 0x00, 0x3C, 0xF0, 0x07, 0x8F, 0x00, 0xF0, 0xF0, 0x1E,
+  0x0F, 0x03, 0xC0, 0xF0, 0x78, 0x0F, 0x0F, 0x00, 0xF1, 0xE0, 0x0F, 0x1C, 0x00, 0xF3, 0xC0, 0x0F,
+  0x78, 0x00, 0xFF, 0xC0, 0x0F, 0xDE, 0x00, 0xFD, 0xF0, 0x0F, 0x8F, 0x00, 0xF0, 0x78, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3E, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0x78, 0xF0, 0x03, 0xCF, 0x00, 0x3E,
+  0xF0, 0x01, 0xF0, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x1F,
+  0xFB, 0x80, 0x07, 0x7E, 0xE0, 0x01, 0xDF, 0xBC, 0x00, 0xF7, 0xE7, 0x00, 0x39, 0xF9, 0xC0, 0x0E,
+  0x7E, 0x78, 0x07, 0x9F, 0x8E, 0x01, 0xC7, 0xE3, 0x80, 0x71, 0xF8, 0xF0, 0x1C, 0x7E, 0x1C, 0x0E,
+  0x1F, 0x87, 0x03, 0x87, 0xE1, 0xE0, 0xE1, 0xF8, 0x38, 0x70, 0x7E, 0x0E, 0x1C, 0x1F, 0x83, 0xC7,
+  0x07, 0xE0, 0x73, 0x81, 0xF8, 0x1C, 0xE0, 0x7E, 0x07, 0xB8, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F,
+  0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x01, 0xE0, 0x1C, 0xF8, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F,
+  0xE0, 0x07, 0xEE, 0x00, 0x7E, 0xF0, 0x07, 0xE7, 0x00, 0x7E, 0x78, 0x07, 0xE3, 0x80, 0x7E, 0x3C,
+  0x07, 0xE1, 0xC0, 0x7E, 0x1E, 0x07, 0xE0, 0xE0, 0x7E, 0x0F, 0x07, 0xE0, 0x70, 0x7E, 0x07, 0x87,
+  0xE0, 0x38, 0x7E, 0x03, 0xC7, 0xE0, 0x1C, 0x7E, 0x01, 0xE7, 0xE0, 0x0E, 0x7E, 0x00, 0xF7, 0xE0,
+  0x07, 0x7E, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xF0, 0x00, 0x08, 0x00, 0x00,
+  0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF0, 0xF0,
+  0x00, 0x78, 0xF0, 0x00, 0x1E, 0x78, 0x00, 0x0F, 0x3C, 0x00, 0x07, 0xBC, 0x00, 0x01, 0xFE, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
+  0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xEF, 0x00, 0x01, 0xE7, 0x80, 0x00, 0xF3, 0xC0, 0x00,
+  0x78, 0xF0, 0x00, 0x78, 0x78, 0x00, 0x3C, 0x1E, 0x00, 0x3C, 0x07, 0xC0, 0x7C, 0x01, 0xFF, 0xFC,
+  0x00, 0x3F, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xC0, 0x3E, 0x78, 0x01,
+  0xEF, 0x00, 0x3D, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
+  0x07, 0xF8, 0x01, 0xEF, 0x00, 0x3D, 0xE0, 0x1F, 0x3F, 0xFF, 0xC7, 0xFF, 0xE0, 0xF0, 0x00, 0x1E,
+  0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF,
+  0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF0, 0xF0, 0x00, 0x78, 0xF0, 0x00,
+  0x1E, 0x78, 0x00, 0x0F, 0x3C, 0x00, 0x07, 0xBC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03,
+  0xFC, 0x00, 0x01, 0xEF, 0x00, 0x01, 0xE7, 0x80, 0x00, 0xF3, 0xC0, 0x00, 0x78, 0xF0, 0x00, 0x78,
+  0x78, 0x00, 0x38, 0x1E, 0x00, 0x38, 0x07, 0xC0, 0x7C, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF0,
+  0x00, 0xC0, 0xF0, 0x00, 0x00, 0x18, 0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xC0, 0x3E, 0x78, 0x01, 0xEF,
+  0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x0F,
+  0x78, 0x01, 0xEF, 0x00, 0xF9, 0xFF, 0xFC, 0x3F, 0xFF, 0x87, 0x80, 0x78, 0xF0, 0x07, 0x9E, 0x00,
+  0xF3, 0xC0, 0x0E, 0x78, 0x01, 0xEF, 0x00, 0x3D, 0xE0, 0x07, 0xBC, 0x00, 0xF7, 0x80, 0x1E, 0xF0,
+  0x01, 0xDE, 0x00, 0x3F, 0xC0, 0x07, 0x80, 0x00, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x0E, 0x03,
+  0xC3, 0x80, 0x3C, 0xF0, 0x07, 0x9E, 0x00, 0xF3, 0xC0, 0x0F, 0x78, 0x00, 0x0F, 0x80, 0x01, 0xF8,
+  0x00, 0x1F, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x1F, 0xC0,
+  0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0E,
+  0x78, 0x03, 0xC7, 0x80, 0xF0, 0x7F, 0xFC, 0x03, 0xFF, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00,
+  0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00,
+  0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80,
+  0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x78,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x78, 0x01,
+  0xE7, 0x80, 0x1E, 0x3E, 0x07, 0xC1, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x06, 0x00, 0xF0, 0x00, 0x1E,
+  0xE0, 0x00, 0x3D, 0xE0, 0x00, 0x73, 0xC0, 0x01, 0xE3, 0x80, 0x03, 0xC7, 0x80, 0x07, 0x0F, 0x00,
+  0x1E, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x70, 0x3C, 0x01, 0xE0, 0x38, 0x03, 0x80, 0x70, 0x07, 0x00,
+  0xF0, 0x1E, 0x00, 0xE0, 0x38, 0x01, 0xC0, 0x70, 0x03, 0xC1, 0xE0, 0x03, 0x83, 0x80, 0x07, 0x07,
+  0x00, 0x0F, 0x1E, 0x00, 0x0E, 0x38, 0x00, 0x1C, 0x70, 0x00, 0x3C, 0xE0, 0x00, 0x3B, 0x80, 0x00,
+  0x77, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xFE,
+  0x00, 0x3E, 0x00, 0x3D, 0xC0, 0x07, 0xC0, 0x07, 0x3C, 0x01, 0xFC, 0x00, 0xE7, 0x80, 0x3B, 0x80,
+  0x3C, 0xF0, 0x07, 0x70, 0x07, 0x0E, 0x00, 0xEE, 0x00, 0xE1, 0xC0, 0x39, 0xE0, 0x1C, 0x3C, 0x07,
+  0x1C, 0x07, 0x87, 0x80, 0xE3, 0x80, 0xE0, 0x70, 0x1C, 0x70, 0x1C, 0x0E, 0x07, 0x0F, 0x03, 0x81,
+  0xE0, 0xE0, 0xE0, 0xF0, 0x3C, 0x1C, 0x1C, 0x1C, 0x03, 0x83, 0x83, 0x83, 0x80, 0x70, 0xE0, 0x78,
+  0x70, 0x0F, 0x1C, 0x07, 0x1C, 0x01, 0xE3, 0x80, 0xE3, 0x80, 0x1C, 0x60, 0x1C, 0x70, 0x03, 0x9C,
+  0x03, 0xCE, 0x00, 0x73, 0x80, 0x3B, 0x80, 0x0F, 0x70, 0x07, 0x70, 0x00, 0xEC, 0x00, 0xEE, 0x00,
+  0x1F, 0x80, 0x1F, 0xC0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x07, 0x80, 0x07,
+  0xC0, 0x00, 0x78, 0x00, 0x3C, 0xE0, 0x00, 0xE3, 0xC0, 0x07, 0x87, 0x80, 0x3C, 0x0E, 0x00, 0xE0,
+  0x3C, 0x07, 0x80, 0x70, 0x3C, 0x01, 0xE0, 0xE0, 0x03, 0xC7, 0x00, 0x07, 0x3C, 0x00, 0x1E, 0xE0,
+  0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x80, 0x01, 0xEE,
+  0x00, 0x0F, 0x3C, 0x00, 0x38, 0x78, 0x01, 0xE0, 0xE0, 0x0F, 0x03, 0xC0, 0x38, 0x07, 0x81, 0xE0,
+  0x0F, 0x0F, 0x00, 0x3C, 0x38, 0x00, 0x79, 0xE0, 0x00, 0xFF, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x3D,
+  0xC0, 0x00, 0xE7, 0x80, 0x07, 0x8F, 0x00, 0x1C, 0x3C, 0x00, 0xF0, 0x78, 0x07, 0x81, 0xE0, 0x1E,
+  0x03, 0xC0, 0xF0, 0x07, 0x03, 0x80, 0x1E, 0x1E, 0x00, 0x3C, 0x70, 0x00, 0xF3, 0xC0, 0x01, 0xEE,
+  0x00, 0x07, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07,
+  0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0xF0,
+  0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x01,
+  0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00,
+  0x03, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x3C,
+  0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFC, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC3, 0x0C, 0x3F, 0xFC, 0xC0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x70, 0x03, 0x00, 0x30, 0x03,
+  0x80, 0x18, 0x01, 0x80, 0x1C, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x07, 0x00, 0x30,
+  0x03, 0x00, 0x38, 0x01, 0x80, 0x18, 0x01, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x60, 0x06, 0x00,
+  0x70, 0xFF, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xFF, 0xFC, 0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0,
+  0x07, 0xE0, 0x06, 0x60, 0x06, 0x60, 0x0E, 0x30, 0x0C, 0x30, 0x1C, 0x38, 0x18, 0x18, 0x38, 0x1C,
+  0x38, 0x0C, 0x30, 0x0C, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0xE7, 0x1C,
+  0x63, 0x80, 0x00, 0x80, 0x0F, 0xF8, 0x1F, 0xFE, 0x3C, 0x1E, 0x38, 0x0F, 0x78, 0x0F, 0x78, 0x0F,
+  0x00, 0x0F, 0x00, 0x0F, 0x07, 0xFF, 0x1F, 0xFF, 0x7F, 0x0F, 0x7C, 0x0F, 0xF8, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0x78, 0x3F, 0x7F, 0xFF, 0x3F, 0xEF, 0x02, 0x00, 0xF0, 0x00,
+  0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80,
+  0x00, 0xF0, 0x00, 0x1E, 0x7F, 0xC3, 0xDF, 0xFC, 0x7F, 0x07, 0xCF, 0xC0, 0x7D, 0xF0, 0x07, 0xBE,
+  0x00, 0xF7, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F,
+  0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x1E, 0xF8, 0x03, 0xDF, 0x80, 0xF3, 0xF8, 0x3E, 0x7B, 0xFF,
+  0x0F, 0x7F, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x40, 0x01, 0xFF, 0x00, 0xFF, 0xF0, 0x78, 0x1E, 0x3C,
+  0x03, 0x9E, 0x00, 0xF7, 0x80, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x07, 0x78, 0x03, 0xDF, 0x00, 0xE3, 0xE0,
+  0x70, 0x7F, 0xF8, 0x07, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x7F,
+  0xCF, 0x0F, 0xFE, 0xF1, 0xE0, 0x7F, 0x3C, 0x03, 0xF7, 0x80, 0x1F, 0x78, 0x01, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xF7, 0x80, 0x1F, 0x78, 0x01, 0xF3, 0xC0, 0x3F, 0x3E, 0x07, 0xF1, 0xFF, 0xEF, 0x07, 0xFC,
+  0xF0, 0x04, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x81, 0xC0, 0x70, 0xE0, 0x0E, 0x78, 0x03, 0x9C, 0x00,
+  0xFF, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
+  0x3C, 0x00, 0xF7, 0x80, 0x39, 0xE0, 0x0E, 0x7C, 0x07, 0x8F, 0x03, 0xC1, 0xFF, 0xE0, 0x1F, 0xE0,
+  0x00, 0x40, 0x00, 0x07, 0xC3, 0xF1, 0xFC, 0xF8, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x3F, 0xFF,
+  0xFC, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x00, 0x07, 0xFC, 0xE1, 0xFF, 0xDC, 0x78, 0x1F, 0x9E,
+  0x01, 0xF7, 0x80, 0x1E, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F,
+  0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xDE, 0x00, 0x7B, 0xC0, 0x0F, 0x3C, 0x03,
+  0xE7, 0xC0, 0xFC, 0x7F, 0xFB, 0x83, 0xFE, 0x70, 0x04, 0x0E, 0xE0, 0x01, 0xDE, 0x00, 0x3B, 0xC0,
+  0x0E, 0x78, 0x01, 0xC7, 0x80, 0x70, 0x7F, 0xFC, 0x07, 0xFF, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x78,
+  0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
+  0x79, 0xFE, 0x3D, 0xFF, 0x9F, 0x81, 0xEF, 0xC0, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0,
+  0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F,
+  0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x78, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x3C, 0x78, 0x00, 0x00, 0x00, 0x0F,
+  0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C,
+  0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x3F, 0xFB, 0xF1, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x03, 0xFC, 0x03,
+  0xDE, 0x03, 0xCF, 0x03, 0xC7, 0x83, 0xC3, 0xC3, 0xC1, 0xE3, 0xC0, 0xF3, 0xC0, 0x7B, 0xC0, 0x3D,
+  0xC0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xCF, 0x03, 0xC3, 0xC1, 0xE1, 0xF0, 0xF0, 0x7C, 0x78, 0x1F,
+  0x3C, 0x07, 0x9E, 0x01, 0xEF, 0x00, 0x78, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38,
+  0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8F, 0x7F, 0x7C, 0xF7, 0xF8, 0xFF,
+  0x3D, 0xFF, 0x7F, 0xEF, 0xC3, 0xD8, 0x7B, 0xE0, 0x7C, 0x0F, 0xF8, 0x1F, 0x03, 0xFC, 0x07, 0x80,
+  0xFF, 0x01, 0xE0, 0x3F, 0xC0, 0x78, 0x0F, 0xF0, 0x1E, 0x03, 0xFC, 0x07, 0x80, 0xFF, 0x01, 0xE0,
+  0x3F, 0xC0, 0x78, 0x0F, 0xF0, 0x1E, 0x03, 0xFC, 0x07, 0x80, 0xFF, 0x01, 0xE0, 0x3F, 0xC0, 0x78,
+  0x0F, 0xF0, 0x1E, 0x03, 0xFC, 0x07, 0x80, 0xFF, 0x01, 0xE0, 0x3F, 0xC0, 0x78, 0x0F, 0xF3, 0xFC,
+  0x7B, 0xFF, 0x3F, 0x03, 0xDF, 0x81, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0,
+  0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F,
+  0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xF0, 0x1E, 0x07,
+  0x83, 0xC0, 0x3C, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x78, 0x01, 0xE7, 0x80,
+  0x1E, 0x3C, 0x03, 0xC1, 0xE0, 0x78, 0x0F, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x60, 0x00, 0xF3, 0xFE,
+  0x1E, 0xFF, 0xE3, 0xF8, 0x3E, 0x7E, 0x03, 0xEF, 0x80, 0x3D, 0xF0, 0x07, 0xBC, 0x00, 0x7F, 0x80,
+  0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC,
+  0x00, 0xF7, 0xC0, 0x1E, 0xFC, 0x07, 0x9F, 0xC1, 0xF3, 0xDF, 0xF8, 0x7B, 0xFE, 0x0F, 0x04, 0x01,
+  0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00,
+  0x00, 0x07, 0xFC, 0xF0, 0xFF, 0xEF, 0x1E, 0x07, 0xF3, 0xC0, 0x3F, 0x78, 0x01, 0xF7, 0x80, 0x1F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0x78, 0x01, 0xF7, 0x80, 0x1F, 0x3C, 0x03, 0xF3, 0xE0, 0x7F, 0x1F, 0xFE,
+  0xF0, 0x7F, 0xCF, 0x00, 0x40, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF7, 0xFD, 0xFF, 0xC3, 0xE0, 0xF8, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0x0F, 0xF8, 0x1F, 0xFC, 0x3C, 0x3E, 0x78, 0x1E, 0x78, 0x1F, 0x78, 0x00, 0x7C, 0x00, 0x7E, 0x00,
+  0x3F, 0xE0, 0x1F, 0xF8, 0x0F, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0x78, 0x0F, 0x7C, 0x1E, 0x3F, 0xFC, 0x0F, 0xF8, 0x00, 0x80, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
+  0x3F, 0xFF, 0xFC, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE0, 0xFF, 0x1F, 0xC0, 0xC0, 0xF0, 0x07, 0xF8, 0x03, 0xFC,
+  0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03,
+  0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xE0, 0x1F, 0xF8, 0x0F, 0xBC,
+  0x0F, 0xCF, 0xFD, 0xE3, 0xFC, 0xF0, 0x10, 0x00, 0xF0, 0x00, 0xEE, 0x00, 0x3D, 0xE0, 0x07, 0x3C,
+  0x00, 0xE3, 0x80, 0x3C, 0x78, 0x07, 0x07, 0x00, 0xE0, 0xE0, 0x38, 0x1E, 0x07, 0x01, 0xC0, 0xE0,
+  0x38, 0x38, 0x07, 0x87, 0x00, 0x70, 0xE0, 0x0E, 0x38, 0x00, 0xE7, 0x00, 0x1C, 0xC0, 0x03, 0xB8,
+  0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0xF0, 0x07, 0x80, 0x3B, 0x80, 0x7C, 0x01, 0xDC,
+  0x03, 0xF0, 0x1E, 0xF0, 0x1F, 0x80, 0xF7, 0x80, 0xDC, 0x07, 0x1C, 0x0E, 0xE0, 0x38, 0xF0, 0x73,
+  0x83, 0xC7, 0x83, 0x9C, 0x1C, 0x1C, 0x18, 0xE0, 0xE0, 0xE1, 0xC7, 0x0F, 0x07, 0x8E, 0x1C, 0x70,
+  0x1C, 0x70, 0xE3, 0x80, 0xE3, 0x07, 0x1C, 0x07, 0xB8, 0x1D, 0xC0, 0x1D, 0xC0, 0xEE, 0x00, 0xEE,
+  0x07, 0x70, 0x07, 0x60, 0x3B, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0xF8, 0x07, 0xC0, 0x07, 0x80, 0x3C,
+  0x00, 0xF0, 0x03, 0x9E, 0x01, 0xE3, 0xC0, 0xF0, 0xF0, 0x38, 0x1E, 0x1E, 0x03, 0xCF, 0x00, 0x73,
+  0x80, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x07, 0x78, 0x03, 0xCE,
+  0x00, 0xE3, 0xC0, 0x70, 0x78, 0x3C, 0x0E, 0x0E, 0x03, 0xC7, 0x80, 0x7B, 0xC0, 0x0F, 0xF0, 0x01,
+  0xFE, 0x00, 0x39, 0xC0, 0x07, 0x3C, 0x01, 0xE7, 0x80, 0x38, 0x70, 0x07, 0x0F, 0x01, 0xE0, 0xE0,
+  0x38, 0x1C, 0x07, 0x03, 0xC1, 0xC0, 0x38, 0x38, 0x07, 0x07, 0x00, 0xF1, 0xC0, 0x0E, 0x38, 0x01,
+  0xC7, 0x00, 0x3D, 0xC0, 0x03, 0xB8, 0x00, 0x77, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0xFC, 0x00, 0x1F, 0x00,
+  0x01, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00,
+  0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x1E,
+  0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xC0, 0xF0, 0x38, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0x7C, 0x07, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x18,
+  0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x70, 0x1F, 0x03, 0x87, 0xC7, 0x03, 0x01, 0x80, 0xC0, 0x60,
+  0x30, 0x18, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x71, 0xF0, 0xF0, 0x00, 0x3C, 0x03, 0x7F, 0x03,
+  0xE3, 0xC7, 0xC0, 0xFE, 0xC0, 0x3C,
+};
+
+const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   8,    0,    0 },   // 0x20 ' '
+  {     0,   5,  28,   9,    2,  -27 },   // 0x21 '!'
+  {    18,   8,   9,  13,    3,  -28 },   // 0x22 '"'
+  {    27,  17,  27,  23,    3,  -27 },   // 0x23 '#'
+  {    85,  18,  34,  22,    2,  -30 },   // 0x24 '$'
+  {   162,  25,  28,  29,    2,  -27 },   // 0x25 '%'
+  {   250,  21,  28,  24,    2,  -27 },   // 0x26 '&'
+  {   324,   3,   9,   7,    2,  -28 },   // 0x27 '''
+  {   328,   6,  33,  12,    4,  -30 },   // 0x28 '('
+  {   353,   6,  33,  12,    2,  -30 },   // 0x29 ')'
+  {   378,  14,  15,  22,    4,  -18 },   // 0x2A '*'
+  {   405,  16,  18,  22,    3,  -21 },   // 0x2B '+'
+  {   441,   6,   8,   8,   -2,   -3 },   // 0x2C ','
+  {   447,   8,   2,  10,    1,  -12 },   // 0x2D '-'
+  {   449,   5,   6,   8,    1,   -5 },   // 0x2E '.'
+  {   453,  12,  29,  12,   -1,  -28 },   // 0x2F '/'
+  {   497,  19,  29,  22,    2,  -28 },   // 0x30 '0'
+  {   566,  11,  27,  22,    5,  -27 },   // 0x31 '1'
+  {   604,  18,  27,  22,    2,  -27 },   // 0x32 '2'
+  {   665,  19,  28,  22,    1,  -27 },   // 0x33 '3'
+  {   732,  20,  27,  22,    1,  -27 },   // 0x34 '4'
+  {   800,  19,  28,  22,    2,  -27 },   // 0x35 '5'
+  {   867,  19,  28,  22,    2,  -27 },   // 0x36 '6'
+  {   934,  19,  27,  22,    2,  -27 },   // 0x37 '7'
+  {   999,  19,  29,  22,    2,  -28 },   // 0x38 '8'
+  {  1068,  19,  29,  22,    2,  -28 },   // 0x39 '9'
+  {  1137,   5,  22,   8,    1,  -21 },   // 0x3A ':'
+  {  1151,   7,  26,   8,   -1,  -21 },   // 0x3B ';'
+  {  1174,  16,  18,  22,    4,  -20 },   // 0x3C '<'
+  {  1210,  16,  10,  22,    3,  -17 },   // 0x3D '='
+  {  1230,  16,  18,  23,    3,  -20 },   // 0x3E '>'
+  {  1266,  17,  29,  19,    1,  -28 },   // 0x3F '?'
+  {  1328,  28,  30,  32,    2,  -26 },   // 0x40 '@'
+  {  1433,  23,  27,  24,    1,  -27 },   // 0x41 'A'
+  {  1511,  19,  27,  24,    4,  -27 },   // 0x42 'B'
+  {  1576,  23,  29,  27,    2,  -28 },   // 0x43 'C'
+  {  1660,  22,  27,  27,    4,  -27 },   // 0x44 'D'
+  {  1735,  18,  27,  23,    4,  -27 },   // 0x45 'E'
+  {  1796,  17,  27,  22,    4,  -27 },   // 0x46 'F'
+  {  1854,  23,  29,  27,    2,  -28 },   // 0x47 'G'
+  {  1938,  21,  27,  28,    4,  -27 },   // 0x48 'H'
+  {  2009,   4,  27,  11,    4,  -27 },   // 0x49 'I'
+  {  2023,  16,  28,  21,    2,  -27 },   // 0x4A 'J'
+  {  2079,  20,  27,  24,    4,  -27 },   // 0x4B 'K'
+  {  2147,  18,  27,  22,    4,  -27 },   // 0x4C 'L'
+  {  2208,  26,  27,  34,    4,  -27 },   // 0x4D 'M'
+  {  2296,  20,  27,  28,    4,  -27 },   // 0x4E 'N'
+  {  2364,  25,  29,  28,    2,  -28 },   // 0x4F 'O'
+  {  2455,  19,  27,  23,    4,  -27 },   // 0x50 'P'
+  {  2520,  25,  30,  28,    2,  -28 },   // 0x51 'Q'
+  {  2614,  19,  27,  24,    4,  -27 },   // 0x52 'R'
+  {  2679,  19,  29,  22,    2,  -28 },   // 0x53 'S'
+  {  2748,  22,  27,  23,    1,  -27 },   // 0x54 'T'
+  {  2823,  20,  28,  27,    4,  -27 },   // 0x55 'U'
+  {  2893,  23,  27,  24,    1,  -27 },   // 0x56 'V'
+  {  2971,  35,  27,  36,    1,  -27 },   // 0x57 'W'
+  {  3090,  22,  27,  24,    1,  -27 },   // 0x58 'X'
+  {  3165,  22,  27,  22,    1,  -27 },   // 0x59 'Y'
+  {  3240,  20,  27,  23,    2,  -27 },   // 0x5A 'Z'
+  {  3308,   6,  33,  12,    4,  -30 },   // 0x5B '['
+  {  3333,  12,  29,  12,   -1,  -28 },   // 0x5C 'backslash'
+  {  3377,   6,  33,  11,    1,  -30 },   // 0x5D ']'
+  {  3402,  16,  16,  22,    3,  -24 },   // 0x5E '^'
+  {  3434,  15,   2,  19,    2,    1 },   // 0x5F '_'
+  {  3438,   5,   5,  11,    2,  -27 },   // 0x60 '`'
+  {  3442,  16,  22,  20,    1,  -21 },   // 0x61 'a'
+  {  3486,  19,  30,  23,    3,  -29 },   // 0x62 'b'
+  {  3558,  18,  22,  20,    1,  -21 },   // 0x63 'c'
+  {  3608,  20,  30,  24,    1,  -29 },   // 0x64 'd'
+  {  3683,  18,  21,  21,    1,  -20 },   // 0x65 'e'
+  {  3731,  10,  29,  12,    1,  -29 },   // 0x66 'f'
+  {  3768,  19,  29,  24,    1,  -20 },   // 0x67 'g'
+  {  3837,  17,  29,  23,    3,  -29 },   // 0x68 'h'
+  {  3899,   4,  27,   9,    2,  -27 },   // 0x69 'i'
+  {  3913,   7,  36,   9,   -1,  -27 },   // 0x6A 'j'
+  {  3945,  17,  29,  20,    3,  -29 },   // 0x6B 'k'
+  {  4007,   6,  29,   9,    3,  -29 },   // 0x6C 'l'
+  {  4029,  26,  20,  32,    3,  -20 },   // 0x6D 'm'
+  {  4094,  17,  20,  23,    3,  -20 },   // 0x6E 'n'
+  {  4137,  20,  21,  22,    1,  -20 },   // 0x6F 'o'
+  {  4190,  19,  28,  23,    3,  -20 },   // 0x70 'p'
+  {  4257,  20,  28,  24,    1,  -20 },   // 0x71 'q'
+  {  4327,  10,  20,  13,    3,  -20 },   // 0x72 'r'
+  {  4352,  16,  21,  18,    1,  -20 },   // 0x73 's'
+  {  4394,  10,  26,  13,    1,  -25 },   // 0x74 't'
+  {  4427,  17,  21,  23,    3,  -20 },   // 0x75 'u'
+  {  4472,  19,  20,  20,    0,  -20 },   // 0x76 'v'
+  {  4520,  29,  20,  30,    0,  -20 },   // 0x77 'w'
+  {  4593,  18,  20,  18,   -1,  -20 },   // 0x78 'x'
+  {  4638,  19,  29,  20,   -1,  -20 },   // 0x79 'y'
+  {  4707,  16,  20,  18,    1,  -20 },   // 0x7A 'z'
+  {  4747,   8,  33,  11,    2,  -30 },   // 0x7B '{'
+  {  4780,   2,  39,  10,    4,  -31 },   // 0x7C '|'
+  {  4790,   9,  33,  12,    1,  -30 },   // 0x7D '}'
+  {  4828,  16,   5,  22,    3,  -14 },   // 0x7E '~'
+};
+
+const GFXfont FreeSans18pt7b PROGMEM = {
+  (uint8_t *)FreeSans18pt7bBitmaps, (GFXglyph *)FreeSans18pt7bGlyphs, 0x20, 0x7E, 46 };
+
+const uint8_t FreeSans24pt7bBitmaps[] PROGMEM = {
+  0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9,
+  0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x3E, 0xFF, 0xFF, 0xFB, 0xE1,
+  0x00, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7,
+  0xF8, 0xFF, 0x1E, 0x00, 0x38, 0x70, 0x00, 0x70, 0xE0, 0x01, 0xC1, 0xC0, 0x03, 0x83, 0x80, 0x07,
+  0x06, 0x00, 0x0E, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x30, 0x70, 0x00, 0xE0, 0xE0, 0x01, 0xC1, 0xC0,
+  0x03, 0x87, 0x00, 0x07, 0x0E, 0x03, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x80, 0xE1,
+  0xC0, 0x01, 0xC3, 0x80, 0x03, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x1C, 0x18, 0x00, 0x38, 0x70, 0x00,
+  0x70, 0xE0, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0x0E, 0x1C, 0x00, 0x1C, 0x38,
+  0x00, 0x70, 0x70, 0x00, 0xE0, 0xE0, 0x01, 0xC3, 0x80, 0x03, 0x87, 0x00, 0x07, 0x0E, 0x00, 0x1C,
+  0x1C, 0x00, 0x38, 0x38, 0x00, 0x70, 0xE0, 0x00, 0xE1, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0,
+  0x1F, 0xFF, 0xF8, 0x1F, 0x1C, 0xFC, 0x3E, 0x1C, 0x7C, 0x3E, 0x1C, 0x3E, 0x7C, 0x1C, 0x3E, 0x7C,
+  0x1C, 0x3E, 0x7C, 0x1C, 0x1F, 0x7C, 0x1C, 0x00, 0x7C, 0x1C, 0x00, 0x7E, 0x1C, 0x00, 0x3F, 0x1C,
+  0x00, 0x3F, 0x9C, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0xF0,
+  0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1C, 0xFE, 0x00, 0x1C, 0x7E, 0x00, 0x1C, 0x3F, 0x00,
+  0x1C, 0x3F, 0x00, 0x1C, 0x1F, 0xF8, 0x1C, 0x1F, 0xF8, 0x1C, 0x1F, 0xF8, 0x1C, 0x1F, 0xFC, 0x1C,
+  0x1F, 0x7C, 0x1C, 0x3E, 0x7E, 0x1C, 0x3E, 0x3F, 0x9C, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00,
+  0x1C, 0x00, 0x0F, 0xF0, 0x00, 0x1E, 0x07, 0xFF, 0x80, 0x07, 0x80, 0xFF, 0xF0, 0x01, 0xF0, 0x3E,
+  0x1F, 0x00, 0x3C, 0x0F, 0x83, 0xF0, 0x0F, 0x01, 0xF0, 0x3E, 0x03, 0xE0, 0x3E, 0x07, 0xC0, 0x78,
+  0x07, 0xC0, 0xF8, 0x1F, 0x00, 0xF8, 0x1F, 0x07, 0xC0, 0x1F, 0x03, 0xE0, 0xF0, 0x03, 0xE0, 0x7C,
+  0x3E, 0x00, 0x3E, 0x1F, 0x07, 0x80, 0x07, 0xE7, 0xE1, 0xE0, 0x00, 0x7F, 0xF8, 0x7C, 0x00, 0x07,
+  0xFE, 0x0F, 0x00, 0x00, 0x3F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x0F,
+  0x07, 0xFE, 0x00, 0x03, 0xE1, 0xFF, 0xE0, 0x00, 0x78, 0x7E, 0x7E, 0x00, 0x1F, 0x0F, 0x87, 0xC0,
+  0x07, 0xC3, 0xE0, 0x7C, 0x00, 0xF0, 0x7C, 0x0F, 0x80, 0x3E, 0x0F, 0x81, 0xF0, 0x07, 0x81, 0xF0,
+  0x3E, 0x01, 0xE0, 0x3E, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xF8, 0x0F, 0x00, 0xFC, 0x3E, 0x03, 0xC0,
+  0x0F, 0x87, 0xC0, 0xF8, 0x01, 0xFF, 0xF0, 0x1E, 0x00, 0x1F, 0xFE, 0x07, 0x80, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x1F,
+  0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x07,
+  0xC0, 0x01, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x03, 0xE0, 0x03, 0xE0, 0x0F, 0xC0,
+  0x1F, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF1, 0xFE, 0x01, 0xF0,
+  0x1F, 0x80, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x0F, 0x80, 0x03, 0xE0, 0x78, 0x00, 0x1F, 0x07, 0xC0,
+  0x00, 0xF8, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x01, 0xF0, 0x7C, 0x00, 0x0F,
+  0x83, 0xF0, 0x00, 0x7C, 0x0F, 0x80, 0x03, 0xE0, 0x7E, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0xF8, 0x07,
+  0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0x80, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0x83, 0x81, 0xC1, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x1C,
+  0x0E, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x0E, 0x07, 0x03, 0x81, 0xE0,
+  0x70, 0x38, 0x0E, 0x07, 0x01, 0xC0, 0xE0, 0x38, 0xE0, 0x78, 0x1C, 0x0F, 0x03, 0x81, 0xE0, 0x70,
+  0x38, 0x0E, 0x07, 0x03, 0x80, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x83, 0x81,
+  0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80,
+  0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x01, 0x01, 0xC0, 0x4F, 0x0E, 0x1E,
+  0xFE, 0x73, 0xF9, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x01, 0xF0, 0x00, 0x1D, 0xC0, 0x00, 0xEE, 0x00,
+  0x0E, 0x38, 0x00, 0xE0, 0xE0, 0x0F, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0x00, 0x70, 0x18, 0x03, 0x00,
+  0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0,
+  0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x3F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01,
+  0xC0, 0x00, 0x07, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00,
+  0x1C, 0x00, 0x0F, 0x87, 0xC7, 0xC3, 0xE3, 0xE1, 0xF0, 0xF0, 0xF8, 0x78, 0x3C, 0x3E, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0x10, 0xFB, 0xFF, 0xFF, 0xEF, 0x84, 0x00, 0x00, 0x07, 0x00, 0x0F, 0x00,
+  0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x01,
+  0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x0E,
+  0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0x70,
+  0x00, 0x70, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00,
+  0x7F, 0xFF, 0x80, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0x3E, 0x0F, 0xC0, 0x0F, 0xC3, 0xE0, 0x01, 0xF0,
+  0xF8, 0x00, 0x7C, 0x7C, 0x00, 0x0F, 0x9F, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x1F,
+  0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07,
+  0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0x9F, 0x00, 0x03, 0xE7, 0xC0, 0x00,
+  0xF9, 0xF0, 0x00, 0x3E, 0x7E, 0x00, 0x0F, 0x0F, 0x80, 0x07, 0xC3, 0xF0, 0x03, 0xF0, 0x7C, 0x00,
+  0xF8, 0x0F, 0x80, 0x7C, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x0F, 0xF8, 0x7F, 0xF3, 0xFF, 0xEF, 0xF7, 0xFF, 0x8F, 0xFC,
+  0x1F, 0xF0, 0x3F, 0x80, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F,
+  0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00,
+  0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
+  0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x0F,
+  0x80, 0xFC, 0x1F, 0x00, 0x7E, 0x3E, 0x00, 0x3E, 0x3C, 0x00, 0x3F, 0x3C, 0x00, 0x1F, 0x7C, 0x00,
+  0x1F, 0x78, 0x00, 0x1F, 0x78, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00,
+  0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
+  0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x03, 0xF0, 0x1F, 0xC1, 0xF0,
+  0x07, 0xE1, 0xF0, 0x01, 0xF8, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x3C, 0x00,
+  0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+  0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
+  0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xF9,
+  0xF0, 0x00, 0x7C, 0xFC, 0x00, 0x7C, 0x3F, 0x00, 0x7C, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00,
+  0x7F, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF8,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3D,
+  0xF0, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x07,
+  0xC3, 0xE0, 0x01, 0xF0, 0x7C, 0x00, 0x3C, 0x0F, 0x80, 0x0F, 0x81, 0xF0, 0x03, 0xE0, 0x3E, 0x00,
+  0xF8, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x1F, 0x01, 0xF0, 0x03, 0xE0, 0x3E, 0x00, 0x7C,
+  0x0F, 0x80, 0x0F, 0x83, 0xE0, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00,
+  0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC3, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x01,
+  0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC3, 0xFC, 0x01, 0xE7, 0xFF, 0xC0, 0xF7,
+  0xFF, 0xF0, 0x7F, 0x81, 0xFC, 0x3F, 0x80, 0x3F, 0x1F, 0x80, 0x0F, 0xCF, 0x80, 0x03, 0xE7, 0x80,
+  0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xF3, 0xE0, 0x00, 0xF9, 0xF0, 0x00,
+  0xFC, 0xFC, 0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF8,
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF,
+  0x80, 0x78, 0x07, 0xE0, 0x78, 0x01, 0xF0, 0x78, 0x00, 0xFC, 0x3C, 0x00, 0x3E, 0x3C, 0x00, 0x1F,
+  0x1E, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC1, 0xFC, 0x03,
+  0xE3, 0xFF, 0xC1, 0xF3, 0xFF, 0xF0, 0xFB, 0xC1, 0xFC, 0x7F, 0x80, 0x3F, 0x3F, 0x80, 0x0F, 0xDF,
+  0x80, 0x03, 0xEF, 0xC0, 0x01, 0xF7, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
+  0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xEF, 0x00, 0x01, 0xF7, 0x80, 0x00, 0xFB, 0xE0,
+  0x00, 0xF8, 0xF0, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x1F, 0x00, 0x7E, 0x0F, 0xC0, 0x7E, 0x03, 0xFF,
+  0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x1E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x80,
+  0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+  0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x7E, 0x01, 0xF8, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x07, 0xC7,
+  0xC0, 0x01, 0xF9, 0xF0, 0x00, 0x3E, 0x7C, 0x00, 0x0F, 0x9F, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0xF9,
+  0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x07, 0xC1, 0xF0, 0x03, 0xE0, 0x3F, 0x03, 0xF0,
+  0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0x03, 0xF8, 0x3F, 0x00, 0x3F,
+  0x1F, 0x80, 0x07, 0xE7, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01,
+  0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xE7, 0xC0, 0x00,
+  0xF9, 0xF8, 0x00, 0x7C, 0x3F, 0x00, 0x3F, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x07, 0xFF,
+  0x80, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01, 0xFF,
+  0xFF, 0x01, 0xF8, 0x0F, 0xC1, 0xF8, 0x03, 0xE0, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0x3C, 0x7C, 0x00,
+  0x1F, 0x7C, 0x00, 0x07, 0xBE, 0x00, 0x03, 0xDF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00,
+  0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xBE, 0x00, 0x0F, 0xDF, 0x00, 0x07,
+  0xEF, 0xC0, 0x07, 0xF3, 0xF0, 0x07, 0xF8, 0xFE, 0x0F, 0x7C, 0x3F, 0xFF, 0x3E, 0x0F, 0xFF, 0x1F,
+  0x00, 0xFE, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF, 0x80, 0x01, 0xE3,
+  0xE0, 0x00, 0xF1, 0xF0, 0x00, 0xF0, 0xFC, 0x00, 0x78, 0x3E, 0x00, 0x78, 0x1F, 0x80, 0x78, 0x07,
+  0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x10, 0xFB, 0xFF, 0xFF,
+  0xEF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x3E, 0xFF, 0xFF, 0xFB, 0xE1, 0x00, 0x02, 0x03, 0xE1, 0xFC, 0x7F, 0x1F, 0xC3, 0xE0, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xF8, 0x7C, 0x1F, 0x0F, 0x83, 0xE0, 0xF8, 0x7C, 0x1F, 0x07, 0x83, 0xE0, 0xF0, 0x3C,
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x07, 0xC0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F,
+  0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xE0, 0x00,
+  0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8,
+  0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x80, 0x00, 0x07, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F,
+  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00,
+  0x01, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+  0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x03, 0xC0, 0x00, 0x18, 0x00,
+  0x00, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xC0, 0x7C, 0x7E, 0x00, 0xF9, 0xF0,
+  0x03, 0xE7, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xF0, 0x00, 0x07, 0xC0,
+  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x03, 0xE0,
+  0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
+  0xC0, 0x00, 0x3E, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
+  0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x07,
+  0xC0, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x38, 0x0F, 0x00, 0x00,
+  0x00, 0xF0, 0x38, 0x00, 0x00, 0x01, 0xC1, 0xE0, 0x07, 0xE0, 0x03, 0x8F, 0x00, 0x7F, 0xEF, 0x0E,
+  0x38, 0x07, 0xFF, 0xBC, 0x38, 0xE0, 0x3F, 0x07, 0xF0, 0x77, 0x00, 0xF8, 0x0F, 0x81, 0xDC, 0x07,
+  0xC0, 0x3E, 0x07, 0x70, 0x3E, 0x00, 0xF8, 0x1F, 0x80, 0xF8, 0x03, 0xE0, 0x7E, 0x03, 0xE0, 0x0F,
+  0x01, 0xF8, 0x1F, 0x00, 0x3C, 0x07, 0xE0, 0x7C, 0x00, 0xF0, 0x1F, 0x81, 0xF0, 0x07, 0xC0, 0x7E,
+  0x07, 0xC0, 0x1E, 0x03, 0xB8, 0x1F, 0x00, 0x78, 0x0E, 0xE0, 0x7C, 0x03, 0xE0, 0x3B, 0x81, 0xF0,
+  0x0F, 0x81, 0xCF, 0x07, 0xE0, 0x7E, 0x0F, 0x1C, 0x0F, 0xC3, 0x78, 0x78, 0x70, 0x1F, 0xFD, 0xFF,
+  0xC1, 0xE0, 0x3F, 0xE7, 0xFE, 0x03, 0x80, 0x7E, 0x07, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x08, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00,
+  0x0F, 0xC0, 0x01, 0xFC, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x07, 0xDE, 0x00, 0x00, 0x0F, 0x3E, 0x00,
+  0x00, 0x1E, 0x3C, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x01, 0xE1, 0xF0, 0x00,
+  0x07, 0xC1, 0xE0, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x7C, 0x07, 0x80, 0x00,
+  0xF0, 0x0F, 0x80, 0x03, 0xE0, 0x1F, 0x00, 0x07, 0xC0, 0x1E, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x3E,
+  0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0x80,
+  0x01, 0xF0, 0x0F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x07, 0xC0, 0xF0, 0x00,
+  0x0F, 0x83, 0xE0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
+  0x7C, 0x78, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x01,
+  0xF0, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0x00, 0x3F, 0x8F, 0x80, 0x07,
+  0xE7, 0xC0, 0x01, 0xF3, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x0F,
+  0xBE, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF, 0x80, 0x03, 0xE7, 0xC0, 0x01, 0xF3, 0xE0, 0x01, 0xF1,
+  0xF0, 0x03, 0xF0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x1F, 0xCF,
+  0x80, 0x03, 0xF7, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC,
+  0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xE0,
+  0x00, 0x7D, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0xFC, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFF,
+  0xFF, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xC0, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x1F, 0x00,
+  0x00, 0x7C, 0x1F, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1E, 0x7C, 0x00,
+  0x00, 0x1E, 0x7C, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x1E, 0x7E, 0x00,
+  0x00, 0x3E, 0x3E, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x7C, 0x0F, 0x80,
+  0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
+  0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
+  0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x3F, 0xC0, 0xF8, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x3F,
+  0x0F, 0x80, 0x00, 0x7E, 0x3E, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x07, 0xEF,
+  0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x1F, 0x3E,
+  0x00, 0x00, 0x7C, 0xF8, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0xFC, 0x3E, 0x00,
+  0x07, 0xE0, 0xF8, 0x00, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3F, 0xFC,
+  0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x3F,
+  0x03, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C,
+  0xF8, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x01, 0xEF, 0x80, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+  0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x7D, 0xF0, 0x00,
+  0x00, 0xFB, 0xF0, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x0F, 0xC7, 0xC0, 0x00,
+  0x3F, 0x87, 0xC0, 0x00, 0x7F, 0x0F, 0xC0, 0x03, 0xDE, 0x0F, 0xE0, 0x0F, 0xBC, 0x0F, 0xFF, 0xFE,
+  0x78, 0x07, 0xFF, 0xF8, 0xF0, 0x03, 0xFF, 0xC1, 0xE0, 0x00, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC,
+  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03,
+  0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xF0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
+  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
+  0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01,
+  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
+  0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xDF, 0x00, 0x1F,
+  0x3F, 0x00, 0x7E, 0x3F, 0x01, 0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x01,
+  0x00, 0x00, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xCF, 0x80, 0x01, 0xF8,
+  0xF8, 0x00, 0x1F, 0x0F, 0x80, 0x03, 0xE0, 0xF8, 0x00, 0x7C, 0x0F, 0x80, 0x0F, 0x80, 0xF8, 0x01,
+  0xF0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x80, 0xF8, 0x00, 0xF8, 0x1F, 0x00, 0x0F,
+  0x83, 0xE0, 0x00, 0xF8, 0x7E, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0xF9, 0xF8, 0x00, 0x0F, 0x9F, 0x00,
+  0x00, 0xFB, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xF7, 0xE0, 0x00, 0xFE,
+  0x3F, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0xF8, 0x0F, 0x80, 0x0F, 0x80, 0xFC, 0x00, 0xF8, 0x07, 0xE0,
+  0x0F, 0x80, 0x3F, 0x00, 0xF8, 0x01, 0xF8, 0x0F, 0x80, 0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x0F, 0x80,
+  0x07, 0xE0, 0xF8, 0x00, 0x3F, 0x0F, 0x80, 0x01, 0xF8, 0xF8, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0xFE,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80,
+  0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFB, 0xC0, 0x00, 0x3D, 0xFF, 0xBC, 0x00, 0x03, 0xDF,
+  0xFB, 0xE0, 0x00, 0x3D, 0xFF, 0x9E, 0x00, 0x07, 0x9F, 0xF9, 0xE0, 0x00, 0x79, 0xFF, 0x9F, 0x00,
+  0x07, 0x9F, 0xF9, 0xF0, 0x00, 0xF1, 0xFF, 0x8F, 0x00, 0x0F, 0x1F, 0xF8, 0xF0, 0x00, 0xF1, 0xFF,
+  0x8F, 0x80, 0x1E, 0x1F, 0xF8, 0x78, 0x01, 0xE1, 0xFF, 0x87, 0x80, 0x1E, 0x1F, 0xF8, 0x7C, 0x03,
+  0xC1, 0xFF, 0x83, 0xC0, 0x3C, 0x1F, 0xF8, 0x3C, 0x03, 0xC1, 0xFF, 0x83, 0xE0, 0x78, 0x1F, 0xF8,
+  0x1E, 0x07, 0x81, 0xFF, 0x81, 0xE0, 0x78, 0x1F, 0xF8, 0x1F, 0x07, 0x01, 0xFF, 0x80, 0xF0, 0xF0,
+  0x1F, 0xF8, 0x0F, 0x0F, 0x01, 0xFF, 0x80, 0xF8, 0xF0, 0x1F, 0xF8, 0x07, 0x9E, 0x01, 0xFF, 0x80,
+  0x79, 0xE0, 0x1F, 0xF8, 0x07, 0xDE, 0x01, 0xFF, 0x80, 0x3F, 0xC0, 0x1F, 0xF8, 0x03, 0xFC, 0x01,
+  0xFF, 0x80, 0x3F, 0xC0, 0x1F, 0xF8, 0x01, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0x80, 0x1F, 0xFF, 0x00,
+  0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFF,
+  0xBC, 0x00, 0x1F, 0xFB, 0xE0, 0x01, 0xFF, 0x9E, 0x00, 0x1F, 0xF9, 0xF0, 0x01, 0xFF, 0x8F, 0x00,
+  0x1F, 0xF8, 0xF8, 0x01, 0xFF, 0x87, 0x80, 0x1F, 0xF8, 0x7C, 0x01, 0xFF, 0x83, 0xC0, 0x1F, 0xF8,
+  0x3E, 0x01, 0xFF, 0x81, 0xE0, 0x1F, 0xF8, 0x1F, 0x01, 0xFF, 0x80, 0xF0, 0x1F, 0xF8, 0x0F, 0x81,
+  0xFF, 0x80, 0x78, 0x1F, 0xF8, 0x07, 0x81, 0xFF, 0x80, 0x3C, 0x1F, 0xF8, 0x03, 0xC1, 0xFF, 0x80,
+  0x3E, 0x1F, 0xF8, 0x01, 0xE1, 0xFF, 0x80, 0x1F, 0x1F, 0xF8, 0x00, 0xF1, 0xFF, 0x80, 0x0F, 0x9F,
+  0xF8, 0x00, 0x79, 0xFF, 0x80, 0x07, 0xDF, 0xF8, 0x00, 0x3D, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00,
+  0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x00,
+  0xF8, 0x03, 0xE0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0xFC, 0x3E, 0x00,
+  0x00, 0x1F, 0x1F, 0x00, 0x00, 0x07, 0xE7, 0xC0, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x00, 0x3E, 0x7C,
+  0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+  0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7D, 0xF0, 0x00,
+  0x00, 0x3E, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x01, 0xF0, 0xF8,
+  0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x07, 0xC0,
+  0x1F, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC,
+  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8,
+  0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x1F, 0xCF, 0x80, 0x03, 0xE7, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x7D,
+  0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0x7C,
+  0x00, 0x7F, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x07, 0xC0, 0x00, 0x03, 0xE0,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+  0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0xF8,
+  0x03, 0xE0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00,
+  0x1F, 0x1F, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x00, 0x3E, 0x7C, 0x00,
+  0x00, 0x0F, 0xBE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00,
+  0x3E, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x01, 0xF0, 0xF8, 0x00,
+  0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x1F,
+  0x00, 0x03, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0,
+  0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x60, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xC0,
+  0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x1F, 0x00, 0x1F, 0xCF, 0x80, 0x03, 0xF7, 0xC0, 0x00, 0xFB,
+  0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x7C, 0xF8,
+  0x00, 0xFC, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x0F, 0x80, 0x1F, 0x87, 0xC0,
+  0x03, 0xE3, 0xE0, 0x01, 0xF1, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x3E, 0x00,
+  0x07, 0x9F, 0x00, 0x03, 0xCF, 0x80, 0x01, 0xE7, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x7D, 0xF0, 0x00,
+  0x3E, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x07, 0xBE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x04,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x0F, 0x80, 0x7E, 0x07, 0xC0,
+  0x07, 0xC1, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0x3E, 0x3E, 0x00, 0x0F, 0x8F, 0x80, 0x03, 0xE3, 0xE0,
+  0x00, 0x7C, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
+  0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00,
+  0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0,
+  0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0x7C, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xF7,
+  0xE0, 0x00, 0x78, 0xF8, 0x00, 0x3E, 0x3F, 0x00, 0x1F, 0x07, 0xF0, 0x0F, 0xC0, 0xFF, 0xFF, 0xE0,
+  0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+  0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
+  0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80,
+  0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07,
+  0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+  0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
+  0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF7,
+  0xC0, 0x00, 0x7C, 0xF8, 0x00, 0x0F, 0x9F, 0x80, 0x03, 0xE1, 0xF8, 0x00, 0xFC, 0x1F, 0x80, 0x3F,
+  0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x60, 0x00, 0xF8, 0x00,
+  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x03, 0xE7, 0xC0, 0x00,
+  0x07, 0x87, 0x80, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x01,
+  0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x07, 0x80, 0x78, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x3E,
+  0x01, 0xF0, 0x00, 0x78, 0x01, 0xE0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80,
+  0x07, 0x80, 0x1F, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x1F, 0x00, 0x78, 0x00, 0x1E, 0x01, 0xF0, 0x00,
+  0x3E, 0x03, 0xC0, 0x00, 0x7C, 0x07, 0x80, 0x00, 0x78, 0x1F, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x01,
+  0xF0, 0x78, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x07, 0xC7, 0x80, 0x00, 0x07,
+  0x9E, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x1F, 0x78, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F,
+  0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x1F,
+  0x7C, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x7C, 0x00, 0x07, 0xF0, 0x00, 0x1E, 0x7C, 0x00, 0x07, 0xF0,
+  0x00, 0x1E, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x0F, 0xF8, 0x00, 0x3E, 0x3E, 0x00,
+  0x0F, 0x78, 0x00, 0x3C, 0x3E, 0x00, 0x1E, 0x78, 0x00, 0x3C, 0x1E, 0x00, 0x1E, 0x78, 0x00, 0x7C,
+  0x1F, 0x00, 0x1E, 0x7C, 0x00, 0x7C, 0x1F, 0x00, 0x1E, 0x3C, 0x00, 0x78, 0x1F, 0x00, 0x3C, 0x3C,
+  0x00, 0x78, 0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF8, 0x0F, 0x80, 0x3C, 0x3E, 0x00, 0xF0, 0x0F, 0x80,
+  0x3C, 0x1E, 0x00, 0xF0, 0x0F, 0x80, 0x78, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x78, 0x1E, 0x01, 0xF0,
+  0x07, 0xC0, 0x78, 0x1F, 0x01, 0xE0, 0x07, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x07, 0xC0, 0xF0, 0x0F,
+  0x01, 0xE0, 0x03, 0xC0, 0xF0, 0x0F, 0x03, 0xC0, 0x03, 0xE0, 0xF0, 0x0F, 0x83, 0xC0, 0x03, 0xE1,
+  0xE0, 0x07, 0x83, 0xC0, 0x01, 0xE1, 0xE0, 0x07, 0x83, 0xC0, 0x01, 0xE1, 0xE0, 0x07, 0xC7, 0x80,
+  0x01, 0xE1, 0xE0, 0x03, 0xC7, 0x80, 0x01, 0xF3, 0xC0, 0x03, 0xC7, 0x80, 0x00, 0xF3, 0xC0, 0x03,
+  0xC7, 0x80, 0x00, 0xF3, 0xC0, 0x03, 0xEF, 0x00, 0x00, 0xF3, 0xC0, 0x01, 0xEF, 0x00, 0x00, 0xFF,
+  0x80, 0x01, 0xEF, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xEE, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0xF0, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x1F, 0x07, 0xC0, 0x00,
+  0xF8, 0x1F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0,
+  0x03, 0xE0, 0x1F, 0x00, 0x07, 0x80, 0xF8, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x3E, 0x1F, 0x00, 0x00,
+  0x78, 0xF8, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
+  0x00, 0x00, 0xF7, 0xC0, 0x00, 0x07, 0x8F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x01, 0xF0, 0x7C, 0x00,
+  0x07, 0x80, 0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x01, 0xF0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x80, 0x3E,
+  0x00, 0x1F, 0x01, 0xF0, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0xF8, 0x3E, 0x00, 0x01, 0xF1, 0xF0, 0x00,
+  0x07, 0xEF, 0x80, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07,
+  0xDF, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3E, 0x0F, 0x80, 0x01, 0xF0, 0x7C,
+  0x00, 0x1F, 0x01, 0xF0, 0x01, 0xF0, 0x0F, 0x80, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x01, 0xF8, 0x07,
+  0xC0, 0x07, 0xC0, 0x7C, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0xF8, 0x3E, 0x00, 0x03, 0xE3, 0xE0, 0x00,
+  0x1F, 0x9F, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE7,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
+  0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+  0x03, 0x81, 0xC0, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00,
+  0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0xC0,
+  0x01, 0xC0, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E,
+  0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
+  0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
+  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x00, 0x00, 0xEE, 0x00, 0x07, 0x38, 0x00, 0x1C, 0xF0, 0x00, 0xE1, 0xC0, 0x03, 0x87,
+  0x00, 0x1E, 0x0E, 0x00, 0x70, 0x38, 0x03, 0xC0, 0x70, 0x0E, 0x01, 0xC0, 0x78, 0x07, 0x81, 0xE0,
+  0x0E, 0x07, 0x00, 0x3C, 0x3C, 0x00, 0x70, 0xE0, 0x01, 0xC7, 0x80, 0x07, 0x9C, 0x00, 0x0E, 0xF0,
+  0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0xF0, 0xE0, 0xE1, 0xE1, 0xC0,
+  0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xC0, 0x7E, 0x3E, 0x00, 0xF8, 0xF8, 0x01,
+  0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x7F,
+  0xFF, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xF3, 0xF8, 0x07, 0xDF, 0x80, 0x1F, 0x7C, 0x00, 0x7F, 0xE0,
+  0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x1F, 0xDF,
+  0x80, 0xFF, 0x7F, 0xFF, 0x7C, 0xFF, 0xFD, 0xF0, 0xFF, 0xC3, 0xC0, 0x30, 0x00, 0xF8, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x03, 0xE1, 0xFF, 0x80, 0xF9, 0xFF, 0xF8, 0x3E, 0xFF, 0xFF, 0x0F, 0xB8, 0x07, 0xE3, 0xFC, 0x00,
+  0xFC, 0xFE, 0x00, 0x1F, 0x3F, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xF8, 0x00,
+  0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xEF, 0xC0,
+  0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xFE, 0x00, 0x1F, 0x3F, 0xC0, 0x0F, 0x8F, 0xF8, 0x07, 0xE3, 0xEF,
+  0xFF, 0xE0, 0xFB, 0xFF, 0xF0, 0x3E, 0x3F, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x01,
+  0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x01, 0xF0, 0x0F, 0x81, 0xF0, 0x03, 0xE1, 0xF0, 0x00, 0xF9, 0xF0,
+  0x00, 0x7C, 0xF8, 0x00, 0x1E, 0x7C, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xCF, 0x80, 0x03, 0xE7, 0xC0, 0x01, 0xF1, 0xF0, 0x00,
+  0xF0, 0xFC, 0x00, 0xF8, 0x3F, 0x01, 0xF8, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xF0,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x10, 0x0F, 0x80, 0x7F, 0xF1, 0xF0, 0x3F, 0xFF, 0x3E,
+  0x0F, 0xFF, 0xF7, 0xC3, 0xF0, 0x1F, 0xF8, 0xF8, 0x00, 0xFF, 0x3E, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
+  0xFD, 0xF0, 0x00, 0x1F, 0xBE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x3F,
+  0x3E, 0x00, 0x0F, 0xE7, 0xE0, 0x03, 0xFC, 0x7E, 0x01, 0xEF, 0x87, 0xFF, 0xFD, 0xF0, 0x7F, 0xFF,
+  0x3E, 0x03, 0xFF, 0x87, 0xC0, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x01, 0xFF,
+  0xFE, 0x01, 0xF0, 0x0F, 0x81, 0xF0, 0x03, 0xE1, 0xF0, 0x00, 0xF9, 0xF0, 0x00, 0x7C, 0xF8, 0x00,
+  0x1E, 0x78, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0x1E, 0x00, 0x03, 0xCF, 0x80, 0x01, 0xE7, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0xF0, 0xFC, 0x00, 0xF8,
+  0x3F, 0x01, 0xF8, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0xFC, 0x0F, 0xF0, 0x7F, 0xC3, 0xFF, 0x0F, 0x80, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
+  0x7C, 0x01, 0xF0, 0x07, 0xC0, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0x87, 0xC0, 0x1F, 0x00, 0x7C, 0x01,
+  0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
+  0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
+  0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0xFF, 0xC7, 0xC0, 0xFF, 0xFD, 0xF0, 0xFF, 0xFF, 0x7C, 0x7E,
+  0x01, 0xFF, 0x1F, 0x00, 0x3F, 0xCF, 0x80, 0x07, 0xF7, 0xC0, 0x00, 0xFD, 0xF0, 0x00, 0x3F, 0x7C,
+  0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF7,
+  0xC0, 0x00, 0xFD, 0xF0, 0x00, 0x3F, 0x7E, 0x00, 0x0F, 0xCF, 0x80, 0x07, 0xF3, 0xF0, 0x03, 0xFC,
+  0x7E, 0x01, 0xDF, 0x0F, 0xFF, 0xF7, 0xC1, 0xFF, 0xF9, 0xF0, 0x1F, 0xF8, 0x7C, 0x00, 0x60, 0x1F,
+  0x78, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xE7, 0xC0, 0x00, 0xF8, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x1F,
+  0x07, 0xE0, 0x1F, 0x81, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x7F, 0xE0, 0xF9, 0xFF, 0xF8, 0xFB, 0xFF, 0xFC, 0xFB, 0x80, 0x7E, 0xFF, 0x00,
+  0x3E, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0x27, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0x87, 0xC3, 0xE1, 0xE0,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F,
+  0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC7, 0xFF, 0xEF, 0xF7, 0xF0, 0x80,
+  0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07,
+  0xC0, 0x03, 0xFF, 0x80, 0x0F, 0xDF, 0x00, 0x3F, 0x3E, 0x00, 0x7C, 0x7C, 0x01, 0xF0, 0xF8, 0x07,
+  0xC1, 0xF0, 0x1F, 0x03, 0xE0, 0x7C, 0x07, 0xC1, 0xF0, 0x0F, 0x87, 0xC0, 0x1F, 0x1F, 0x00, 0x3E,
+  0x7C, 0x00, 0x7D, 0xF0, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x07, 0xF7, 0xE0,
+  0x0F, 0xC7, 0xE0, 0x1F, 0x07, 0xE0, 0x3E, 0x07, 0xE0, 0x7C, 0x07, 0xE0, 0xF8, 0x07, 0xE1, 0xF0,
+  0x07, 0xE3, 0xE0, 0x07, 0xE7, 0xC0, 0x0F, 0xCF, 0x80, 0x0F, 0xDF, 0x00, 0x0F, 0xC0, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xFC, 0xFF, 0x7F, 0x3F, 0xF9, 0xFF, 0x81, 0xFF, 0x87, 0xDF, 0xFE, 0x1F, 0xFE, 0x3E, 0xFF, 0xF9,
+  0xFF, 0xF9, 0xFE, 0x07, 0xEE, 0x07, 0xEF, 0xE0, 0x1F, 0xE0, 0x1F, 0x7E, 0x00, 0xFE, 0x00, 0xFF,
+  0xF0, 0x03, 0xF0, 0x03, 0xFF, 0x80, 0x1F, 0x80, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x07,
+  0xC0, 0x07, 0xFE, 0x00, 0x3E, 0x00, 0x3F, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0x80, 0x0F,
+  0xFC, 0x00, 0x7C, 0x00, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0x00, 0x1F, 0xF8, 0x00,
+  0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xC0, 0x07, 0xFE, 0x00, 0x3E, 0x00, 0x3F, 0xF0, 0x01, 0xF0, 0x01,
+  0xFF, 0x80, 0x0F, 0x80, 0x0F, 0xFC, 0x00, 0x7C, 0x00, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xFF, 0x00,
+  0x1F, 0x00, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xC0, 0x07, 0xFE, 0x00, 0x3E, 0x00,
+  0x3E, 0xF8, 0x7F, 0xE0, 0xF9, 0xFF, 0xF8, 0xFB, 0xFF, 0xFC, 0xFB, 0x80, 0x7E, 0xFF, 0x00, 0x3E,
+  0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x01,
+  0xF8, 0x07, 0xF0, 0x3E, 0x00, 0x3E, 0x0F, 0x80, 0x03, 0xE3, 0xF0, 0x00, 0x7E, 0x7C, 0x00, 0x07,
+  0xCF, 0x80, 0x00, 0xFB, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
+  0x00, 0x0F, 0xBE, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x7C, 0xFC, 0x00, 0x1F, 0x0F, 0x80, 0x03, 0xE0,
+  0xF8, 0x00, 0xF8, 0x1F, 0xC0, 0x7F, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
+  0x00, 0x00, 0x60, 0x00, 0xF8, 0x7F, 0xE0, 0x3E, 0x7F, 0xFE, 0x0F, 0xBF, 0xFF, 0xC3, 0xEE, 0x01,
+  0xF8, 0xFF, 0x00, 0x3F, 0x3F, 0x80, 0x07, 0xCF, 0xC0, 0x01, 0xFB, 0xF0, 0x00, 0x3E, 0xFC, 0x00,
+  0x0F, 0xBE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80,
+  0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xFC, 0x00, 0x0F, 0xBF, 0x80, 0x07, 0xCF, 0xF0, 0x03, 0xE3, 0xFE,
+  0x01, 0xF8, 0xFB, 0xFF, 0xF8, 0x3E, 0xFF, 0xFC, 0x0F, 0x8F, 0xFC, 0x03, 0xE0, 0x10, 0x00, 0xF8,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x1F, 0xFC, 0x7C, 0x0F, 0xFF, 0xCF, 0x83, 0xFF, 0xFD, 0xF0, 0xFC, 0x07, 0xFE, 0x3E, 0x00,
+  0x3F, 0xCF, 0x80, 0x03, 0xFB, 0xF0, 0x00, 0x3F, 0x7C, 0x00, 0x07, 0xEF, 0x80, 0x00, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xBE, 0x00, 0x03,
+  0xF7, 0xC0, 0x00, 0x7E, 0xFC, 0x00, 0x0F, 0xCF, 0x80, 0x03, 0xF9, 0xF8, 0x00, 0xFF, 0x1F, 0x80,
+  0x7B, 0xE1, 0xFF, 0xFF, 0x7C, 0x1F, 0xFF, 0xCF, 0x80, 0xFF, 0xE1, 0xF0, 0x00, 0xC0, 0x3E, 0x00,
+  0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0xF9, 0xFF,
+  0xCF, 0xFE, 0xFF, 0xFF, 0x0F, 0xE0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xF8, 0x07, 0xC0, 0x3E, 0x01,
+  0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80,
+  0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0x20, 0x00, 0x3F, 0xF8, 0x03,
+  0xFF, 0xE0, 0x3F, 0xFF, 0x83, 0xE0, 0x7E, 0x3E, 0x01, 0xF9, 0xF0, 0x07, 0xCF, 0x80, 0x3E, 0x7C,
+  0x00, 0xFB, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x1F,
+  0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0x80,
+  0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xEF, 0x80, 0x3F, 0x7E, 0x01, 0xF1, 0xFF, 0xFF, 0x07, 0xFF,
+  0xF0, 0x0F, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F,
+  0x80, 0x7C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03,
+  0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00,
+  0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7E, 0x03, 0xFF, 0x0F, 0xF8, 0x3F, 0xC0, 0x30,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC,
+  0x00, 0x7F, 0x7E, 0x00, 0xFF, 0x7F, 0x01, 0xFF, 0x3F, 0xFF, 0xDF, 0x1F, 0xFF, 0x9F, 0x07, 0xFF,
+  0x1F, 0x00, 0x20, 0x00, 0xF8, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x79, 0xF0, 0x00,
+  0x3E, 0x3E, 0x00, 0x0F, 0x8F, 0x80, 0x03, 0xC1, 0xE0, 0x01, 0xF0, 0x7C, 0x00, 0x7C, 0x1F, 0x00,
+  0x1E, 0x03, 0xC0, 0x0F, 0x80, 0xF8, 0x03, 0xC0, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x7C, 0x01, 0xF0,
+  0x1E, 0x00, 0x3C, 0x07, 0x80, 0x0F, 0x03, 0xC0, 0x03, 0xE0, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x1F,
+  0x1E, 0x00, 0x03, 0xC7, 0x80, 0x00, 0xF1, 0xE0, 0x00, 0x3E, 0xF0, 0x00, 0x07, 0xBC, 0x00, 0x01,
+  0xEE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00,
+  0x0F, 0x7C, 0x00, 0x7F, 0x00, 0x1F, 0x7C, 0x00, 0x7F, 0x00, 0x1F, 0x7C, 0x00, 0x7F, 0x00, 0x1E,
+  0x3C, 0x00, 0xFF, 0x00, 0x3E, 0x3E, 0x00, 0xF7, 0x80, 0x3E, 0x3E, 0x00, 0xF7, 0x80, 0x3C, 0x3E,
+  0x00, 0xE7, 0x80, 0x3C, 0x1F, 0x01, 0xE7, 0x80, 0x7C, 0x1F, 0x01, 0xE3, 0xC0, 0x78, 0x1F, 0x01,
+  0xE3, 0xC0, 0x78, 0x0F, 0x01, 0xC3, 0xC0, 0xF8, 0x0F, 0x83, 0xC3, 0xE0, 0xF0, 0x0F, 0x83, 0xC1,
+  0xE0, 0xF0, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x07, 0xC3, 0x81, 0xE1, 0xE0, 0x07, 0xC7, 0x80, 0xF1,
+  0xE0, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x03, 0xC7, 0x00, 0xF3, 0xE0, 0x03, 0xEF, 0x00, 0xF3, 0xC0,
+  0x01, 0xEF, 0x00, 0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x7B, 0xC0, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00,
+  0xFE, 0x00, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x7C,
+  0x00, 0x3F, 0x00, 0xFC, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x1F, 0x00, 0x7C, 0x1F,
+  0x00, 0xF8, 0x0F, 0x80, 0xF0, 0x07, 0xC1, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE3, 0xC0, 0x01, 0xF7,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xE7, 0xC0, 0x03, 0xC3, 0xC0, 0x07, 0xC3, 0xE0, 0x0F,
+  0x81, 0xF0, 0x0F, 0x00, 0xF8, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0x7C, 0x7E, 0x00, 0x3E, 0x7C, 0x00,
+  0x3E, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x79, 0xF0, 0x00,
+  0x3E, 0x3E, 0x00, 0x0F, 0x8F, 0x80, 0x03, 0xC3, 0xE0, 0x01, 0xF0, 0x7C, 0x00, 0x78, 0x1F, 0x00,
+  0x1E, 0x03, 0xC0, 0x0F, 0x80, 0xF8, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x07, 0x80, 0x78, 0x01, 0xF0,
+  0x1E, 0x00, 0x3C, 0x0F, 0x80, 0x0F, 0x03, 0xC0, 0x03, 0xE0, 0xF0, 0x00, 0x78, 0x7C, 0x00, 0x1E,
+  0x1E, 0x00, 0x07, 0xC7, 0x80, 0x00, 0xF3, 0xC0, 0x00, 0x3C, 0xF0, 0x00, 0x07, 0xBC, 0x00, 0x01,
+  0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
+  0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x3E, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0,
+  0x00, 0x1F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00,
+  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03,
+  0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xE1, 0xFC, 0x3F, 0x8F, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0,
+  0x38, 0x0E, 0x07, 0xC1, 0xE0, 0x3E, 0x07, 0xE0, 0x1C, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1E, 0x01,
+  0xFC, 0x3F, 0x81, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0x0F, 0xE0, 0xFE, 0x00, 0xF0, 0x07, 0x00,
+  0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0xE0, 0x3F, 0x01, 0xF0, 0x7E, 0x07, 0x00, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x07, 0x00, 0x70, 0x0F, 0x0F, 0xE0, 0xFE, 0x0F, 0x80, 0x1F, 0x00, 0x1C, 0xFF, 0x00, 0x77,
+  0xFF, 0x01, 0xFC, 0x3F, 0x0E, 0xE0, 0x3F, 0xFB, 0x80, 0x3F, 0xCE, 0x00, 0x3E, 0x00,
+};
+
+const GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,  11,    0,    0 },   // 0x20 ' '
+  {     0,   7,  37,  13,    3,  -36 },   // 0x21 '!'
+  {    33,  11,  13,  17,    5,  -38 },   // 0x22 '"'
+  {    51,  23,  36,  31,    4,  -36 },   // 0x23 '#'
+  {   155,  24,  45,  30,    3,  -40 },   // 0x24 '$'
+  {   290,  35,  37,  39,    2,  -36 },   // 0x25 '%'
+  {   452,  29,  38,  34,    3,  -37 },   // 0x26 '&'
+  {   590,   4,  13,   9,    2,  -38 },   // 0x27 '''
+  {   597,   9,  45,  16,    5,  -41 },   // 0x28 '('
+  {   648,   9,  45,  17,    2,  -41 },   // 0x29 ')'
+  {   699,  21,  20,  29,    4,  -24 },   // 0x2A '*'
+  {   752,  22,  24,  30,    4,  -28 },   // 0x2B '+'
+  {   818,   9,  11,  11,   -2,   -5 },   // 0x2C ','
+  {   831,  11,   3,  15,    2,  -16 },   // 0x2D '-'
+  {   836,   7,   7,  12,    2,   -6 },   // 0x2E '.'
+  {   843,  16,  39,  16,   -1,  -37 },   // 0x2F '/'
+  {   921,  26,  37,  30,    2,  -36 },   // 0x30 '0'
+  {  1042,  15,  36,  30,    7,  -36 },   // 0x31 '1'
+  {  1110,  24,  36,  30,    3,  -36 },   // 0x32 '2'
+  {  1218,  25,  37,  30,    3,  -36 },   // 0x33 '3'
+  {  1334,  27,  36,  30,    2,  -36 },   // 0x34 '4'
+  {  1456,  25,  37,  30,    3,  -36 },   // 0x35 '5'
+  {  1572,  25,  38,  30,    2,  -37 },   // 0x36 '6'
+  {  1691,  25,  36,  30,    3,  -36 },   // 0x37 '7'
+  {  1804,  26,  37,  30,    2,  -36 },   // 0x38 '8'
+  {  1925,  25,  38,  30,    3,  -37 },   // 0x39 '9'
+  {  2044,   7,  29,  12,    2,  -28 },   // 0x3A ':'
+  {  2070,  10,  34,  12,   -1,  -28 },   // 0x3B ';'
+  {  2113,  21,  23,  30,    5,  -25 },   // 0x3C '<'
+  {  2174,  22,  13,  30,    4,  -23 },   // 0x3D '='
+  {  2210,  21,  24,  31,    4,  -26 },   // 0x3E '>'
+  {  2273,  22,  37,  26,    2,  -36 },   // 0x3F '?'
+  {  2375,  38,  40,  44,    3,  -35 },   // 0x40 '@'
+  {  2565,  31,  36,  33,    2,  -36 },   // 0x41 'A'
+  {  2705,  25,  36,  32,    5,  -36 },   // 0x42 'B'
+  {  2818,  32,  38,  36,    2,  -37 },   // 0x43 'C'
+  {  2970,  30,  36,  37,    5,  -36 },   // 0x44 'D'
+  {  3105,  24,  36,  30,    5,  -36 },   // 0x45 'E'
+  {  3213,  24,  36,  29,    5,  -36 },   // 0x46 'F'
+  {  3321,  31,  38,  36,    2,  -37 },   // 0x47 'G'
+  {  3469,  29,  36,  38,    5,  -36 },   // 0x48 'H'
+  {  3600,   5,  36,  14,    5,  -36 },   // 0x49 'I'
+  {  3623,  23,  37,  29,    3,  -36 },   // 0x4A 'J'
+  {  3730,  28,  36,  32,    5,  -36 },   // 0x4B 'K'
+  {  3856,  24,  36,  30,    5,  -36 },   // 0x4C 'L'
+  {  3964,  36,  36,  45,    5,  -36 },   // 0x4D 'M'
+  {  4126,  28,  36,  37,    5,  -36 },   // 0x4E 'N'
+  {  4252,  34,  37,  38,    2,  -36 },   // 0x4F 'O'
+  {  4410,  25,  36,  31,    5,  -36 },   // 0x50 'P'
+  {  4523,  34,  38,  38,    2,  -36 },   // 0x51 'Q'
+  {  4685,  25,  36,  32,    5,  -36 },   // 0x52 'R'
+  {  4798,  26,  38,  30,    2,  -37 },   // 0x53 'S'
+  {  4922,  30,  36,  32,    2,  -36 },   // 0x54 'T'
+  {  5057,  27,  37,  36,    5,  -36 },   // 0x55 'U'
+  {  5182,  31,  36,  32,    2,  -36 },   // 0x56 'V'
+  {  5322,  48,  36,  50,    1,  -36 },   // 0x57 'W'
+  {  5538,  30,  36,  33,    2,  -36 },   // 0x58 'X'
+  {  5673,  29,  36,  31,    2,  -36 },   // 0x59 'Y'
+  {  5804,  27,  36,  30,    2,  -36 },   // 0x5A 'Z'
+  {  5926,   9,  44,  16,    5,  -40 },   // 0x5B '['
+  {  5976,  16,  39,  16,   -1,  -37 },   // 0x5C 'backslash'
+  {  6054,   9,  44,  15,    1,  -40 },   // 0x5D ']'
+  {  6104,  22,  21,  30,    4,  -32 },   // 0x5E '^'
+  {  6162,  21,   3,  27,    3,    1 },   // 0x5F '_'
+  {  6170,   7,   6,  16,    2,  -36 },   // 0x60 '`'
+  {  6176,  22,  28,  28,    2,  -27 },   // 0x61 'a'
+  {  6253,  26,  39,  32,    4,  -38 },   // 0x62 'b'
+  {  6380,  25,  28,  28,    2,  -27 },   // 0x63 'c'
+  {  6468,  27,  39,  33,    2,  -38 },   // 0x64 'd'
+  {  6600,  25,  28,  29,    2,  -27 },   // 0x65 'e'
+  {  6688,  14,  39,  15,    1,  -39 },   // 0x66 'f'
+  {  6757,  26,  38,  32,    2,  -27 },   // 0x67 'g'
+  {  6881,  24,  38,  32,    4,  -38 },   // 0x68 'h'
+  {  6995,   5,  37,  12,    3,  -37 },   // 0x69 'i'
+  {  7019,   9,  47,  12,   -1,  -36 },   // 0x6A 'j'
+  {  7072,  23,  38,  28,    4,  -38 },   // 0x6B 'k'
+  {  7182,   8,  38,  13,    4,  -38 },   // 0x6C 'l'
+  {  7220,  37,  27,  45,    4,  -27 },   // 0x6D 'm'
+  {  7345,  24,  27,  32,    4,  -27 },   // 0x6E 'n'
+  {  7426,  27,  29,  31,    2,  -28 },   // 0x6F 'o'
+  {  7524,  26,  37,  32,    4,  -27 },   // 0x70 'p'
+  {  7645,  27,  38,  33,    2,  -28 },   // 0x71 'q'
+  {  7774,  13,  27,  17,    4,  -27 },   // 0x72 'r'
+  {  7818,  21,  29,  24,    1,  -28 },   // 0x73 's'
+  {  7895,  13,  35,  16,    1,  -34 },   // 0x74 't'
+  {  7952,  24,  28,  31,    3,  -27 },   // 0x75 'u'
+  {  8036,  26,  27,  27,    0,  -27 },   // 0x76 'v'
+  {  8124,  40,  27,  41,    0,  -27 },   // 0x77 'w'
+  {  8259,  24,  27,  25,   -1,  -27 },   // 0x78 'x'
+  {  8340,  26,  38,  27,   -1,  -27 },   // 0x79 'y'
+  {  8464,  21,  27,  24,    1,  -27 },   // 0x7A 'z'
+  {  8535,  11,  44,  15,    3,  -40 },   // 0x7B '{'
+  {  8596,   3,  52,  13,    5,  -42 },   // 0x7C '|'
+  {  8616,  12,  44,  16,    1,  -40 },   // 0x7D '}'
+  {  8682,  22,   7,  30,    4,  -18 },   // 0x7E '~'
+};
+
+const GFXfont FreeSans24pt7b PROGMEM = {
+  (uint8_t *)FreeSans24pt7bBitmaps, (GFXglyph *)FreeSans24pt7bGlyphs, 0x20, 0x7E, 63 };
+
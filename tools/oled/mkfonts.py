@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# Generate fonts.cpp : GFX fonts for the TFT_eSPI stand-in (see TFT_eSPI.h)
+#
+#	python3 mkfonts.py > fonts.cpp
+#
+# TFT_eSPI's FreeSans fonts aren't in this tree, so the same names are made from the
+# font that comes with Pillow (Aileron, public domain), at about the same sizes. Text
+# on a host screenshot looks a bit different from the keypad, but every glyph has the
+# same structure : ASCII 0x20 .. 0x7E, 1 bit per pixel, rows packed.
+#
+# Glcd stands in for TFT_eSPI's built in 5x7 font, the one that's used without a free font.
+#
+# Copyright (c) 2018 Danny Backx
+#
+# License (GNU Lesser General Public License) :
+#
+#   This program is free software; you can redistribute it and/or
+#   modify it under the terms of the GNU Lesser General Public
+#   License as published by the Free Software Foundation; either
+#   version 3 of the License, or (at your option) any later version.
+#
+#   This library is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#   Lesser General Public License for more details.
+#
+#   You should have received a copy of the GNU Lesser General Public
+#   License along with this library; if not, write to the Free Software
+#   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+
+from PIL import Image, ImageDraw, ImageFont
+
+FIRST, LAST = 0x20, 0x7E
+
+# Name, pixel size of the Aileron font that gives digits about as high as FreeSans
+FONTS = [
+    ("Glcd", 10),
+    ("FreeSans9pt7b", 20),
+    ("FreeSans12pt7b", 26),
+    ("FreeSans18pt7b", 38),
+    ("FreeSans24pt7b", 52),
+]
+
+
+def glyph(font, ch):
+    """Bitmap bytes, width, height, xAdvance, xOffset, yOffset"""
+    adv = round(font.getlength(ch))
+    x0, y0, x1, y1 = font.getbbox(ch, anchor="ls")
+    if x1 <= x0 or y1 <= y0:
+        return b"", 0, 0, adv, 0, 0
+
+    # Not anti-aliased : a threshold loses the thin strokes of the small sizes
+    im = Image.new("L", (x1 - x0, y1 - y0), 0)
+    draw = ImageDraw.Draw(im)
+    draw.fontmode = "1"
+    draw.text((-x0, -y0), ch, font=font, anchor="ls", fill=255)
+    px = im.load()
+    ink = [(x, y) for y in range(im.height) for x in range(im.width) if px[x, y] >= 128]
+    if not ink:
+        return b"", 0, 0, adv, 0, 0
+
+    # Only the ink
+    l = min(x for x, _ in ink)
+    r = max(x for x, _ in ink) + 1
+    t = min(y for _, y in ink)
+    b = max(y for _, y in ink) + 1
+    bits = [1 if px[x, y] >= 128 else 0 for y in range(t, b) for x in range(l, r)]
+    bits += [0] * (-len(bits) % 8)
+    data = bytes(int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8))
+    return data, r - l, b - t, adv, x0 + l, y0 + t
+
+
+def emit(name, size):
+    font = ImageFont.load_default(size)
+    ascent, descent = font.getmetrics()
+    bitmap = b""
+    glyphs = []
+    for c in range(FIRST, LAST + 1):
+        data, w, h, adv, xo, yo = glyph(font, chr(c))
+        glyphs.append((len(bitmap), w, h, adv, xo, yo, chr(c)))
+        bitmap += data
+
+    print("const uint8_t %sBitmaps[] PROGMEM = {" % name)
+    for i in range(0, len(bitmap), 16):
+        print("  " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",")
+    print("};\n")
+    print("const GFXglyph %sGlyphs[] PROGMEM = {" % name)
+    for off, w, h, adv, xo, yo, ch in glyphs:
+        print("  { %5d, %3d, %3d, %3d, %4d, %4d },   // 0x%02X '%s'"
+              % (off, w, h, adv, xo, yo, ord(ch), ch if ch != "\\" else "backslash"))
+    print("};\n")
+    print("const GFXfont %s PROGMEM = {" % name)
+    print("  (uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, 0x%02X, 0x%02X, %d };\n"
+          % (name, name, FIRST, LAST, ascent + descent))
+
+
+print("// Generated by mkfonts.py, don't edit\n")
+print("#include <TFT_eSPI.h>\n")
+for name, size in FONTS:
+    emit(name, size)
@@ -0,0 +1,98 @@
+/*
+ * The other keypad modules, as the screens see them on the host
+ *
+ * Clock, Weather and Alarm call into Config, Peers, Journal, AlarmStore and LoadGif. Those
+ * need flash, a file system or the network, so here they're empty, except for what the
+ * screens get from them : a peer with weather data (host_weather_json).
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Config.h>
+#include <Peers.h>
+#include <Journal.h>
+#include <AlarmStore.h>
+#include <LoadGif.h>
+
+Config *config;
+Peers *peers;
+Journal *journal;
+AlarmStore *alarmstore;
+LoadGif *gif;
+
+const char *host_weather_json;
+
+Config::Config() {
+  name = "host";
+}
+
+const char *Config::myName() {
+  return name;
+}
+
+boolean Config::DSTEurope() {
+  return true;
+}
+
+boolean Config::DSTUSA() {
+  return false;
+}
+
+Peers::Peers() {
+}
+
+void Peers::AlarmSetArmed(AlarmStatus) {
+}
+
+void Peers::AlarmSignal(const char *, AlarmZone) {
+}
+
+void Peers::AlarmReset(const char *) {
+}
+
+void Peers::SendWeather(const char *) {
+}
+
+void Peers::Report(const char *) {
+}
+
+/*
+ * There's a weather node if there is weather
+ */
+Peer *Peers::FindWeatherNode() {
+  static Peer node;
+
+  return host_weather_json ? &node : 0;
+}
+
+char *Peers::CallPeer(Peer *, char *) {
+  return strdup(host_weather_json);
+}
+
+void Peers::ImageFromPeerBinary(IPAddress, uint16_t, uint16_t, uint16_t, uint16_t) {
+}
+
+void Journal::Log(JournalType, const char *, uint8_t, uint8_t) {
+}
+
+void AlarmStore::Save(AlarmStatus, time_t) {
+}
+
+void LoadGif::loadGif(const char *) {
+}
@@ -0,0 +1,94 @@
+/*
+ * Overdraw of the keypad's screens : what each scene (see screens.cpp) sends
+ *
+ *	make bench
+ *	./screenbench [-n runs] [scene ..]
+ *
+ * For each scene, only its last step is counted :
+ *	written		pixels sent to the display
+ *	covered		pixels that changed hands at least once
+ *	overdraw	written / covered, 1.00 means nothing was sent twice
+ *	max		the most any pixel was written
+ *	tx, windows	SPI transactions and address windows
+ *	bytes, SPI ms	what went over the bus, and how long that is at 40 MHz
+ *	host us		time to run it here, the best of -n runs (default 20)
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Oled.h>
+#include "screens.h"
+
+static double Now() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+  const int npixels = OledPanel::width * OledPanel::height;
+  int runs = 20;
+
+  if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+    runs = atoi(argv[2]);
+    argc -= 2, argv += 2;
+  }
+  Serial.quiet = true;
+
+  printf("%-16s %8s %8s %9s %4s %5s %8s %8s %7s %8s\n", "scene", "written", "covered",
+    "overdraw", "max", "tx", "windows", "bytes", "SPI ms", "host us");
+  for (int i = 0; i < nscenes; i++) {
+    boolean wanted = (argc == 1);
+    for (int a = 1; a < argc; a++)
+      if (strcmp(argv[a], scenes[i].name) == 0)
+        wanted = true;
+    if (! wanted)
+      continue;
+
+    double best = 1e9;
+    TFT_Record r = TFT_Record();
+    int covered = 0, max = 0;
+
+    for (int run = 0; run < runs; run++) {
+      screens_play(i);
+      memset(&oled->record, 0, sizeof(oled->record));
+      memset(oled->writes, 0, npixels);
+
+      double t = Now();
+      scenes[i].run();
+      oled->flush();
+      t = Now() - t;
+      if (t < best)
+        best = t;
+      r = oled->record;
+    }
+    for (int p = 0; p < npixels; p++) {
+      if (oled->writes[p])
+        covered++;
+      if (oled->writes[p] > max)
+        max = oled->writes[p];
+    }
+
+    printf("%-16s %8u %8d %9.2f %4d %5u %8u %8u %7.2f %8.1f\n", scenes[i].name, r.pixels, covered,
+      covered ? (double)r.pixels / covered : 0.0, max, r.transactions, r.windows, r.bytes,
+      r.bytes * 8 / 40e6 * 1e3, best * 1e6);
+  }
+  return 0;
+}
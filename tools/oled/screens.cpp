@@ -0,0 +1,234 @@
+/*
+ * The keypad's screens on the host
+ *
+ * Clock, Weather and Alarm as Keypad.ino sets them up, each on a screen of its own, and
+ * together on the home screen. The scenes show them, and make them change : the time
+ * moving on, new weather, arming the alarm. Time is UTC, and starts at 2018-10-18 12:34.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Oled.h>
+#include <Widget.h>
+#include <Icon.h>
+#include <Clock.h>
+#include <Weather.h>
+#include <Alarm.h>
+#include <Config.h>
+#include <Peers.h>
+#include "screens.h"
+
+Oled *oled;
+Clock *_clock;
+Weather *weather;
+Alarm *_alarm;
+
+extern const char *host_weather_json;
+
+static int s_clock, s_weather, s_alarm, s_home, s_detail;
+static time_t now_ts;
+static uint8_t *sun;
+
+static const char *weather1 =
+  "{ \"weather\" : \"Clear\", \"temp_c\" : 12.5, \"temp_f\" : 54.5, \"relative_humidity\" : \"71%\","
+  " \"wind_kph\" : 14, \"wind_mph\" : 9, \"precip_today_metric\" : 0, \"precip_today_in\" : 0,"
+  " \"pressure_mb\" : 1021, \"pressure_in\" : 30, \"pressure_trend\" : \"+\", \"icon\" : \"clear\" }";
+static const char *weather2 =
+  "{ \"weather\" : \"Rain\", \"temp_c\" : 9.5, \"temp_f\" : 49.1, \"relative_humidity\" : \"93%\","
+  " \"wind_kph\" : 31, \"wind_mph\" : 19, \"precip_today_metric\" : 4, \"precip_today_in\" : 0,"
+  " \"pressure_mb\" : 1003, \"pressure_in\" : 29, \"pressure_trend\" : \"-\", \"icon\" : \"rain\" }";
+
+/*
+ * A 50x50 weather icon : a sun on a blue sky, 4 bit when packed
+ */
+static uint8_t *Sun() {
+  uint16_t pixels[50 * 50];
+
+  for (int y = 0; y < 50; y++)
+    for (int x = 0; x < 50; x++) {
+      int d = (x - 25) * (x - 25) + (y - 25) * (y - 25);
+      pixels[y * 50 + x] = (d < 12 * 12) ? TFT_YELLOW : (d < 15 * 15) ? TFT_ORANGE : 0x435C;
+    }
+  return Icon::Pack(pixels, 50, 50);
+}
+
+static void Tick(time_t t) {
+  now_ts = t;
+  host_millis += 1000;
+  weather->loop(now_ts);
+  _clock->loop(now_ts);
+  _alarm->loop(now_ts);
+  oled->loop(now_ts);
+}
+
+/*
+ * Everything from scratch, as in Keypad.ino's setup()
+ */
+void screens_setup() {
+  static const char *keys[] = { "yes", "no", "maybe" };
+  struct tm tm;
+
+  setenv("TZ", "UTC", 1);
+  tzset();
+  memset(&tm, 0, sizeof(tm));
+  tm.tm_year = 2018 - 1900;
+  tm.tm_mon = 10 - 1;
+  tm.tm_mday = 18;
+  tm.tm_hour = 12;
+  tm.tm_min = 34;
+  now_ts = timegm(&tm);
+  host_millis = 0;
+  host_weather_json = 0;
+
+  delete oled;
+  oled = new Oled();
+  oled->init();
+  oled->begin();
+
+  if (config == 0)
+    config = new Config();
+  if (peers == 0)
+    peers = new Peers();
+  if (sun == 0)
+    sun = Sun();
+
+  _clock = new Clock(oled);
+  weather = new Weather(false, oled);
+  _alarm = new Alarm(oled);
+
+  OledScreen scr;
+  scr.number = 0;
+  scr.draw = 0;
+  scr.name = "clock";
+  s_clock = oled->addScreen(scr);
+  scr.name = "weather";
+  s_weather = oled->addScreen(scr);
+  scr.name = "alarm";
+  s_alarm = oled->addScreen(scr);
+  scr.name = "home";
+  s_home = oled->addScreen(scr);
+  scr.name = "detail";
+  s_detail = oled->addScreen(scr);
+
+  for (int col = 0; col < 3; col++) {
+    OledButtonWidget *b = new OledButtonWidget(40 + col * (62 + 18), 300, 62, 30,
+      TFT_WHITE, TFT_RED, TFT_WHITE, keys[col], 1, 0, 0);
+    b->setFont(1);
+    oled->addWidget(s_home, b);
+  }
+  oled->addWidget(s_clock, _clock);
+  oled->addWidget(s_weather, weather);
+  oled->addWidget(s_alarm, _alarm->GetButton());
+  oled->addWidget(s_home, _clock);
+  oled->addWidget(s_home, weather);
+  oled->addWidget(s_home, _alarm->GetButton());
+  oled->addWidget(s_detail, _clock);
+
+  Tick(now_ts);
+}
+
+/*
+ * The weather comes from a peer, the icon after it. Weather keeps the icon.
+ */
+static void Weather1() {
+  host_weather_json = weather1;
+  Tick(now_ts);
+
+  uint8_t *icon = (uint8_t *)malloc(Icon::Size(sun));
+  memcpy(icon, sun, Icon::Size(sun));
+  weather->drawIcon(icon);
+  oled->flush();
+}
+
+static void Weather2() {
+  DynamicJsonBuffer jb;
+  weather->FromPeer(jb.parseObject(weather2));
+  Tick(now_ts);
+}
+
+static void At(int hour, int min) {
+  now_ts -= now_ts % 86400;
+  now_ts += hour * 3600 + min * 60;
+  Tick(now_ts);
+}
+
+static void ShowClock() { oled->showScreen(s_clock); }
+static void ShowWeather() { Weather1(); oled->showScreen(s_weather); }
+static void ShowAlarm() { oled->showScreen(s_alarm); }
+static void ShowHome() { Weather1(); oled->showScreen(s_home); }
+static void ShowDetail() { oled->showScreen(s_detail); }
+
+static void Clock1300() { At(13, 0); }
+static void ShowClock1259() { At(12, 59); ShowClock(); }
+static void ShowClock1300() { At(13, 0); ShowClock(); }
+static void Midnight() { now_ts += 86400; At(0, 0); }
+static void ShowClock2359() { At(23, 59); ShowClock(); }
+static void ShowClockNextDay() { now_ts += 86400; At(0, 0); ShowClock(); }
+
+static void ShowWeatherFrom2() { Weather1(); Weather2(); oled->showScreen(s_weather); }
+
+static void Arm() { _alarm->SetArmed(ALARM_ON); Tick(now_ts); }
+static void ExitDelayOver() { host_millis += PREF_ALARM_EXIT_DELAY * 1000; Tick(now_ts); }
+static void ShowAlarmArming() { ShowAlarm(); Arm(); }
+static void ShowAlarmRestored() { _alarm->Restore(ALARM_ON); ShowAlarm(); }
+static void Night() { _alarm->SetArmed(ALARM_NIGHT); Tick(now_ts); }
+static void Fire() { _alarm->Signal("smoke", ZONE_ALWAYS); Tick(now_ts); }
+static void ShowAlarmArmed() { ShowAlarmArming(); ExitDelayOver(); }
+
+static void ShowHomeDetail() { ShowHome(); ShowDetail(); }
+static void BackHome() { oled->showScreen(s_home); }
+
+const Scene scenes[] = {
+  { "clock",		0,			ShowClock,		0 },
+  { "clock-hour",	ShowClock1259,		Clock1300,		"clock-1300" },
+  { "clock-1300",	0,			ShowClock1300,		0 },
+  { "clock-midnight",	ShowClock2359,		Midnight,		"clock-next-day" },
+  { "clock-next-day",	0,			ShowClockNextDay,	0 },
+  { "weather",		0,			ShowWeather,		0 },
+  { "weather-update",	ShowWeather,		Weather2,		"weather-2" },
+  { "weather-2",	0,			ShowWeatherFrom2,	0 },
+  { "alarm-off",	0,			ShowAlarm,		0 },
+  { "alarm-arming",	ShowAlarm,		Arm,			0 },
+  { "alarm-armed",	ShowAlarmArming,	ExitDelayOver,		"alarm-restored" },
+  { "alarm-restored",	0,			ShowAlarmRestored,	0 },
+  { "alarm-night",	ShowAlarm,		Night,			0 },
+  { "alarm-sounding",	ShowAlarmArmed,		Fire,			0 },
+  { "home",		0,			ShowHome,		0 },
+  { "home-detail",	ShowHome,		ShowDetail,		"detail" },
+  { "detail",		0,			ShowDetail,		0 },
+  { "detail-home",	ShowHomeDetail,		BackHome,		"home" },
+};
+
+const int nscenes = sizeof(scenes) / sizeof(scenes[0]);
+
+/*
+ * From scratch up to the start of scene n. Its run() is left to the caller.
+ */
+void screens_play(int n) {
+  screens_setup();
+  if (scenes[n].setup)
+    scenes[n].setup();
+}
+
+int screens_find(const char *name) {
+  for (int i = 0; i < nscenes; i++)
+    if (strcmp(scenes[i].name, name) == 0)
+      return i;
+  return -1;
+}
@@ -0,0 +1,44 @@
+/*
+ * The keypad's screens on the host, see screens.cpp
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef	_SCREENS_H_
+#define	_SCREENS_H_
+
+#include <Oled.h>
+
+/*
+ * Something the keypad shows. Each scene starts from a fresh start (screens_setup()).
+ */
+struct Scene {
+  const char	*name;
+  void		(*setup)();	// From a fresh start to just before, or 0
+  void		(*run)();	// What is measured, and looked at afterwards
+  const char	*same_as;	// Another scene that must end with the same picture, or 0
+};
+
+extern const Scene scenes[];
+extern const int nscenes;
+
+void screens_setup();
+void screens_play(int n);
+int screens_find(const char *name);
+
+#endif	/* _SCREENS_H_ */
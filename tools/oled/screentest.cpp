@@ -0,0 +1,147 @@
+/*
+ * Golden image tests of the keypad's screens (Clock, Weather, Alarm)
+ *
+ *	make check
+ *	./screentest [-u] [-o dir] [scene ..]
+ *
+ * Each scene (see screens.cpp) is played from scratch, and what's on the display after it
+ * must be the same, to the pixel, as golden/scene.png. If not, scene.fail.png shows what
+ * it was. A scene that changes the screen (the clock going from 23:59 to 0:00) must also
+ * look the same as drawing the result from scratch.
+ *
+ * -u writes the golden images instead, look at them before committing.
+ * -o also writes dir/scene.png, and dir/scene.ppm the way Oled::snapshot() makes it.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Oled.h>
+#include "screens.h"
+#include "snapshot.h"
+
+static const int W = OledPanel::width, H = OledPanel::height;
+
+/*
+ * Play scene n, and keep what it shows
+ */
+static void Play(int n, uint16_t *fb) {
+  screens_play(n);
+  scenes[n].run();
+  oled->flush();
+  memcpy(fb, oled->fb, W * H * 2);
+}
+
+/*
+ * Pixels that differ, and where
+ */
+static int Differ(const uint8_t *a, const uint8_t *b, char *where) {
+  int n = 0, x0 = W, y0 = H, x1 = -1, y1 = -1;
+
+  for (int y = 0; y < H; y++)
+    for (int x = 0; x < W; x++, a += 3, b += 3)
+      if (memcmp(a, b, 3) != 0) {
+        n++;
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+        if (y < y0) y0 = y;
+        if (y > y1) y1 = y;
+      }
+  sprintf(where, "%d,%d .. %d,%d", x0, y0, x1, y1);
+  return n;
+}
+
+int main(int argc, char *argv[]) {
+  boolean update = false;
+  const char *dir = 0;
+  int failed = 0, tested = 0;
+  uint16_t *fb = (uint16_t *)malloc(W * H * 2), *fb2 = (uint16_t *)malloc(W * H * 2);
+  uint8_t *rgb = (uint8_t *)malloc(W * H * 3), *rgb2 = (uint8_t *)malloc(W * H * 3);
+  char fn[256], where[64];
+
+  for (; argc > 1 && argv[1][0] == '-'; argc--, argv++) {
+    if (strcmp(argv[1], "-u") == 0)
+      update = true;
+    else if (strcmp(argv[1], "-o") == 0 && argc > 2) {
+      dir = argv[2];
+      argc--, argv++;
+    } else {
+      fprintf(stderr, "Usage: %s [-u] [-o dir] [scene ..]\n", argv[0]);
+      exit(1);
+    }
+  }
+  Serial.quiet = true;
+
+  for (int i = 0; i < nscenes; i++) {
+    const Scene *s = &scenes[i];
+    boolean wanted = (argc == 1);
+    for (int a = 1; a < argc; a++)
+      if (strcmp(argv[a], s->name) == 0)
+        wanted = true;
+    if (! wanted)
+      continue;
+    tested++;
+
+    Play(i, fb);
+    snapshot_rgb(fb, W * H, rgb);
+    if (dir) {
+      snprintf(fn, sizeof(fn), "%s/%s.png", dir, s->name);
+      snapshot_png(fn, fb, W, H);
+      snprintf(fn, sizeof(fn), "%s/%s.ppm", dir, s->name);
+      snapshot_ppm(fn);
+    }
+
+    snprintf(fn, sizeof(fn), "golden/%s.png", s->name);
+    if (update) {
+      snapshot_png(fn, fb, W, H);
+      printf("%-16s written\n", s->name);
+      continue;
+    }
+
+    int w, h, n = 0;
+    uint8_t *golden = snapshot_read_png(fn, &w, &h);
+    if (golden == NULL || w != W || h != H) {
+      printf("%-16s FAILED, can't read %s\n", s->name, fn);
+      failed++;
+      free(golden);
+      continue;
+    }
+    if ((n = Differ(rgb, golden, where)) != 0) {
+      printf("%-16s FAILED, %d pixels differ from %s in %s\n", s->name, n, fn, where);
+      snprintf(fn, sizeof(fn), "%s.fail.png", s->name);
+      snapshot_png(fn, fb, W, H);
+      failed++;
+    }
+    free(golden);
+
+    if (s->same_as && n == 0) {
+      Play(screens_find(s->same_as), fb2);
+      snapshot_rgb(fb2, W * H, rgb2);
+      if ((n = Differ(rgb, rgb2, where)) != 0) {
+        printf("%-16s FAILED, %d pixels differ from %s in %s\n", s->name, n, s->same_as, where);
+        failed++;
+      }
+    }
+    if (n == 0)
+      printf("%-16s ok%s%s\n", s->name, s->same_as ? ", same as " : "", s->same_as ? s->same_as : "");
+  }
+
+  if (failed)
+    printf("%d of %d failed\n", failed, tested);
+  return failed != 0;
+}
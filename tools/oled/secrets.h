@@ -0,0 +1,6 @@
+/*
+ * Made up, for the host build. See secrets.h.sample for the real one.
+ */
+#define	WUNDERGROUND_API_KEY	"none"
+#define	WUNDERGROUND_COUNTRY	"BE"
+#define	WUNDERGROUND_CITY	"Leuven"
@@ -0,0 +1,170 @@
+/*
+ * Pictures of the TFT_eSPI stand-in's display
+ *
+ * PPM files come from Oled::snapshot(), the way the keypad sends them. PNG files are
+ * written here from the frame buffer : 8 bit RGB, no filters, one zlib stream. The reader
+ * only takes what the writer makes, that's enough for golden images.
+ * RGB565 is widened the way Oled::snapshot() does it.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <zlib.h>
+#include <Oled.h>
+#include "snapshot.h"
+
+static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+void snapshot_rgb(const uint16_t *fb, int n, uint8_t *rgb) {
+  for (int i = 0; i < n; i++) {
+    uint16_t c = fb[i];
+    *rgb++ = ((c >> 11) * 527 + 23) >> 6;
+    *rgb++ = (((c >> 5) & 0x3F) * 259 + 33) >> 6;
+    *rgb++ = ((c & 0x1F) * 527 + 23) >> 6;
+  }
+}
+
+static void Put32(uint8_t *p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+static uint32_t Get32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void Chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+  uint8_t b[4];
+  uint32_t crc = crc32(0, (const Bytef *)type, 4);
+
+  crc = crc32(crc, data, len);
+  Put32(b, len);
+  fwrite(b, 1, 4, f);
+  fwrite(type, 1, 4, f);
+  fwrite(data, 1, len, f);
+  Put32(b, crc);
+  fwrite(b, 1, 4, f);
+}
+
+boolean snapshot_png(const char *fn, const uint16_t *fb, int w, int h) {
+  uLong rawlen = (1 + 3 * w) * h;
+  uLongf zlen = compressBound(rawlen);
+  uint8_t *raw = (uint8_t *)malloc(rawlen), *z = (uint8_t *)malloc(zlen);
+  uint8_t ihdr[13] = { 0 };
+  FILE *f;
+
+  for (int y = 0; y < h; y++) {
+    raw[y * (1 + 3 * w)] = 0;		// No filter
+    snapshot_rgb(fb + y * w, w, raw + y * (1 + 3 * w) + 1);
+  }
+  if (compress2(z, &zlen, raw, rawlen, 9) != Z_OK || (f = fopen(fn, "wb")) == NULL) {
+    perror(fn);
+    free(raw);
+    free(z);
+    return false;
+  }
+
+  Put32(ihdr, w);
+  Put32(ihdr + 4, h);
+  ihdr[8] = 8;				// Bits per sample
+  ihdr[9] = 2;				// RGB
+  fwrite(signature, 1, sizeof(signature), f);
+  Chunk(f, "IHDR", ihdr, sizeof(ihdr));
+  Chunk(f, "IDAT", z, zlen);
+  Chunk(f, "IEND", 0, 0);
+  fclose(f);
+
+  free(raw);
+  free(z);
+  return true;
+}
+
+boolean snapshot_ppm(const char *fn) {
+  FILE *f = fopen(fn, "wb");
+
+  if (f == NULL) {
+    perror(fn);
+    return false;
+  }
+  FilePrint out(f);
+  oled->snapshot(&out);
+  fclose(f);
+  return true;
+}
+
+/*
+ * RGB, 3 bytes a pixel, NULL if it's not a PNG that snapshot_png() could have written
+ */
+uint8_t *snapshot_read_png(const char *fn, int *w, int *h) {
+  FILE *f = fopen(fn, "rb");
+  uint8_t *file = 0, *idat = 0, *raw = 0, *rgb = 0;
+  long len;
+  uint32_t nidat = 0;
+  uLongf rawlen;
+
+  if (f == NULL)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  file = (uint8_t *)malloc(len);
+  idat = (uint8_t *)malloc(len);
+  if (fread(file, 1, len, f) != (size_t)len || len < 33 || memcmp(file, signature, 8) != 0
+   || memcmp(file + 12, "IHDR", 4) != 0 || file[24] != 8 || file[25] != 2 || file[28] != 0)
+    goto fail;
+
+  *w = Get32(file + 16);
+  *h = Get32(file + 20);
+  for (long p = 8; p + 12 <= len; ) {
+    uint32_t n = Get32(file + p);
+    if (p + 12 + n > (uint32_t)len)
+      goto fail;
+    if (memcmp(file + p + 4, "IDAT", 4) == 0) {
+      memcpy(idat + nidat, file + p + 8, n);
+      nidat += n;
+    }
+    p += 12 + n;
+  }
+
+  rawlen = (1 + 3 * *w) * *h;
+  raw = (uint8_t *)malloc(rawlen);
+  rgb = (uint8_t *)malloc(3 * *w * *h);
+  if (uncompress(raw, &rawlen, idat, nidat) != Z_OK || rawlen != (uLongf)(1 + 3 * *w) * *h)
+    goto fail;
+  for (int y = 0; y < *h; y++) {
+    if (raw[y * (1 + 3 * *w)] != 0)
+      goto fail;
+    memcpy(rgb + y * 3 * *w, raw + y * (1 + 3 * *w) + 1, 3 * *w);
+  }
+  free(file);
+  free(idat);
+  free(raw);
+  fclose(f);
+  return rgb;
+
+fail:
+  free(file);
+  free(idat);
+  free(raw);
+  free(rgb);
+  fclose(f);
+  return NULL;
+}
@@ -0,0 +1,43 @@
+/*
+ * Pictures of the TFT_eSPI stand-in's display, see snapshot.cpp
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef	_SNAPSHOT_H_
+#define	_SNAPSHOT_H_
+
+#include <Arduino.h>
+
+/* A Print that writes to a file, for Oled::snapshot() */
+class FilePrint : public Print {
+  public:
+    FilePrint(FILE *f) : f(f) {}
+    size_t write(uint8_t c) { return fwrite(&c, 1, 1, f); }
+    size_t write(const uint8_t *buf, size_t n) { return fwrite(buf, 1, n, f); }
+
+  private:
+    FILE	*f;
+};
+
+void snapshot_rgb(const uint16_t *fb, int n, uint8_t *rgb);
+boolean snapshot_png(const char *fn, const uint16_t *fb, int w, int h);
+boolean snapshot_ppm(const char *fn);
+uint8_t *snapshot_read_png(const char *fn, int *w, int *h);
+
+#endif	/* _SNAPSHOT_H_ */
@@ -0,0 +1,18 @@
+/*
+ * No network time on the host, the tests set the time themselves
+ */
+#ifndef	_SNTP_H_
+#define	_SNTP_H_
+
+#include <time.h>
+
+#define	SNTP_OPMODE_POLL	0
+
+static inline void sntp_setoperatingmode(int) {}
+static inline void sntp_setservername(int, char *) {}
+static inline void sntp_init(void) {}
+static inline void sntp_stop(void) {}
+static inline bool sntp_set_timezone(int) { return true; }
+static inline time_t sntp_get_current_timestamp(void) { return 0; }
+
+#endif	/* _SNTP_H_ */
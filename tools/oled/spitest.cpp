@@ -0,0 +1,177 @@
+/*
+ * Count the SPI transactions that Keypad/Oled.cpp needs for a frame
+ *
+ *	make check
+ *	./spitest [-v]
+ *
+ * Oled runs on the recording TFT_eSPI stand-in (see TFT_eSPI.h). Each case draws
+ * something, and checks what went over the bus against what Oled says it did
+ * (getStats()) and against what it should be. -v prints every case.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Oled.h>
+#include <Icon.h>
+#include <Widget.h>
+
+Oled *oled;
+
+static int verbose, failed;
+
+/*
+ * What the last case sent, and what Oled counted
+ */
+static TFT_Record Frame(OledStats *stats) {
+  TFT_Record r = oled->record;
+
+  memset(&oled->record, 0, sizeof(oled->record));
+  *stats = oled->getStats();
+  return r;
+}
+
+/*
+ * Check the last case. Windows aren't checked if 0. Oled must know about all but
+ * direct of the transactions, those that don't go through it (TFT_eSPI_Button).
+ */
+static void Expect(const char *name, uint32_t transactions, uint32_t windows = 0, uint32_t direct = 0) {
+  OledStats s;
+  TFT_Record r = Frame(&s);
+  boolean ok = r.transactions == transactions && (windows == 0 || r.windows == windows)
+    && s.transactions + direct == r.transactions;
+
+  if (verbose || ! ok)
+    printf("%-28s %4u transactions (%u) %5u windows %7u pixels %8u bytes, Oled %u/%u/%u %s\n",
+      name, r.transactions, transactions, r.windows, r.pixels, r.bytes,
+      s.commands, s.merged, s.transactions, ok ? "" : "FAILED");
+  if (! ok)
+    failed++;
+}
+
+static uint16_t image[50 * 40];
+
+int main(int argc, char *argv[]) {
+  OledStats s;
+
+  if (argc > 1 && strcmp(argv[1], "-v") == 0)
+    verbose = 1;
+  Serial.quiet = true;
+
+  oled = new Oled();
+  oled->init();
+  oled->begin();
+  oled->fillScreen(TFT_BLACK);
+  Frame(&s);
+
+  // Outside a batch, each call is a transaction
+  oled->fillRect(10, 10, 20, 20, TFT_RED);
+  Expect("fill", 1, 1);
+
+  oled->fillRect(10, 10, 20, 20, TFT_RED);
+  oled->drawRect(40, 10, 20, 20, TFT_GREEN);
+  oled->fillCircle(100, 100, 10, TFT_BLUE);
+  Expect("three calls", 3);
+
+  // A batch is one, however many calls
+  oled->beginBatch();
+  for (int i = 0; i < 10; i++)
+    oled->fillRect(10 * i, 50, 10, 10, i & 1 ? TFT_RED : TFT_WHITE);
+  oled->drawRect(0, 0, 100, 100, TFT_GREEN);
+  oled->fillCircle(120, 120, 20, TFT_BLUE);
+  oled->endBatch();
+  Expect("batch", 1);
+
+  // Fills that continue each other are one window
+  oled->beginBatch();
+  for (int i = 0; i < 10; i++)
+    oled->fillRect(10 * i, 50, 10, 10, TFT_RED);
+  oled->endBatch();
+  Expect("merged fills", 1, 1);
+
+  // An image drawn a row at a time, as LoadGif does : one window
+  for (int i = 0; i < 50 * 40; i++)
+    image[i] = i;
+  oled->beginBatch();
+  for (int y = 0; y < 40; y++)
+    oled->drawIcon(image + 50 * y, 20, 100 + y, 50, 1);
+  oled->endBatch();
+  Expect("image rows", 1, 1);
+
+  // Part of it, rows apart : still one window
+  oled->drawIcon(image + 5, 20, 100, 20, 40, 50);
+  Expect("image with stride", 1, 1);
+
+  uint8_t *icon = Icon::Pack(image, 50, 40);
+  uint16_t few[32 * 32];
+  for (int i = 0; i < 32 * 32; i++)
+    few[i] = (i / 100) * 0x0841;
+  uint8_t *icon4 = Icon::Pack(few, 32, 32);
+  oled->drawIcon(icon, 100, 100);
+  Expect("icon, 16 bit", 1, 1);
+  oled->drawIcon(icon4, 100, 100);
+  Expect("icon, 4 bit", 1, 1);
+
+  // Text fields : all that changed in one transaction
+  int f1 = oled->addTextField(10, 200, 3);
+  int f2 = oled->addTextField(10, 250, 1);
+  oled->setText(f1, "12:34");
+  oled->setText(f2, "Monday");
+  oled->flush();
+  Expect("two fields", 1, 2);
+
+  oled->setText(f1, "12:35");
+  oled->flush();
+  Expect("one digit", 1, 1);
+
+  oled->flush();
+  Expect("nothing changed", 0);
+
+  oled->addSprites(f1, "0123456789:");
+  oled->setText(f1, "12:36");
+  oled->flush();
+  Expect("one digit, sprites", 1, 1);
+
+  oled->setText(f1, "9:59");
+  oled->flush();
+  Expect("shorter, sprites", 1);
+
+  // A screen : cleared, the icons in one batch, the fields in one transaction,
+  // and the buttons draw themselves (TFT_eSPI_Button), three each
+  OledScreen scr;
+  scr.name = "test";
+  scr.number = 0;
+  scr.draw = 0;
+  int n = oled->addScreen(scr);
+  oled->addWidget(n, new OledLabel(10, 300, 2, "Label"));
+  oled->addWidget(n, new OledIconWidget(100, 100, icon4));
+  oled->addWidget(n, new OledButtonWidget(60, 60, 100, 40, TFT_WHITE, TFT_BLUE, TFT_WHITE,
+    "Press", 1, 0, 0));
+  oled->showScreen(n);
+  Expect("screen", 1 + 1 + 1 + 3, 0, 3);
+
+  oled->update();
+  Expect("screen, no change", 0);
+
+  free(icon);
+  free(icon4);
+
+  if (failed)
+    printf("%d failed\n", failed);
+  return failed != 0;
+}
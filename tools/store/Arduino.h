@@ -0,0 +1,55 @@
+/*
+ * Just enough of the Arduino core to build Keypad/AlarmStore.cpp on a PC
+ *
+ * The flash is an array that storetest.cpp can make fail half way, see EspClass.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef	_ARDUINO_H_
+#define	_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef bool boolean;
+
+/* Output is dropped, the test reports by itself */
+class HardwareSerial {
+  public:
+    void begin(unsigned long) {}
+    int printf(const char *, ...) { return 0; }
+};
+
+extern HardwareSerial Serial;
+
+/* Flash as a NOR chip does it : erase sets bits, writes only clear them */
+class EspClass {
+  public:
+    bool flashEraseSector(uint32_t sector);
+    bool flashWrite(uint32_t offset, uint32_t *data, size_t size);
+    bool flashRead(uint32_t offset, uint32_t *data, size_t size);
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+};
+
+extern EspClass ESP;
+
+#endif	/* _ARDUINO_H_ */
@@ -0,0 +1,233 @@
+/*
+ * Cut the power at every flash operation of Keypad/AlarmStore.cpp, on a PC
+ *
+ *	make check
+ *	./storetest [-v] [-n changes] [-t tries]
+ *
+ * The flash is an array that behaves like NOR flash : erasing sets all bits of a
+ * sector, writing only clears them. A run saves changes (700 by default : the slots
+ * of both sectors fill up more than once) and loses power at operation k, for every k.
+ * An interrupted erase leaves random bits set, an interrupted write has written part
+ * of the record and some bits of the next byte. Each k is tried with several of those
+ * random leftovers (-t).
+ *
+ * After the power loss, a new AlarmStore must come back with the last change that
+ * completed, or with the one that was being written. Then it must go on working : a
+ * change saved after that must be there after the next reboot.
+ *
+ * With the "alarm" partition (two sectors) nothing may be lost. With only the "eeprom"
+ * one, losing the state is expected when the power goes while the sector has no record :
+ * during the erase, or the first write after it. Only then.
+ *
+ * Copyright (c) 2018 Danny Backx
+ *
+ * License (GNU Lesser General Public License) :
+ *
+ *   This program is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 3 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <Arduino.h>
+#include <AlarmStore.h>
+#include <esp_partition.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+AlarmStore *alarmstore;
+
+static const int sector_size = 4096;
+static uint8_t flash[4 * sector_size];
+static esp_partition_t partition = { sector_size, 2 * sector_size };
+static const char *label;		// Of the one partition there is
+
+static long ops, power_loss;		// Operations so far, and the one that doesn't finish
+static bool empty;			// From an erase until a write completes
+static long erases[4];
+struct PowerLoss {};
+
+static uint64_t rng = 0x9E3779B97F4A7C15ULL;
+
+static uint32_t Random(uint32_t n) {
+  rng ^= rng << 13;
+  rng ^= rng >> 7;
+  rng ^= rng << 17;
+  return (rng >> 32) % n;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t,
+    const char *l) {
+  return strcmp(l, label) == 0 ? &partition : 0;
+}
+
+bool EspClass::flashEraseSector(uint32_t sector) {
+  uint8_t *p = flash + sector * sector_size;
+
+  empty = true;
+  if (++ops == power_loss) {
+    for (int i = 0; i < sector_size; i++)
+      p[i] |= Random(256);
+    throw PowerLoss();
+  }
+  memset(p, 0xFF, sector_size);
+  erases[sector]++;
+  return true;
+}
+
+bool EspClass::flashWrite(uint32_t offset, uint32_t *data, size_t size) {
+  const uint8_t *d = (const uint8_t *)data;
+  uint8_t *p = flash + offset;
+
+  if (++ops == power_loss) {
+    size_t n = Random(size);
+    for (size_t i = 0; i < n; i++)
+      p[i] &= d[i];
+    p[n] &= d[n] | Random(256);
+    throw PowerLoss();
+  }
+  for (size_t i = 0; i < size; i++)
+    p[i] &= d[i];
+  empty = false;
+  return true;
+}
+
+bool EspClass::flashRead(uint32_t offset, uint32_t *data, size_t size) {
+  memcpy(data, flash + offset, size);
+  return true;
+}
+
+static AlarmStatus Status(long i) {
+  return (AlarmStatus)(i % 3);		// Every change is a change
+}
+
+static int verbose;
+
+/*
+ * Power loss at every operation of a run of n changes, tries times each.
+ * Returns how many came back wrong, and how many of those weren't with an empty sector.
+ */
+static void Run(const char *l, uint32_t size, long n, int tries, long *lost, long *unexpected) {
+  long losses = 0;
+
+  label = l;
+  partition.size = size;
+  *lost = *unexpected = 0;
+
+  for (power_loss = 1; ; power_loss++) {
+    bool happened = false;
+
+    for (int t = 0; t < tries; t++) {
+      memset(flash, 0xFF, sizeof(flash));
+      ops = 0;
+      empty = false;
+
+      AlarmStore *s = new AlarmStore();
+      long done = -1, pending = -1;
+      try {
+        for (long i = 0; i < n; i++) {
+          pending = i;
+          s->Save(Status(i), 1000 + i);
+          done = i;
+        }
+      } catch (PowerLoss &) {
+        happened = true;
+      }
+      delete s;
+      if (! happened)
+        break;
+      losses++;
+
+      // Reboot
+      long k = power_loss;
+      bool was_empty = empty;
+      power_loss = 0;
+      AlarmStatus a;
+      time_t e;
+      s = new AlarmStore();
+      boolean ok = s->Load(&a, &e);
+      boolean good = (! ok && done < 0)
+        || (ok && (e == 1000 + done || e == 1000 + pending) && a == Status(e - 1000));
+
+      // And on from there
+      s->Save((AlarmStatus)((ok ? a + 1 : 1) % 3), 9999);
+      delete s;
+      s = new AlarmStore();
+      if (! s->Load(&a, &e) || e != 9999)
+        good = false;
+      delete s;
+      power_loss = k;
+
+      if (! good) {
+        (*lost)++;
+        if (! was_empty)
+          (*unexpected)++;
+        if (verbose)
+          printf("%s : power lost at operation %ld%s, got %s\n", l, k,
+            was_empty ? " (sector empty)" : "", ok ? "the wrong state" : "nothing");
+      }
+    }
+    if (! happened)
+      break;
+  }
+  printf("%-8s %d sector(s) : %ld changes, %ld power losses, %ld lost (%ld not while it was empty)\n",
+    l, size / sector_size, n, losses, *lost, *unexpected);
+}
+
+/*
+ * How the erases are spread over the sectors
+ */
+static void Wear(long n) {
+  label = "alarm";
+  partition.size = 2 * sector_size;
+  memset(flash, 0xFF, sizeof(flash));
+  memset(erases, 0, sizeof(erases));
+  power_loss = 0;
+
+  AlarmStore *s = new AlarmStore();
+  for (long i = 0; i < n; i++)
+    s->Save(Status(i), i);
+  delete s;
+  printf("%ld changes : %ld and %ld erases\n", n, erases[1], erases[2]);
+}
+
+int main(int argc, char *argv[]) {
+  long n = 700, lost, unexpected;
+  int tries = 4, opt, failed = 0;
+
+  while ((opt = getopt(argc, argv, "vn:t:")) != -1)
+    switch (opt) {
+    case 'v':
+      verbose = 1;
+      break;
+    case 'n':
+      n = atol(optarg);
+      break;
+    case 't':
+      tries = atoi(optarg);
+      break;
+    default:
+      fprintf(stderr, "Usage : %s [-v] [-n changes] [-t tries]\n", argv[0]);
+      exit(1);
+    }
+
+  Run("alarm", 2 * sector_size, n, tries, &lost, &unexpected);
+  if (lost)
+    failed++;
+  Run("eeprom", sector_size, n, tries, &lost, &unexpected);
+  if (unexpected)
+    failed++;
+  Wear(100000);
+
+  return failed != 0;
+}